@@ -0,0 +1,92 @@
+// Every denoising method at several resolutions. The input is a noisy render-like image of two surfaces, with a matching G-buffer for
+// the joint bilateral filter.
+
+#include "benchmark/benchmark.h"
+
+#include "Rendering/GBuffer.hpp"
+#include "Utilities/Denoiser.hpp"
+
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Raytracer;
+
+namespace {
+
+// Left half: a gray wall facing the camera, right half: a red floor further away. Each pixel has Monte Carlo like noise and one in a
+// hundred pixels is a hot pixel.
+Image CreateNoisyImage(std::size_t width, std::size_t height, std::optional<GBuffer>& gBuffer) {
+    std::mt19937_64 generator(1);
+    std::normal_distribution<double> noise(0.0, 0.1);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    Image image(width, height);
+    gBuffer.emplace(width, height);
+    for (std::size_t y = 0; y < height; y++) {
+        for (std::size_t x = 0; x < width; x++) {
+            const bool wall = (x < width / 2);
+            const Color albedo = wall ? Color(0.5, 0.5, 0.5) : Color(0.8, 0.2, 0.2);
+            const double shading = 0.3 + 0.7 * double(y) / double(height);
+            Color color = shading * albedo + Color(noise(generator), noise(generator), noise(generator));
+            if (uniform(generator) < 0.01) {
+                color = Color(20.0, 20.0, 20.0);
+            }
+            image.SetPixel(x, y, color);
+
+            GBufferData data;
+            data.hit = true;
+            data.depth = wall ? 2.0f : 5.0f;
+            data.normal = wall ? Vector3D({-1.0, 0.0, 0.0}) : Vector3D({0.0, 0.0, 1.0});
+            data.albedo = albedo;
+            gBuffer->SetData(x, y, data);
+        }
+    }
+    return image;
+}
+
+void BM_Denoiser(benchmark::State& state, Denoiser::Method method) {
+    const std::size_t width = state.range(0);
+    const std::size_t height = width * 3 / 4;
+    std::optional<GBuffer> gBuffer;
+    const Image image = CreateNoisyImage(width, height, gBuffer);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Denoiser::Denoise(image, method, gBuffer));
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+
+void BM_Denoiser_RemoveHotPixels(benchmark::State& state) {
+    const std::size_t width = state.range(0);
+    const std::size_t height = width * 3 / 4;
+    std::optional<GBuffer> gBuffer;
+    const Image image = CreateNoisyImage(width, height, gBuffer);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Denoiser::RemoveHotPixels(image));
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+
+const std::vector<std::pair<std::string, Denoiser::Method>> kMethods = {
+    {"BLUR", Denoiser::Method::BLUR},
+    {"GAUSSIAN_BLUR", Denoiser::Method::GAUSSIAN_BLUR},
+    {"BILATERAL_FILTER", Denoiser::Method::BILATERAL_FILTER},
+    {"JOINT_BILATERAL_FILTER", Denoiser::Method::JOINT_BILATERAL_FILTER},
+};
+
+// The widths of the images, with an aspect ratio of 4:3
+void AddResolutions(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgName("width")->Arg(160)->Arg(320)->Arg(640)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+const bool kRegistered = [] {
+    for (const auto& [name, method] : kMethods) {
+        AddResolutions(benchmark::RegisterBenchmark(("BM_Denoiser/" + name).c_str(), BM_Denoiser, method));
+    }
+    AddResolutions(benchmark::RegisterBenchmark("BM_Denoiser/REMOVE_HOT_PIXELS", BM_Denoiser_RemoveHotPixels));
+    return true;
+}();
+
+}  // namespace
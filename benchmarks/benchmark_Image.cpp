@@ -0,0 +1,34 @@
+// Image::Save() at several resolutions, i.e. the conversion to 8 bit and the PNG encoding, into the temporary directory
+
+#include "benchmark/benchmark.h"
+
+#include "Utilities/Image.hpp"
+
+#include <filesystem>
+#include <random>
+#include <string>
+
+using namespace Raytracer;
+
+static void BM_Image_Save(benchmark::State& state) {
+    const std::size_t width = state.range(0);
+    const std::size_t height = width * 3 / 4;
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    Image image(width, height);
+    for (std::size_t y = 0; y < height; y++) {
+        for (std::size_t x = 0; x < width; x++) {
+            // Smooth gradients with some noise, which compresses like a rendered image
+            const double noise = 0.05 * uniform(generator);
+            image.SetPixel(x, y, Color(double(x) / width + noise, double(y) / height + noise, 0.5 + noise));
+        }
+    }
+
+    const std::string filepath = (std::filesystem::temp_directory_path() / "raytracer_benchmark_image.png").string();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(image.Save(false, filepath));
+    }
+    std::filesystem::remove(filepath);
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_Image_Save)->ArgName("width")->Arg(320)->Arg(800)->Arg(1600)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,148 @@
+// Polynomial solvers of Utilities/Math.hpp. The quartic solvers run both on random polynomials and on the quartics of random rays against
+// a torus, which is where they spend their time during rendering.
+
+#include "benchmark/benchmark.h"
+
+#include "Utilities/Math.hpp"
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Raytracer;
+
+namespace {
+
+constexpr std::size_t kEquations = 1024;
+
+// Monic polynomials with real roots in [-2, 2], in the order a, b, c, ... of the solvers
+template <std::size_t Degree>
+const std::vector<std::array<double, Degree + 1>>& GetCoefficients() {
+    static const std::vector<std::array<double, Degree + 1>> coefficients = [] {
+        std::mt19937_64 generator(Degree);
+        std::uniform_real_distribution<double> uniform(-2.0, 2.0);
+        std::vector<std::array<double, Degree + 1>> result(kEquations);
+        for (auto& polynomial : result) {
+            polynomial = {};
+            polynomial[0] = 1.0;
+            for (std::size_t i = 0; i < Degree; i++) {
+                // Multiply by (t - root)
+                const double root = uniform(generator);
+                for (std::size_t j = i + 1; j > 0; j--) {
+                    polynomial[j] -= root * polynomial[j - 1];
+                }
+            }
+        }
+        return result;
+    }();
+    return coefficients;
+}
+
+// Quartics of rays with origin o and unit direction d against a torus with major radius R and minor radius r around the z axis
+const std::vector<std::array<double, 5>>& GetTorusCoefficients() {
+    static const std::vector<std::array<double, 5>> coefficients = [] {
+        constexpr double R = 1.0;
+        constexpr double r = 0.3;
+        std::mt19937_64 generator(4);
+        std::normal_distribution<double> normal;
+        std::uniform_real_distribution<double> uniform(-1.3, 1.3);
+        std::vector<std::array<double, 5>> result;
+        result.reserve(kEquations);
+        for (std::size_t i = 0; i < kEquations; i++) {
+            std::array<double, 3> o = {normal(generator), normal(generator), normal(generator)};
+            const double norm = std::sqrt(o[0] * o[0] + o[1] * o[1] + o[2] * o[2]);
+            for (double& x : o) {
+                x *= 4.0 / norm;
+            }
+            std::array<double, 3> d = {uniform(generator) - o[0], uniform(generator) - o[1], 0.3 * uniform(generator) - o[2]};
+            const double length = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+            for (double& x : d) {
+                x /= length;
+            }
+            const double od = o[0] * d[0] + o[1] * d[1] + o[2] * d[2];
+            const double oo = o[0] * o[0] + o[1] * o[1] + o[2] * o[2];
+            const double k = oo - R * R - r * r;
+            result.push_back({1.0,
+                              4.0 * od,
+                              2.0 * k + 4.0 * od * od + 4.0 * R * R * d[2] * d[2],
+                              4.0 * k * od + 8.0 * R * R * o[2] * d[2],
+                              k * k - 4.0 * R * R * (r * r - o[2] * o[2])});
+        }
+        return result;
+    }();
+    return coefficients;
+}
+
+}  // namespace
+
+static void BM_Math_SolveQuadratic(benchmark::State& state) {
+    const auto& coefficients = GetCoefficients<2>();
+    for (auto _ : state) {
+        for (const auto& c : coefficients) {
+            benchmark::DoNotOptimize(Math::SolveQuadratic(c[0], c[1], c[2]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * coefficients.size());
+}
+BENCHMARK(BM_Math_SolveQuadratic);
+
+static void BM_Math_SolveCubic(benchmark::State& state) {
+    const auto& coefficients = GetCoefficients<3>();
+    for (auto _ : state) {
+        for (const auto& c : coefficients) {
+            benchmark::DoNotOptimize(Math::SolveCubic(c[0], c[1], c[2], c[3]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * coefficients.size());
+}
+BENCHMARK(BM_Math_SolveCubic);
+
+// The argument selects random quartics (0) or torus quartics (1)
+static const std::vector<std::array<double, 5>>& GetQuartics(const benchmark::State& state) {
+    return (state.range(0) == 0) ? GetCoefficients<4>() : GetTorusCoefficients();
+}
+
+static void BM_Math_SolveQuartic(benchmark::State& state) {
+    const auto& coefficients = GetQuartics(state);
+    for (auto _ : state) {
+        for (const auto& c : coefficients) {
+            benchmark::DoNotOptimize(Math::SolveQuartic(c[0], c[1], c[2], c[3], c[4]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * coefficients.size());
+}
+BENCHMARK(BM_Math_SolveQuartic)->ArgName("torus")->Arg(0)->Arg(1);
+
+static void BM_Math_SolveQuarticBracketed(benchmark::State& state) {
+    const auto& coefficients = GetQuartics(state);
+    for (auto _ : state) {
+        for (const auto& c : coefficients) {
+            benchmark::DoNotOptimize(Math::SolveQuarticBracketed(c[0], c[1], c[2], c[3], c[4]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * coefficients.size());
+}
+BENCHMARK(BM_Math_SolveQuarticBracketed)->ArgName("torus")->Arg(0)->Arg(1);
+
+static void BM_Math_SolveQuarticInInterval(benchmark::State& state) {
+    const auto& coefficients = GetQuartics(state);
+    for (auto _ : state) {
+        for (const auto& c : coefficients) {
+            benchmark::DoNotOptimize(Math::SolveQuarticInInterval(c, 0.0, 10.0));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * coefficients.size());
+}
+BENCHMARK(BM_Math_SolveQuarticInInterval)->ArgName("torus")->Arg(0)->Arg(1);
+
+static void BM_Math_SolveQuarticDurandKerner(benchmark::State& state) {
+    const auto& coefficients = GetQuartics(state);
+    for (auto _ : state) {
+        for (const auto& c : coefficients) {
+            benchmark::DoNotOptimize(Math::SolveQuarticDurandKerner(c[0], c[1], c[2], c[3], c[4]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * coefficients.size());
+}
+BENCHMARK(BM_Math_SolveQuarticDurandKerner)->ArgName("torus")->Arg(0)->Arg(1);
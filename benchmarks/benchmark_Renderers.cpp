@@ -0,0 +1,93 @@
+// TraceRay() of every renderer on the sample scenes in bin/. The primary rays come from the camera of the scene file at a reduced
+// resolution, so that they cover the whole view. The timings include all secondary rays of the paths. TraceRays() traces all primary
+// rays of the image in one call, which compares the packet and wavefront renderers with the ray by ray loop of the others.
+
+#include "benchmark/benchmark.h"
+
+#include "Rendering/Camera.hpp"
+#include "Utilities/Configuration.hpp"
+#include "Version.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace Raytracer;
+
+namespace {
+
+constexpr std::size_t kWidth = 64;
+constexpr std::size_t kHeight = 48;
+
+const std::vector<std::string> kScenes = {"geometric_shapes", "brick_room"};
+
+const std::vector<std::pair<std::string, Renderer::Type>> kRenderers = {
+    {"SIMPLE", Renderer::Type::SIMPLE},
+    {"DETERMINISTIC", Renderer::Type::DETERMINISTIC},
+    {"RAY_TRACER", Renderer::Type::RAY_TRACER},
+    {"PATH_TRACER", Renderer::Type::PATH_TRACER},
+    {"PATH_TRACER_NEE", Renderer::Type::PATH_TRACER_NEE},
+    {"PATH_TRACER_WAVEFRONT", Renderer::Type::PATH_TRACER_WAVEFRONT},
+};
+
+std::vector<Ray> CreatePrimaryRays(const Camera& camera, Sampler& sampler) {
+    std::vector<Ray> rays;
+    rays.reserve(kWidth * kHeight);
+    for (std::size_t y = 0; y < kHeight; y++) {
+        for (std::size_t x = 0; x < kWidth; x++) {
+            rays.push_back(camera.CreateRay(x, y, sampler, false));
+        }
+    }
+    return rays;
+}
+
+void BM_Renderer_TraceRay(benchmark::State& state, const std::string& sceneName, Renderer::Type rendererType) {
+    Configuration::GetInstance().ParseYamlFile(TOP_LEVEL_DIR "bin/" + sceneName + ".yaml");
+    Scene scene = Configuration::GetInstance().ConstructScene();
+    scene.BuildAccelerationStructure();
+    Camera camera = Configuration::GetInstance().ConstructCamera();
+    camera.SetResolution(kWidth, kHeight);
+    auto renderer = Camera::CreateRenderer(rendererType);
+
+    Sampler sampler(1);
+    const std::vector<Ray> rays = CreatePrimaryRays(camera, sampler);
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(renderer->TraceRay(rays[i], scene, sampler));
+        i = (i + 1 == rays.size()) ? 0 : i + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Renderer_TraceRays(benchmark::State& state, const std::string& sceneName, Renderer::Type rendererType) {
+    Configuration::GetInstance().ParseYamlFile(TOP_LEVEL_DIR "bin/" + sceneName + ".yaml");
+    Scene scene = Configuration::GetInstance().ConstructScene();
+    scene.BuildAccelerationStructure();
+    Camera camera = Configuration::GetInstance().ConstructCamera();
+    camera.SetResolution(kWidth, kHeight);
+    auto renderer = Camera::CreateRenderer(rendererType);
+
+    Sampler sampler(1);
+    const std::vector<Ray> rays = CreatePrimaryRays(camera, sampler);
+    std::vector<Sampler> samplers(rays.size(), sampler);
+    std::vector<Color> colors(rays.size());
+
+    for (auto _ : state) {
+        renderer->TraceRays(rays, scene, samplers, colors);
+        benchmark::DoNotOptimize(colors.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * rays.size());
+}
+
+const bool kRegistered = [] {
+    for (const auto& scene : kScenes) {
+        for (const auto& [name, type] : kRenderers) {
+            benchmark::RegisterBenchmark(("BM_Renderer_TraceRay/" + scene + "/" + name).c_str(), BM_Renderer_TraceRay, scene, type);
+            benchmark::RegisterBenchmark(("BM_Renderer_TraceRays/" + scene + "/" + name).c_str(), BM_Renderer_TraceRays, scene, type);
+        }
+    }
+    return true;
+}();
+
+}  // namespace
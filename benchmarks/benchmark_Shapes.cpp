@@ -0,0 +1,119 @@
+// Ray versus shape throughput for every shape type. The rays start on a sphere around the shape and aim at random points near its
+// center, so that roughly half of them hit. Lines that are reused across iterations keep the timings independent of the generator.
+
+#include "benchmark/benchmark.h"
+
+#include "Geometry/Shapes.hpp"
+#include "Utilities/MeshLoader.hpp"
+#include "Version.hpp"
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Raytracer;
+using namespace Raytracer::Geometry;
+
+namespace {
+
+constexpr std::size_t kLines = 1024;
+
+const Vector3D kPosition({0.0, 0.0, 0.0});
+const Vector3D kOrientation({0.3, -0.2, 1.0});
+const Vector3D kReferenceDirection = Vector3D({1.0, 0.0, -0.3}).Normalized();  // orthogonal to the orientation
+
+// Every shape type with a class, at the origin and about unit size
+const std::vector<std::pair<std::string, std::function<std::shared_ptr<Shape>()>>>& GetShapeFactories() {
+    static const std::vector<std::pair<std::string, std::function<std::shared_ptr<Shape>()>>> factories = {
+        {"BOX", [] { return std::make_shared<Box>(kPosition, kOrientation, kReferenceDirection, 1.0, 1.5, 2.0); }},
+        {"BOX_AXIS_ALIGNED", [] { return std::make_shared<BoxAxisAligned>(kPosition, 1.0, 1.5, 2.0); }},
+        {"CONE", [] { return std::make_shared<Cone>(kPosition, kOrientation, 1.0, 2.0); }},
+        {"CYLINDER", [] { return std::make_shared<Cylinder>(kPosition, kOrientation, 1.0, 2.0); }},
+        {"CYLINDRICAL_SHELL", [] { return std::make_shared<CylindricalShell>(kPosition, kOrientation, 0.5, 1.0, 2.0); }},
+        {"DISK", [] { return std::make_shared<Disk>(kPosition, kOrientation, 1.0); }},
+        {"HALF_TORUS", [] { return std::make_shared<HalfTorus>(kPosition, kOrientation, kReferenceDirection, 1.0, 0.3); }},
+        {"HALF_TORUS_WITH_SPHERICAL_CAPS", [] { return std::make_shared<HalfTorusWithSphericalCaps>(kPosition, kOrientation, kReferenceDirection, 1.0, 0.3); }},
+        {"MESH", [] { return std::make_shared<Mesh>(MeshLoader::Load(TOP_LEVEL_DIR "models/icosahedron.obj"), kPosition, kOrientation, kReferenceDirection); }},
+        {"OCTAHEDRON", [] { return std::make_shared<Octahedron>(kPosition, kOrientation, kReferenceDirection, 1.5); }},
+        {"RECTANGLE", [] { return std::make_shared<Rectangle>(kPosition, kOrientation, kReferenceDirection, 1.5, 2.0); }},
+        {"RING", [] { return std::make_shared<Ring>(kPosition, kOrientation, 0.5, 1.0); }},
+        {"SPHERE", [] { return std::make_shared<Sphere>(kPosition, 1.0); }},
+        {"SPHERICAL_CAP", [] { return std::make_shared<SphericalCap>(kPosition, 1.0, kOrientation, M_PI / 3.0); }},
+        {"TETRAHEDRON", [] { return std::make_shared<Tetrahedron>(kPosition, kOrientation, kReferenceDirection, 1.5); }},
+        {"TORUS", [] { return std::make_shared<Torus>(kPosition, kOrientation, 1.0, 0.3); }},
+        {"TRIANGLE", [] { return std::make_shared<Triangle>(Vector3D({-1.0, -1.0, 0.0}), Vector3D({1.0, -1.0, 0.0}), Vector3D({0.0, 1.0, 0.5})); }},
+        {"TUBE", [] { return std::make_shared<Tube>(kPosition, kOrientation, 1.0, 2.0); }},
+    };
+    return factories;
+}
+
+const std::vector<Line>& GetLines() {
+    static const std::vector<Line> lines = [] {
+        std::mt19937_64 generator(1);
+        std::normal_distribution<double> normal;
+        std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+        std::vector<Line> result;
+        result.reserve(kLines);
+        for (std::size_t i = 0; i < kLines; i++) {
+            Vector3D origin({Real(normal(generator)), Real(normal(generator)), Real(normal(generator))});
+            origin = 5.0 * origin.Normalized();
+            const Vector3D target({Real(uniform(generator)), Real(uniform(generator)), Real(uniform(generator))});
+            result.emplace_back(origin, target - origin, 0.0);
+        }
+        return result;
+    }();
+    return lines;
+}
+
+void BM_Shape_Intersect(benchmark::State& state, const std::function<std::shared_ptr<Shape>()>& createShape) {
+    const auto shape = createShape();
+    const auto& lines = GetLines();
+    std::size_t hits = 0;
+    for (auto _ : state) {
+        for (const Line& line : lines) {
+            auto intersection = shape->Intersect(line);
+            hits += intersection.has_value();
+            benchmark::DoNotOptimize(intersection);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lines.size());
+    state.counters["hit_rate"] = double(hits) / double(state.iterations() * lines.size());
+}
+
+void BM_Shape_Occluded(benchmark::State& state, const std::function<std::shared_ptr<Shape>()>& createShape) {
+    const auto shape = createShape();
+    const auto& lines = GetLines();
+    for (auto _ : state) {
+        for (const Line& line : lines) {
+            benchmark::DoNotOptimize(shape->Occluded(line, 0.0, 10.0));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lines.size());
+}
+
+// The slab test of Box against the six faces it is composed of
+void BM_Box_FindHit(benchmark::State& state, bool sixFaces) {
+    const Box box(kPosition, kOrientation, kReferenceDirection, 1.0, 1.5, 2.0);
+    const auto& lines = GetLines();
+    for (auto _ : state) {
+        for (const Line& line : lines) {
+            benchmark::DoNotOptimize(sixFaces ? box.CompositeShape::FindHit(line) : box.FindHit(line));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lines.size());
+}
+
+const bool kRegistered = [] {
+    for (const auto& [name, createShape] : GetShapeFactories()) {
+        benchmark::RegisterBenchmark(("BM_Shape_Intersect/" + name).c_str(), BM_Shape_Intersect, createShape);
+        benchmark::RegisterBenchmark(("BM_Shape_Occluded/" + name).c_str(), BM_Shape_Occluded, createShape);
+    }
+    benchmark::RegisterBenchmark("BM_Box_FindHit/SLAB", BM_Box_FindHit, false);
+    benchmark::RegisterBenchmark("BM_Box_FindHit/SIX_FACES", BM_Box_FindHit, true);
+    return true;
+}();
+
+}  // namespace
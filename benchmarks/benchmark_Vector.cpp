@@ -0,0 +1,179 @@
+// Per-operation timings of the Vector3D and Color kernels. The Scalar variants loop over std::array, which is how both types were
+// stored before they got SIMD storage, so that the two can be compared on each target. The operands fit into the L1 cache.
+
+#include "benchmark/benchmark.h"
+
+#include "Geometry/Vector.hpp"
+#include "Utilities/Color.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace Raytracer;
+
+namespace {
+
+constexpr std::size_t kOperands = 1024;
+
+using ScalarVector = std::array<Real, 3>;
+
+ScalarVector Add(const ScalarVector& a, const ScalarVector& b) {
+    ScalarVector result;
+    for (std::size_t i = 0; i < 3; ++i) {
+        result[i] = a[i] + b[i];
+    }
+    return result;
+}
+
+ScalarVector Multiply(const ScalarVector& a, const ScalarVector& b) {
+    ScalarVector result;
+    for (std::size_t i = 0; i < 3; ++i) {
+        result[i] = a[i] * b[i];
+    }
+    return result;
+}
+
+Real Dot(const ScalarVector& a, const ScalarVector& b) {
+    Real result{};
+    for (std::size_t i = 0; i < 3; ++i) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+ScalarVector Cross(const ScalarVector& a, const ScalarVector& b) {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+ScalarVector Normalized(const ScalarVector& a) {
+    const Real norm = std::sqrt(Dot(a, a));
+    ScalarVector result;
+    for (std::size_t i = 0; i < 3; ++i) {
+        result[i] = a[i] / norm;
+    }
+    return result;
+}
+
+struct Operands {
+    std::vector<ScalarVector> scalarA, scalarB;
+    std::vector<Vector3D> vectorA, vectorB;
+    std::vector<Color> colorA, colorB;
+};
+
+const Operands& GetOperands() {
+    static const Operands operands = [] {
+        std::mt19937_64 generator(1);
+        std::uniform_real_distribution<double> distribution(0.1, 1.0);
+        Operands result;
+        for (std::size_t i = 0; i < kOperands; ++i) {
+            ScalarVector a, b;
+            for (std::size_t j = 0; j < 3; ++j) {
+                a[j] = Real(distribution(generator));
+                b[j] = Real(distribution(generator));
+            }
+            result.scalarA.push_back(a);
+            result.scalarB.push_back(b);
+            result.vectorA.push_back(Vector3D({a[0], a[1], a[2]}));
+            result.vectorB.push_back(Vector3D({b[0], b[1], b[2]}));
+            result.colorA.push_back(Color(a[0], a[1], a[2]));
+            result.colorB.push_back(Color(b[0], b[1], b[2]));
+        }
+        return result;
+    }();
+    return operands;
+}
+
+// Applies the operation to all operands per iteration and reports the time per operation
+template <typename Operation>
+void RunOperation(benchmark::State& state, Operation operation) {
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kOperands; ++i) {
+            benchmark::DoNotOptimize(operation(i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kOperands);
+    state.counters["simd"] = Simd::kVectorized<Real, 3> ? 1 : 0;
+}
+
+}  // namespace
+
+static void BM_Vector3D_Add_Scalar(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return Add(o.scalarA[i], o.scalarB[i]); });
+}
+BENCHMARK(BM_Vector3D_Add_Scalar);
+
+static void BM_Vector3D_Add(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return o.vectorA[i] + o.vectorB[i]; });
+}
+BENCHMARK(BM_Vector3D_Add);
+
+static void BM_Vector3D_Dot_Scalar(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return Dot(o.scalarA[i], o.scalarB[i]); });
+}
+BENCHMARK(BM_Vector3D_Dot_Scalar);
+
+static void BM_Vector3D_Dot(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return o.vectorA[i].Dot(o.vectorB[i]); });
+}
+BENCHMARK(BM_Vector3D_Dot);
+
+static void BM_Vector3D_FusedDot(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return o.vectorA[i].FusedDot(o.vectorB[i]); });
+}
+BENCHMARK(BM_Vector3D_FusedDot);
+
+static void BM_Vector3D_Cross_Scalar(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return Cross(o.scalarA[i], o.scalarB[i]); });
+}
+BENCHMARK(BM_Vector3D_Cross_Scalar);
+
+static void BM_Vector3D_Cross(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return o.vectorA[i].Cross(o.vectorB[i]); });
+}
+BENCHMARK(BM_Vector3D_Cross);
+
+static void BM_Vector3D_Normalized_Scalar(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return Normalized(o.scalarA[i]); });
+}
+BENCHMARK(BM_Vector3D_Normalized_Scalar);
+
+static void BM_Vector3D_Normalized(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return o.vectorA[i].Normalized(); });
+}
+BENCHMARK(BM_Vector3D_Normalized);
+
+static void BM_Vector3D_NormalizedUnchecked(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return o.vectorA[i].NormalizedUnchecked(); });
+}
+BENCHMARK(BM_Vector3D_NormalizedUnchecked);
+
+static void BM_Color_Add(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return o.colorA[i] + o.colorB[i]; });
+}
+BENCHMARK(BM_Color_Add);
+
+static void BM_Color_Multiply_Scalar(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return Multiply(o.scalarA[i], o.scalarB[i]); });
+}
+BENCHMARK(BM_Color_Multiply_Scalar);
+
+static void BM_Color_Multiply(benchmark::State& state) {
+    const auto& o = GetOperands();
+    RunOperation(state, [&](std::size_t i) { return o.colorA[i] * o.colorB[i]; });
+}
+BENCHMARK(BM_Color_Multiply);
@@ -0,0 +1,47 @@
+#include "Geometry/AffineTransform.hpp"
+
+#include "Geometry/PacketKernels.hpp"
+
+#include <stdexcept>
+
+namespace Raytracer::Geometry {
+
+AffineTransform::AffineTransform() :
+    AffineTransform(OrthonormalBasis(), Vector3D({0.0, 0.0, 0.0})) {
+}
+
+AffineTransform::AffineTransform(const OrthonormalBasis& basis, const Vector3D& position) :
+    mPosition(position) {
+    for (std::size_t row = 0; row < 3; row++) {
+        for (std::size_t column = 0; column < 3; column++) {
+            mToLocal[3 * row + column] = basis[row][column];
+            mToGlobal[3 * column + row] = basis[row][column];
+        }
+    }
+    mIsAxisAligned = (mToLocal == Matrix{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0});
+}
+
+void AffineTransform::ToLocal(std::span<const Line> lines, std::span<Vector3D> localOrigins, std::span<Vector3D> localDirections) const {
+    if (localOrigins.size() < lines.size() || localDirections.size() < lines.size()) {
+        throw std::invalid_argument("Output spans are smaller than the number of lines.");
+    }
+    for (std::size_t i = 0; i < lines.size(); i++) {
+        localOrigins[i] = lines[i].GetOrigin() - mPosition;
+    }
+    if (mIsAxisAligned) {
+        for (std::size_t i = 0; i < lines.size(); i++) {
+            localDirections[i] = lines[i].GetDirection();
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < lines.size(); i++) {
+        localOrigins[i] = Multiply(mToLocal, localOrigins[i]);
+        localDirections[i] = Multiply(mToLocal, lines[i].GetDirection());
+    }
+}
+
+void AffineTransform::ToLocal(const LinePacket& packet, std::array<LinePacket::Lanes, 3>& localOrigins, std::array<LinePacket::Lanes, 3>& localDirections) const {
+    PacketKernels::TransformToLocal(packet, mToLocal, mPosition, localOrigins, localDirections);
+}
+
+}  // namespace Raytracer::Geometry
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Geometry/Line.hpp"
+#include "Geometry/LinePacket.hpp"
+#include "Geometry/OrthonormalBasis.hpp"
+#include "Geometry/Vector.hpp"
+
+#include <array>
+#include <span>
+
+namespace Raytracer::Geometry {
+
+// Rigid transform between world coordinates and the local coordinates of a shape, stored as a compact 3x4 matrix [R | p] together
+// with its inverse [R^T | p]. The rows of R are the basis vectors and p is the shape's position.
+// Points are translated before they are rotated into the local frame, which keeps distant ray origins accurate near the shape.
+class AffineTransform {
+public:
+    AffineTransform();
+    AffineTransform(const OrthonormalBasis& basis, const Vector3D& position);
+
+    // True if the basis is the standard basis, in which case only the translation is applied
+    bool IsAxisAligned() const {
+        return mIsAxisAligned;
+    }
+
+    Vector3D ToLocalPoint(const Vector3D& point) const {
+        return ToLocalDirection(point - mPosition);
+    }
+
+    Vector3D ToLocalDirection(const Vector3D& direction) const {
+        if (mIsAxisAligned) {
+            return direction;
+        }
+        return Multiply(mToLocal, direction);
+    }
+
+    Vector3D ToGlobalPoint(const Vector3D& point) const {
+        return ToGlobalDirection(point) + mPosition;
+    }
+
+    Vector3D ToGlobalDirection(const Vector3D& direction) const {
+        if (mIsAxisAligned) {
+            return direction;
+        }
+        return Multiply(mToGlobal, direction);
+    }
+
+    // Batched transform for ray packets, writing the local origins and directions of all lines at once
+    void ToLocal(std::span<const Line> lines, std::span<Vector3D> localOrigins, std::span<Vector3D> localDirections) const;
+    void ToLocal(const LinePacket& packet, std::array<LinePacket::Lanes, 3>& localOrigins, std::array<LinePacket::Lanes, 3>& localDirections) const;
+
+private:
+    using Matrix = std::array<double, 9>;  // row-major 3x3
+
+    Matrix mToLocal;   // rows are the basis vectors
+    Matrix mToGlobal;  // columns are the basis vectors
+    Vector3D mPosition;
+    bool mIsAxisAligned;
+
+    static Vector3D Multiply(const Matrix& matrix, const Vector3D& vector) {
+        return Vector3D({static_cast<Real>(matrix[0] * vector[0] + matrix[1] * vector[1] + matrix[2] * vector[2]),
+                         static_cast<Real>(matrix[3] * vector[0] + matrix[4] * vector[1] + matrix[5] * vector[2]),
+                         static_cast<Real>(matrix[6] * vector[0] + matrix[7] * vector[1] + matrix[8] * vector[2])});
+    }
+};
+
+}  // namespace Raytracer::Geometry
@@ -0,0 +1,166 @@
+#include "Geometry/BVH.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace Raytracer::Geometry {
+
+BVH::BVH(const std::vector<BoundingBox>& primitiveBounds, std::size_t maxPrimitivesPerLeaf) :
+    mMaxPrimitivesPerLeaf(std::max<std::size_t>(1, maxPrimitivesPerLeaf)) {
+    if (primitiveBounds.empty()) {
+        return;
+    }
+
+    // An empty box has no centroid (its center is NaN), and its primitive cannot be hit anyway
+    std::vector<BuildPrimitive> primitives;
+    primitives.reserve(primitiveBounds.size());
+    for (std::size_t i = 0; i < primitiveBounds.size(); i++) {
+        if (!primitiveBounds[i].IsEmpty()) {
+            primitives.push_back({primitiveBounds[i], primitiveBounds[i].GetCenter(), static_cast<std::uint32_t>(i)});
+        }
+    }
+    if (primitives.empty()) {
+        return;
+    }
+
+    mNodes.reserve(2 * primitives.size());
+    mPrimitiveIndices.reserve(primitives.size());
+    BuildRecursively(primitives, 0, primitives.size(), 1);
+}
+
+bool BVH::IsEmpty() const {
+    return mNodes.empty();
+}
+
+std::size_t BVH::NumberOfNodes() const {
+    return mNodes.size();
+}
+
+std::size_t BVH::NumberOfPrimitives() const {
+    return mPrimitiveIndices.size();
+}
+
+std::size_t BVH::Depth() const {
+    return mDepth;
+}
+
+BoundingBox BVH::GetBoundingBox() const {
+    return mNodes.empty() ? BoundingBox() : mNodes.front().bounds;
+}
+
+void BVH::PrintInfo() const {
+    std::cout << "Bounding Volume Hierarchy:" << std::endl
+              << "\tPrimitives:\t" << NumberOfPrimitives() << std::endl
+              << "\tNodes:\t\t" << NumberOfNodes() << std::endl
+              << "\tDepth:\t\t" << Depth() << std::endl
+              << "\tBounds:\t\t" << GetBoundingBox() << std::endl
+              << std::endl;
+}
+
+// Top-down construction using the surface area heuristic (SAH) evaluated on a fixed number of centroid bins
+std::uint32_t BVH::BuildRecursively(std::vector<BuildPrimitive>& primitives, std::size_t begin, std::size_t end, std::size_t depth) {
+    const std::uint32_t nodeIndex = static_cast<std::uint32_t>(mNodes.size());
+    mNodes.emplace_back();
+    mDepth = std::max(mDepth, depth);
+
+    BoundingBox bounds;
+    BoundingBox centroidBounds;
+    for (std::size_t i = begin; i < end; i++) {
+        bounds.Expand(primitives[i].bounds);
+        centroidBounds.Expand(primitives[i].centroid);
+    }
+    mNodes[nodeIndex].bounds = bounds;
+
+    const std::size_t numPrimitives = end - begin;
+    const std::size_t axis = centroidBounds.LongestAxis();
+    const double axisMinimum = centroidBounds.GetMinimum()[axis];
+    const double axisExtent = centroidBounds.GetMaximum()[axis] - axisMinimum;
+
+    // Small nodes become leaves, as do nodes whose centroids all coincide (no split can separate them)
+    if (numPrimitives <= mMaxPrimitivesPerLeaf || depth >= kMaximumDepth || !(axisExtent > 0.0)) {
+        CreateLeaf(nodeIndex, primitives, begin, end);
+        return nodeIndex;
+    }
+
+    auto binIndex = [&](const BuildPrimitive& primitive) {
+        auto bin = static_cast<std::size_t>(kNumberOfBins * (primitive.centroid[axis] - axisMinimum) / axisExtent);
+        return std::min(bin, kNumberOfBins - 1);
+    };
+
+    std::array<BoundingBox, kNumberOfBins> binBounds;
+    std::array<std::size_t, kNumberOfBins> binCounts{};
+    for (std::size_t i = begin; i < end; i++) {
+        std::size_t bin = binIndex(primitives[i]);
+        binBounds[bin].Expand(primitives[i].bounds);
+        binCounts[bin]++;
+    }
+
+    // Sweep from the right to get the cost of all right partitions, then from the left
+    std::array<double, kNumberOfBins - 1> rightCosts;
+    BoundingBox rightBounds;
+    std::size_t rightCount = 0;
+    for (std::size_t split = kNumberOfBins - 1; split > 0; split--) {
+        rightBounds.Expand(binBounds[split]);
+        rightCount += binCounts[split];
+        rightCosts[split - 1] = rightCount * rightBounds.SurfaceArea();
+    }
+
+    std::size_t bestSplit = 0;
+    double bestCost = std::numeric_limits<double>::infinity();
+    BoundingBox leftBounds;
+    std::size_t leftCount = 0;
+    for (std::size_t split = 1; split < kNumberOfBins; split++) {
+        leftBounds.Expand(binBounds[split - 1]);
+        leftCount += binCounts[split - 1];
+        if (leftCount == 0 || leftCount == numPrimitives) {
+            continue;
+        }
+        double cost = leftCount * leftBounds.SurfaceArea() + rightCosts[split - 1];
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestSplit = split;
+        }
+    }
+
+    std::size_t middle = begin;
+    if (bestSplit > 0) {
+        // Small nodes become leaves if intersecting all primitives is cheaper than the split (traversal step cost ~ one intersection test)
+        const double area = bounds.SurfaceArea();
+        const double splitCost = (area > 0.0) ? 1.0 + bestCost / area : 0.0;
+        if (numPrimitives <= 4 * mMaxPrimitivesPerLeaf && splitCost >= static_cast<double>(numPrimitives)) {
+            CreateLeaf(nodeIndex, primitives, begin, end);
+            return nodeIndex;
+        }
+        auto it = std::partition(primitives.begin() + begin, primitives.begin() + end, [&](const BuildPrimitive& primitive) {
+            return binIndex(primitive) < bestSplit;
+        });
+        middle = static_cast<std::size_t>(it - primitives.begin());
+    }
+    if (middle == begin || middle == end) {
+        // Fall back to a median split
+        middle = begin + numPrimitives / 2;
+        std::nth_element(primitives.begin() + begin, primitives.begin() + middle, primitives.begin() + end, [axis](const BuildPrimitive& a, const BuildPrimitive& b) {
+            return a.centroid[axis] < b.centroid[axis];
+        });
+    }
+
+    // The first child directly follows its parent
+    BuildRecursively(primitives, begin, middle, depth + 1);
+    const std::uint32_t secondChild = BuildRecursively(primitives, middle, end, depth + 1);
+    mNodes[nodeIndex].offset = secondChild;
+    mNodes[nodeIndex].numPrimitives = 0;
+    mNodes[nodeIndex].splitAxis = static_cast<std::uint8_t>(axis);
+
+    return nodeIndex;
+}
+
+void BVH::CreateLeaf(std::uint32_t nodeIndex, const std::vector<BuildPrimitive>& primitives, std::size_t begin, std::size_t end) {
+    mNodes[nodeIndex].offset = static_cast<std::uint32_t>(mPrimitiveIndices.size());
+    mNodes[nodeIndex].numPrimitives = static_cast<std::uint32_t>(end - begin);
+    for (std::size_t i = begin; i < end; i++) {
+        mPrimitiveIndices.push_back(primitives[i].index);
+    }
+}
+
+}  // namespace Raytracer::Geometry
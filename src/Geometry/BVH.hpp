@@ -0,0 +1,189 @@
+#pragma once
+
+#include "Geometry/BoundingBox.hpp"
+#include "Geometry/Line.hpp"
+#include "Geometry/LinePacket.hpp"
+#include "Geometry/PacketKernels.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Raytracer::Geometry {
+
+// Bounding volume hierarchy over a set of primitives that are identified by their index.
+// The hierarchy only knows about the primitives' bounding boxes, the actual intersection tests are done by the caller during Traverse().
+// Primitives with an empty bounding box, e.g. objects without a shape, are left out.
+class BVH {
+public:
+    struct Node {
+        BoundingBox bounds;
+        std::uint32_t offset = 0;         // Index of the first primitive (leaf) or of the second child (interior node)
+        std::uint32_t numPrimitives = 0;  // Zero for interior nodes, whose first child directly follows the node
+        std::uint8_t splitAxis = 0;
+
+        bool IsLeaf() const {
+            return numPrimitives > 0;
+        }
+    };
+
+    BVH() = default;
+    explicit BVH(const std::vector<BoundingBox>& primitiveBounds, std::size_t maxPrimitivesPerLeaf = 4);
+
+    bool IsEmpty() const;
+    std::size_t NumberOfNodes() const;
+    std::size_t NumberOfPrimitives() const;
+    std::size_t Depth() const;
+
+    BoundingBox GetBoundingBox() const;
+
+    // Visits all primitives whose bounding box overlaps the line segment [tMin, tMax], approximately front to back.
+    // The visitor is called with the primitive index and may shrink tMax (e.g. after finding a closer hit), which prunes the remaining traversal.
+    // If the visitor returns true, the traversal stops immediately.
+    template <typename Visitor>
+    void Traverse(const Line& line, double tMin, double& tMax, Visitor&& visitor) const;
+
+    // Traverse() for a packet of coherent lines with one tMax per lane. A node is visited if any lane overlaps it, and the
+    // children are ordered by the direction of the first lane.
+    template <typename Visitor>
+    void TraversePacket(const LinePacket& packet, double tMin, LinePacket::Lanes& tMax, Visitor&& visitor) const;
+
+    // Visits all primitives whose bounding box overlaps the given box. If the visitor returns true, the query stops immediately.
+    template <typename Visitor>
+    void Query(const BoundingBox& box, Visitor&& visitor) const;
+
+    void PrintInfo() const;
+
+private:
+    std::vector<Node> mNodes;
+    std::vector<std::uint32_t> mPrimitiveIndices;
+    std::size_t mMaxPrimitivesPerLeaf = 4;
+    std::size_t mDepth = 0;
+
+    static constexpr std::size_t kMaximumDepth = 64;
+    static constexpr std::size_t kNumberOfBins = 12;
+
+    struct BuildPrimitive {
+        BoundingBox bounds;
+        Vector3D centroid;
+        std::uint32_t index;
+    };
+
+    std::uint32_t BuildRecursively(std::vector<BuildPrimitive>& primitives, std::size_t begin, std::size_t end, std::size_t depth);
+    void CreateLeaf(std::uint32_t nodeIndex, const std::vector<BuildPrimitive>& primitives, std::size_t begin, std::size_t end);
+};
+
+template <typename Visitor>
+void BVH::Traverse(const Line& line, double tMin, double& tMax, Visitor&& visitor) const {
+    if (mNodes.empty()) {
+        return;
+    }
+
+    const Vector3D origin = line.GetOrigin();
+    const Vector3D direction = line.GetDirection();
+    const Vector3D& inverseDirection = line.GetInverseDirection();
+
+    // Nodes still to be visited (the far children)
+    std::array<std::uint32_t, kMaximumDepth> stack;
+    std::size_t stackSize = 0;
+    std::uint32_t current = 0;
+
+    while (true) {
+        const Node& node = mNodes[current];
+        if (node.bounds.Intersect(origin, inverseDirection, tMin, tMax)) {
+            if (node.IsLeaf()) {
+                for (std::uint32_t i = 0; i < node.numPrimitives; i++) {
+                    if (visitor(static_cast<std::size_t>(mPrimitiveIndices[node.offset + i]))) {
+                        return;
+                    }
+                }
+            } else {
+                // Visit the child that lies closer along the ray first
+                if (direction[node.splitAxis] < 0.0) {
+                    stack[stackSize++] = current + 1;
+                    current = node.offset;
+                } else {
+                    stack[stackSize++] = node.offset;
+                    current = current + 1;
+                }
+                continue;
+            }
+        }
+        if (stackSize == 0) {
+            break;
+        }
+        current = stack[--stackSize];
+    }
+}
+
+template <typename Visitor>
+void BVH::TraversePacket(const LinePacket& packet, double tMin, LinePacket::Lanes& tMax, Visitor&& visitor) const {
+    if (mNodes.empty() || packet.size == 0) {
+        return;
+    }
+
+    std::array<std::uint32_t, kMaximumDepth> stack;
+    std::size_t stackSize = 0;
+    std::uint32_t current = 0;
+
+    while (true) {
+        const Node& node = mNodes[current];
+        if (PacketKernels::IntersectBoundingBox(packet, node.bounds, tMin, tMax)) {
+            if (node.IsLeaf()) {
+                for (std::uint32_t i = 0; i < node.numPrimitives; i++) {
+                    if (visitor(static_cast<std::size_t>(mPrimitiveIndices[node.offset + i]))) {
+                        return;
+                    }
+                }
+            } else {
+                if (packet.direction[node.splitAxis][0] < 0.0) {
+                    stack[stackSize++] = current + 1;
+                    current = node.offset;
+                } else {
+                    stack[stackSize++] = node.offset;
+                    current = current + 1;
+                }
+                continue;
+            }
+        }
+        if (stackSize == 0) {
+            break;
+        }
+        current = stack[--stackSize];
+    }
+}
+
+template <typename Visitor>
+void BVH::Query(const BoundingBox& box, Visitor&& visitor) const {
+    if (mNodes.empty()) {
+        return;
+    }
+
+    std::array<std::uint32_t, kMaximumDepth> stack;
+    std::size_t stackSize = 0;
+    std::uint32_t current = 0;
+
+    while (true) {
+        const Node& node = mNodes[current];
+        if (node.bounds.Overlaps(box)) {
+            if (node.IsLeaf()) {
+                for (std::uint32_t i = 0; i < node.numPrimitives; i++) {
+                    if (visitor(static_cast<std::size_t>(mPrimitiveIndices[node.offset + i]))) {
+                        return;
+                    }
+                }
+            } else {
+                stack[stackSize++] = node.offset;
+                current = current + 1;
+                continue;
+            }
+        }
+        if (stackSize == 0) {
+            break;
+        }
+        current = stack[--stackSize];
+    }
+}
+
+}  // namespace Raytracer::Geometry
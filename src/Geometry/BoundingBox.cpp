@@ -0,0 +1,109 @@
+#include "Geometry/BoundingBox.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Raytracer::Geometry {
+
+BoundingBox::BoundingBox() :
+    mMinimum(Vector3D({std::numeric_limits<Real>::infinity(), std::numeric_limits<Real>::infinity(), std::numeric_limits<Real>::infinity()})),
+    mMaximum(Vector3D({-std::numeric_limits<Real>::infinity(), -std::numeric_limits<Real>::infinity(), -std::numeric_limits<Real>::infinity()})) {
+}
+
+BoundingBox::BoundingBox(const Vector3D& minimum, const Vector3D& maximum) :
+    mMinimum(minimum),
+    mMaximum(maximum) {
+}
+
+BoundingBox BoundingBox::FromPoints(const std::vector<Vector3D>& points) {
+    BoundingBox box;
+    for (const auto& point : points) {
+        box.Expand(point);
+    }
+    return box;
+}
+
+BoundingBox BoundingBox::FromDisk(const Vector3D& center, const Vector3D& normal, double radius) {
+    // The extent of a circle along axis i is radius * sin(angle between normal and axis i)
+    Vector3D n = normal.Normalized();
+    Vector3D halfExtent;
+    for (std::size_t i = 0; i < 3; i++) {
+        halfExtent[i] = radius * std::sqrt(std::max(0.0, 1.0 - n[i] * n[i]));
+    }
+    return BoundingBox(center - halfExtent, center + halfExtent);
+}
+
+const Vector3D& BoundingBox::GetMinimum() const {
+    return mMinimum;
+}
+
+const Vector3D& BoundingBox::GetMaximum() const {
+    return mMaximum;
+}
+
+Vector3D BoundingBox::GetCenter() const {
+    return 0.5 * (mMinimum + mMaximum);
+}
+
+Vector3D BoundingBox::GetExtent() const {
+    return mMaximum - mMinimum;
+}
+
+bool BoundingBox::IsEmpty() const {
+    return mMinimum[0] > mMaximum[0] || mMinimum[1] > mMaximum[1] || mMinimum[2] > mMaximum[2];
+}
+
+bool BoundingBox::Contains(const Vector3D& point) const {
+    for (std::size_t i = 0; i < 3; i++) {
+        if (point[i] < mMinimum[i] || point[i] > mMaximum[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BoundingBox::Overlaps(const BoundingBox& other) const {
+    for (std::size_t i = 0; i < 3; i++) {
+        if (other.mMaximum[i] < mMinimum[i] || other.mMinimum[i] > mMaximum[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double BoundingBox::SurfaceArea() const {
+    if (IsEmpty()) {
+        return 0.0;
+    }
+    Vector3D extent = GetExtent();
+    return 2.0 * (extent[0] * extent[1] + extent[1] * extent[2] + extent[2] * extent[0]);
+}
+
+std::size_t BoundingBox::LongestAxis() const {
+    Vector3D extent = GetExtent();
+    if (extent[0] >= extent[1] && extent[0] >= extent[2]) {
+        return 0;
+    }
+    return (extent[1] >= extent[2]) ? 1 : 2;
+}
+
+void BoundingBox::Expand(const Vector3D& point) {
+    for (std::size_t i = 0; i < 3; i++) {
+        mMinimum[i] = std::min(mMinimum[i], point[i]);
+        mMaximum[i] = std::max(mMaximum[i], point[i]);
+    }
+}
+
+void BoundingBox::Expand(const BoundingBox& other) {
+    for (std::size_t i = 0; i < 3; i++) {
+        mMinimum[i] = std::min(mMinimum[i], other.mMinimum[i]);
+        mMaximum[i] = std::max(mMaximum[i], other.mMaximum[i]);
+    }
+}
+
+std::ostream& operator<<(std::ostream& os, const BoundingBox& box) {
+    os << "[" << box.mMinimum << ", " << box.mMaximum << "]";
+    return os;
+}
+
+}  // namespace Raytracer::Geometry
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Geometry/Vector.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace Raytracer::Geometry {
+
+// Axis-aligned bounding box in world coordinates
+class BoundingBox {
+public:
+    // Default constructed boxes are empty and can be grown with Expand()
+    BoundingBox();
+    BoundingBox(const Vector3D& minimum, const Vector3D& maximum);
+
+    static BoundingBox FromPoints(const std::vector<Vector3D>& points);
+
+    // Bounds of a circle/disk with the given center, normal, and radius
+    static BoundingBox FromDisk(const Vector3D& center, const Vector3D& normal, double radius);
+
+    const Vector3D& GetMinimum() const;
+    const Vector3D& GetMaximum() const;
+
+    Vector3D GetCenter() const;
+    Vector3D GetExtent() const;
+
+    bool IsEmpty() const;
+    bool Contains(const Vector3D& point) const;
+    bool Overlaps(const BoundingBox& other) const;
+
+    double SurfaceArea() const;
+    std::size_t LongestAxis() const;
+
+    void Expand(const Vector3D& point);
+    void Expand(const BoundingBox& other);
+
+    // Slab test against a line given by its origin and the component-wise inverse of its direction.
+    // Returns true if the line overlaps the box for some parameter in [tMin, tMax].
+    bool Intersect(const Vector3D& origin, const Vector3D& inverseDirection, double tMin, double tMax) const {
+        for (std::size_t i = 0; i < 3; i++) {
+            double tNear = (mMinimum[i] - origin[i]) * inverseDirection[i];
+            double tFar = (mMaximum[i] - origin[i]) * inverseDirection[i];
+            if (tNear > tFar) {
+                std::swap(tNear, tFar);
+            }
+            // Conservative rounding, so that flat boxes (e.g. of rectangles) are not missed
+            tFar *= 1.0 + kSlabTolerance;
+            // Comparisons with NaN (origin on a slab of zero width) leave the interval unchanged
+            if (tNear > tMin) {
+                tMin = tNear;
+            }
+            if (tFar < tMax) {
+                tMax = tFar;
+            }
+            if (tMin > tMax) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const BoundingBox& box);
+
+    // Relative widening of the slab intervals in Intersect() (also used by the packet slab test).
+    // The slab distances are rounded in the precision of Real, so the widening has to follow its epsilon.
+    static constexpr double kSlabTolerance = 4.0 * std::numeric_limits<Real>::epsilon();
+
+private:
+    Vector3D mMinimum;
+    Vector3D mMaximum;
+};
+
+}  // namespace Raytracer::Geometry
@@ -1,6 +1,9 @@
 #include "Geometry/CompositeShape.hpp"
 
+#include "Geometry/PacketKernels.hpp"
+
 #include <algorithm>
+#include <limits>
 #include <iostream>
 #include <memory>
 #include <optional>
@@ -16,17 +19,67 @@ void CompositeShape::AddComponent(std::shared_ptr<Shape> component) {
     mComponents.push_back(std::move(component));
 }
 
-std::optional<Intersection> CompositeShape::Intersect(const Line& line) const {
-    std::optional<Intersection> closestIntersection;
-    for (const auto& component : mComponents) {
-        auto intersection = component->Intersect(line);
-        if (intersection) {
-            if (!closestIntersection || intersection->t < closestIntersection->t) {
-                closestIntersection = intersection;
+void CompositeShape::CloneComponents() {
+    for (auto& component : mComponents) {
+        component = component->Clone();
+    }
+}
+
+std::optional<Hit> CompositeShape::FindHit(const Line& line) const {
+    if (!line.IntersectsBoundingBox(GetBoundingBox())) {
+        return std::nullopt;
+    }
+
+    std::optional<Hit> closestHit;
+    for (std::size_t i = 0; i < mComponents.size(); i++) {
+        auto hit = mComponents[i]->FindHit(line);
+        if (hit) {
+            if (!closestHit || hit->t < closestHit->t) {
+                closestHit = hit;
+                closestHit->component = static_cast<std::uint32_t>(i);
+            }
+        }
+    }
+    return closestHit;
+}
+
+void CompositeShape::FindHits(const LinePacket& packet, PacketHits& hits) const {
+    hits.Clear();
+
+    // Conservative culling of the whole packet, the components check the lines' tMin themselves
+    LinePacket::Lanes tMax;
+    tMax.fill(std::numeric_limits<double>::infinity());
+    if (!PacketKernels::IntersectBoundingBox(packet, GetBoundingBox(), -std::numeric_limits<double>::infinity(), tMax)) {
+        return;
+    }
+
+    PacketHits componentHits;
+    for (std::size_t i = 0; i < mComponents.size(); i++) {
+        mComponents[i]->FindHits(packet, componentHits);
+        for (std::size_t lane = 0; lane < packet.size; lane++) {
+            if (componentHits.t[lane] < hits.t[lane]) {
+                hits.CopyLane(lane, componentHits);
+                hits.component[lane] = static_cast<std::uint32_t>(i);
             }
         }
     }
-    return closestIntersection;
+}
+
+Intersection CompositeShape::ComputeSurfaceInteraction(const Line& line, const Hit& hit) const {
+    return mComponents[hit.component]->ComputeSurfaceInteraction(line, hit);
+}
+
+bool CompositeShape::Occluded(const Line& line, double tMin, double tMax) const {
+    if (!line.IntersectsBoundingBox(GetBoundingBox(), tMax)) {
+        return false;
+    }
+
+    for (const auto& component : mComponents) {
+        if (component->Occluded(line, tMin, tMax)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 double CompositeShape::SurfaceArea() const {
@@ -37,28 +90,22 @@ double CompositeShape::SurfaceArea() const {
     return totalArea;
 }
 
-std::vector<Vector3D> CompositeShape::SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const {
-    std::vector<Vector3D> points;
-    // Compute probabilities based on component areas
-    std::vector<double> componentAreas;
+Vector3D CompositeShape::SampleSurfacePoint(Sampler& sampler) const {
+    // Pick a component with probability proportional to its area
+    double area = sampler.Uniform() * SurfaceArea();
     for (const auto& component : mComponents) {
-        double area = component->SurfaceArea();
-        componentAreas.push_back(area);
-    }
-    std::discrete_distribution<std::size_t> componentDist(componentAreas.begin(), componentAreas.end());
-    // Sample points
-    for (std::size_t i = 0; i < numPoints; i++) {
-        std::size_t compIndex = componentDist(prng);
-        auto compPoints = mComponents[compIndex]->SampleSurfacePoints(1, prng);
-        points.push_back(compPoints[0]);
+        area -= component->SurfaceArea();
+        if (area < 0.0) {
+            return component->SampleSurfacePoint(sampler);
+        }
     }
-    return points;
+    return mComponents.back()->SampleSurfacePoint(sampler);
 }
 
-std::vector<Vector3D> CompositeShape::GetKeyPoints() const {
+std::vector<Vector3D> CompositeShape::ComputeKeyPoints() const {
     std::vector<Vector3D> keyPoints;
     for (const auto& component : mComponents) {
-        auto compKeyPoints = component->GetKeyPoints();
+        const auto& compKeyPoints = component->GetKeyPoints();
         keyPoints.insert(keyPoints.end(), compKeyPoints.begin(), compKeyPoints.end());
     }
     // Remove duplicates
@@ -74,9 +121,16 @@ std::vector<Vector3D> CompositeShape::GetKeyPoints() const {
     return keyPoints;
 }
 
-// Rotate around a line without changing orientation
-void CompositeShape::Rotate(double angle, const Line& line) {
-    Shape::Rotate(angle, line);
+BoundingBox CompositeShape::ComputeBoundingBox() const {
+    BoundingBox box;
+    for (const auto& component : mComponents) {
+        box.Expand(component->GetBoundingBox());
+    }
+    return box;
+}
+
+void CompositeShape::SetPosition(const Vector3D& newPosition) {
+    Shape::SetPosition(newPosition);
     mComponents.clear();
     ComposeShape();
 }
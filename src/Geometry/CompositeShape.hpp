@@ -12,15 +12,16 @@ public:
 
     void AddComponent(std::shared_ptr<Shape> component);
 
-    virtual std::optional<Intersection> Intersect(const Line& line) const override;
+    virtual std::optional<Hit> FindHit(const Line& line) const override;
+    virtual Intersection ComputeSurfaceInteraction(const Line& line, const Hit& hit) const override;
+    virtual void FindHits(const LinePacket& packet, PacketHits& hits) const override;
+    virtual bool Occluded(const Line& line, double tMin, double tMax) const override;
 
     virtual double SurfaceArea() const override;
-    virtual std::vector<Vector3D> SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const override;
+    virtual Vector3D SampleSurfacePoint(Sampler& sampler) const override;
 
-    virtual std::vector<Vector3D> GetKeyPoints() const override;
-
-    // Rotate around a line without changing orientation
-    virtual void Rotate(double angle, const Line& axis = Line()) override;
+    // Moving the shape recomposes all components (also used by Rotate)
+    virtual void SetPosition(const Vector3D& newPosition) override;
 
     // Rotate around center without changing position
     virtual void Spin(double angle, Vector3D axis = Vector3D({0.0, 0.0, 0.0})) override;
@@ -28,10 +29,16 @@ public:
     virtual void PrintInfo() const override;
 
 protected:
+    virtual BoundingBox ComputeBoundingBox() const override;
+    virtual std::vector<Vector3D> ComputeKeyPoints() const override;
+
     std::vector<std::shared_ptr<Shape>> mComponents;
 
     virtual void ComposeShape() = 0;
 
+    // Replaces the components, which a copy shares with the original, by clones
+    void CloneComponents();
+
     void PrintInfoCompositeBase() const;
 };
 
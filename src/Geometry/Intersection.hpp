@@ -2,6 +2,7 @@
 
 #include "Geometry/Vector.hpp"
 
+#include <cstdint>
 #include <limits>
 
 namespace Raytracer::Geometry {
@@ -20,4 +21,14 @@ struct Intersection {
     }
 };
 
+// Result of the cheap first phase of an intersection test: where along the line the closest hit is, plus the shape specific data
+// needed to complete the hit to an Intersection later
+struct Hit {
+    double t = std::numeric_limits<double>::infinity();  // parameter/distance along line
+    std::uint32_t component = 0;                         // hit component of a composite shape
+    std::uint32_t primitive = 0;                         // shape specific, e.g. the hit triangle of a mesh
+    double u = 0.0;                                      // shape specific surface coordinates, e.g. barycentric coordinates
+    double v = 0.0;
+};
+
 }  // namespace Raytracer::Geometry
@@ -6,24 +6,14 @@ Line::Line() :
     mOrigin(Vector3D({0.0, 0.0, 0.0})),
     mDirection(Vector3D({0.0, 0.0, 1.0})),
     tMin(-std::numeric_limits<double>::infinity()) {
+    UpdateInverseDirection();
 }
 
 Line::Line(const Vector3D& origin, const Vector3D& direction, double tMin) :
     mOrigin(origin),
     mDirection(direction.Normalized()),
     tMin(tMin) {
-}
-
-Vector3D Line::GetOrigin() const {
-    return mOrigin;
-}
-
-Vector3D Line::GetDirection() const {
-    return mDirection;
-}
-
-double Line::GetTMin() const {
-    return tMin;
+    UpdateInverseDirection();
 }
 
 void Line::SetOrigin(const Vector3D& newOrigin) {
@@ -32,6 +22,7 @@ void Line::SetOrigin(const Vector3D& newOrigin) {
 
 void Line::SetDirection(const Vector3D& newDirection) {
     mDirection = newDirection.Normalized();
+    UpdateInverseDirection();
 }
 
 Vector3D Line::PointAtParameter(double t) const {
@@ -50,6 +41,13 @@ bool Line::operator==(const Line& other) const {
     return mOrigin == other.mOrigin && mDirection == other.mDirection;
 }
 
+void Line::UpdateInverseDirection() {
+    // Division by zero yields +-infinity, which the slab test handles
+    for (std::size_t i = 0; i < 3; i++) {
+        mInverseDirection[i] = 1.0 / mDirection[i];
+    }
+}
+
 // stream
 std::ostream& operator<<(std::ostream& os, const Line& line) {
     os << line.GetOrigin() << " + t * " << line.GetDirection();
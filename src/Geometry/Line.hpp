@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Geometry/BoundingBox.hpp"
 #include "Geometry/Vector.hpp"
 
 #include <limits>
@@ -12,15 +13,29 @@ public:
     Line();
     Line(const Vector3D& origin, const Vector3D& direction, double tMin = -std::numeric_limits<double>::infinity());
 
-    Vector3D GetOrigin() const;
-    Vector3D GetDirection() const;
-    double GetTMin() const;
+    Vector3D GetOrigin() const {
+        return mOrigin;
+    }
+    Vector3D GetDirection() const {
+        return mDirection;
+    }
+    const Vector3D& GetInverseDirection() const {
+        return mInverseDirection;
+    }
+    double GetTMin() const {
+        return tMin;
+    }
 
     void SetOrigin(const Vector3D& newOrigin);
     void SetDirection(const Vector3D& newDirection);
 
     Vector3D PointAtParameter(double t) const;
 
+    // Cheap slab test to reject lines before running an exact intersection test
+    bool IntersectsBoundingBox(const BoundingBox& box, double tMax = std::numeric_limits<double>::infinity()) const {
+        return box.Intersect(mOrigin, mInverseDirection, tMin, tMax);
+    }
+
     // Operators
     Vector3D operator()(double t) const;
     bool operator==(const Line& other) const;
@@ -29,7 +44,10 @@ public:
 protected:
     Vector3D mOrigin;
     Vector3D mDirection;
-    const double tMin;
+    Vector3D mInverseDirection;  // Component-wise inverse of the direction for slab tests
+    double tMin;
+
+    void UpdateInverseDirection();
 };
 
 }  // namespace Raytracer::Geometry
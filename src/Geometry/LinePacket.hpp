@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Geometry/Intersection.hpp"
+#include "Geometry/Line.hpp"
+#include "Geometry/Vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace Raytracer::Geometry {
+
+// Structure of arrays of up to kMaximumSize lines that are intersected together, e.g. coherent primary rays.
+// The packet kernels process all lanes at once with vector instructions, unused lanes are padding and their results are ignored.
+// The packet refers to the lines it was built from, which have to outlive it.
+struct LinePacket {
+    static constexpr std::size_t kMaximumSize = 16;
+    using Lanes = std::array<double, kMaximumSize>;
+
+    std::size_t size = 0;
+    alignas(64) std::array<Lanes, 3> origin{};
+    alignas(64) std::array<Lanes, 3> direction{};
+    alignas(64) std::array<Lanes, 3> inverseDirection{};
+    alignas(64) Lanes tMin{};
+    std::array<const Line*, kMaximumSize> lines{};
+
+    bool IsFull() const {
+        return size == kMaximumSize;
+    }
+
+    void Add(const Line& line) {
+        const std::size_t lane = size;
+        const Vector3D lineOrigin = line.GetOrigin();
+        const Vector3D lineDirection = line.GetDirection();
+        const Vector3D& lineInverseDirection = line.GetInverseDirection();
+        for (std::size_t i = 0; i < 3; i++) {
+            origin[i][lane] = lineOrigin[i];
+            direction[i][lane] = lineDirection[i];
+            inverseDirection[i][lane] = lineInverseDirection[i];
+        }
+        tMin[lane] = line.GetTMin();
+        lines[lane] = &line;
+        size = lane + 1;
+    }
+
+    // For the scalar fallback of shapes without a packet kernel
+    const Line& GetLine(std::size_t lane) const {
+        return *lines[lane];
+    }
+};
+
+// Closest hits of the lanes of a packet as a structure of arrays, so that the packet kernels can write them directly.
+// Lanes without a hit have t = infinity.
+struct PacketHits {
+    alignas(64) LinePacket::Lanes t;
+    alignas(64) LinePacket::Lanes u;
+    alignas(64) LinePacket::Lanes v;
+    std::array<std::uint32_t, LinePacket::kMaximumSize> component;
+    std::array<std::uint32_t, LinePacket::kMaximumSize> primitive;
+
+    // Marks all lanes as missed and resets the shape specific data
+    void Clear() {
+        t.fill(std::numeric_limits<double>::infinity());
+        u.fill(0.0);
+        v.fill(0.0);
+        component.fill(0);
+        primitive.fill(0);
+    }
+
+    bool HasHit(std::size_t lane) const {
+        return t[lane] != std::numeric_limits<double>::infinity();
+    }
+
+    Hit GetHit(std::size_t lane) const {
+        return Hit{t[lane], component[lane], primitive[lane], u[lane], v[lane]};
+    }
+
+    void SetHit(std::size_t lane, const std::optional<Hit>& hit) {
+        const Hit laneHit = hit.value_or(Hit());
+        t[lane] = laneHit.t;
+        u[lane] = laneHit.u;
+        v[lane] = laneHit.v;
+        component[lane] = laneHit.component;
+        primitive[lane] = laneHit.primitive;
+    }
+
+    void CopyLane(std::size_t lane, const PacketHits& other) {
+        t[lane] = other.t[lane];
+        u[lane] = other.u[lane];
+        v[lane] = other.v[lane];
+        component[lane] = other.component[lane];
+        primitive[lane] = other.primitive[lane];
+    }
+};
+
+}  // namespace Raytracer::Geometry
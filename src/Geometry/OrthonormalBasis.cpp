@@ -10,10 +10,10 @@ OrthonormalBasis::OrthonormalBasis() {
 
 OrthonormalBasis::OrthonormalBasis(Vector3D eZ, Vector3D eX) {
     eZ.Normalize();
-    if (eX.NormSquared() < 1e-8) {
+    if (eX.NormSquared() < 1e-8 * kToleranceScale) {
         Vector3D a = (std::fabs(eZ[0]) > 0.707) ? Vector3D{0.0, 1.0, 0.0} : Vector3D{1.0, 0.0, 0.0};
         eX = eZ.Cross(a);
-    } else if (std::abs(eX.Dot(eZ)) > 1e-8) {
+    } else if (std::abs(eX.Dot(eZ)) > 1e-8 * kToleranceScale) {
         throw std::runtime_error("Provided eX is not orthogonal to eZ");
     }
     eX.Normalize();
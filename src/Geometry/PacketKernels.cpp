@@ -0,0 +1,197 @@
+#include "Geometry/PacketKernels.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace Raytracer::Geometry::PacketKernels {
+
+namespace {
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+constexpr std::size_t kLanes = LinePacket::kMaximumSize;
+
+// Lane indices as doubles, so that masking the unused lanes is a comparison of the same width as the rest of the arithmetic
+constexpr Lanes kLaneIndices = [] {
+    Lanes indices{};
+    for (std::size_t i = 0; i < kLanes; i++) {
+        indices[i] = static_cast<double>(i);
+    }
+    return indices;
+}();
+}  // namespace
+
+RAYTRACER_SIMD_DISPATCH
+void TransformToLocal(const LinePacket& packet, const std::array<double, 9>& rotation, const Vector3D& position, std::array<Lanes, 3>& localOrigin, std::array<Lanes, 3>& localDirection) {
+    const auto& [r0, r1, r2, r3, r4, r5, r6, r7, r8] = rotation;
+    const double px = position[0], py = position[1], pz = position[2];
+    const auto& [ox, oy, oz] = packet.origin;
+    const auto& [dx, dy, dz] = packet.direction;
+#pragma omp simd
+    for (std::size_t i = 0; i < kLanes; i++) {
+        const double x = ox[i] - px, y = oy[i] - py, z = oz[i] - pz;
+        localOrigin[0][i] = r0 * x + r1 * y + r2 * z;
+        localOrigin[1][i] = r3 * x + r4 * y + r5 * z;
+        localOrigin[2][i] = r6 * x + r7 * y + r8 * z;
+        localDirection[0][i] = r0 * dx[i] + r1 * dy[i] + r2 * dz[i];
+        localDirection[1][i] = r3 * dx[i] + r4 * dy[i] + r5 * dz[i];
+        localDirection[2][i] = r6 * dx[i] + r7 * dy[i] + r8 * dz[i];
+    }
+}
+
+RAYTRACER_SIMD_DISPATCH
+bool IntersectBoundingBox(const LinePacket& packet, const BoundingBox& box, double tMin, const Lanes& tMax) {
+    // Same conservative slab test as BoundingBox::Intersect(), written with selects instead of branches and with the axes unrolled
+    const Vector3D& minimum = box.GetMinimum();
+    const Vector3D& maximum = box.GetMaximum();
+    const double minX = minimum[0], minY = minimum[1], minZ = minimum[2];
+    const double maxX = maximum[0], maxY = maximum[1], maxZ = maximum[2];
+    const double widening = 1.0 + BoundingBox::kSlabTolerance;
+    const double size = static_cast<double>(packet.size);
+    const auto& [ox, oy, oz] = packet.origin;
+    const auto& [ix, iy, iz] = packet.inverseDirection;
+
+    // Narrows [laneMin, laneMax] to the slab between the planes at lower and upper, comparisons with NaN leave it unchanged
+    auto clip = [widening](double lower, double upper, double origin, double inverseDirection, double& laneMin, double& laneMax) {
+        const double tNear = (lower - origin) * inverseDirection;
+        const double tFar = (upper - origin) * inverseDirection;
+        const bool swap = tNear > tFar;
+        const double near = swap ? tFar : tNear;
+        const double far = (swap ? tNear : tFar) * widening;
+        laneMin = near > laneMin ? near : laneMin;
+        laneMax = far < laneMax ? far : laneMax;
+    };
+
+    // The flags are doubles, so that the whole loop runs at the width of double vectors (64-bit integer masks would stop SSE2)
+    double overlaps = 0.0;
+#pragma omp simd reduction(max : overlaps)
+    for (std::size_t i = 0; i < kLanes; i++) {
+        double laneMin = tMin;
+        double laneMax = tMax[i];
+        clip(minX, maxX, ox[i], ix[i], laneMin, laneMax);
+        clip(minY, maxY, oy[i], iy[i], laneMin, laneMax);
+        clip(minZ, maxZ, oz[i], iz[i], laneMin, laneMax);
+        const double overlap = ((kLaneIndices[i] < size) & (laneMin <= laneMax)) ? 1.0 : 0.0;
+        overlaps = overlap > overlaps ? overlap : overlaps;
+    }
+    return overlaps > 0.0;
+}
+
+RAYTRACER_SIMD_DISPATCH
+void IntersectSphere(const LinePacket& packet, const Vector3D& center, double radius, Lanes& t) {
+    const double cx = center[0], cy = center[1], cz = center[2];
+    const double radius2 = radius * radius;
+    const double size = static_cast<double>(packet.size);
+    const auto& [ox, oy, oz] = packet.origin;
+    const auto& [dx, dy, dz] = packet.direction;
+
+    // Coherent packets often miss a sphere entirely, which is detected before paying for the square roots and divisions
+    Lanes discriminants;
+    double anyHit = 0.0;
+#pragma omp simd reduction(max : anyHit)
+    for (std::size_t i = 0; i < kLanes; i++) {
+        const double ocx = ox[i] - cx, ocy = oy[i] - cy, ocz = oz[i] - cz;
+        const double a = dx[i] * dx[i] + dy[i] * dy[i] + dz[i] * dz[i];
+        const double b = 2.0 * (ocx * dx[i] + ocy * dy[i] + ocz * dz[i]);
+        const double c = (ocx * ocx + ocy * ocy + ocz * ocz) - radius2;
+        discriminants[i] = b * b - 4.0 * a * c;
+        const double hit = ((kLaneIndices[i] < size) & (discriminants[i] >= 0.0)) ? 1.0 : 0.0;
+        anyHit = hit > anyHit ? hit : anyHit;
+    }
+    if (anyHit == 0.0) {
+        t.fill(kInfinity);
+        return;
+    }
+
+#pragma omp simd
+    for (std::size_t i = 0; i < kLanes; i++) {
+        const double ocx = ox[i] - cx, ocy = oy[i] - cy, ocz = oz[i] - cz;
+        const double a = dx[i] * dx[i] + dy[i] * dy[i] + dz[i] * dz[i];
+        const double b = 2.0 * (ocx * dx[i] + ocy * dy[i] + ocz * dz[i]);
+        const double discriminant = discriminants[i];
+        const double sqrtD = std::sqrt(discriminant < 0.0 ? 0.0 : discriminant);
+        const double root1 = (-b - sqrtD) / (2.0 * a);
+        const double root2 = (-b + sqrtD) / (2.0 * a);
+        double closest = root1 >= packet.tMin[i] ? root1 : kInfinity;
+        closest = ((root2 >= packet.tMin[i]) & (root2 < closest)) ? root2 : closest;
+        t[i] = discriminant < 0.0 ? kInfinity : closest;
+    }
+}
+
+RAYTRACER_SIMD_DISPATCH
+void IntersectRectangle(const LinePacket& packet, const Vector3D& center, const Vector3D& normal, const Vector3D& eX, const Vector3D& eY, double width, double height, double parallelTolerance, Lanes& t) {
+    const double px = center[0], py = center[1], pz = center[2];
+    const double nx = normal[0], ny = normal[1], nz = normal[2];
+    const double ux = eX[0], uy = eX[1], uz = eX[2];
+    const double vx = eY[0], vy = eY[1], vz = eY[2];
+    const auto& [ox, oy, oz] = packet.origin;
+    const auto& [dx, dy, dz] = packet.direction;
+#pragma omp simd
+    for (std::size_t i = 0; i < kLanes; i++) {
+        const double denominator = nx * dx[i] + ny * dy[i] + nz * dz[i];
+        const double tPlane = ((px - ox[i]) * nx + (py - oy[i]) * ny + (pz - oz[i]) * nz) / denominator;
+        const double lx = (ox[i] + tPlane * dx[i]) - px;
+        const double ly = (oy[i] + tPlane * dy[i]) - py;
+        const double lz = (oz[i] + tPlane * dz[i]) - pz;
+        const double u = (lx * ux + ly * uy + lz * uz) / width;
+        const double v = (lx * vx + ly * vy + lz * vz) / height;
+        const bool hit = (std::fabs(denominator) >= parallelTolerance) & (tPlane >= packet.tMin[i]) & (std::fabs(u) <= 0.5) & (std::fabs(v) <= 0.5);
+        t[i] = hit ? tPlane : kInfinity;
+    }
+}
+
+RAYTRACER_SIMD_DISPATCH
+void IntersectRing(const LinePacket& packet, const Vector3D& center, const Vector3D& normal, double innerRadius, double outerRadius, double parallelTolerance, Lanes& t) {
+    const double px = center[0], py = center[1], pz = center[2];
+    const double nx = normal[0], ny = normal[1], nz = normal[2];
+    const auto& [ox, oy, oz] = packet.origin;
+    const auto& [dx, dy, dz] = packet.direction;
+#pragma omp simd
+    for (std::size_t i = 0; i < kLanes; i++) {
+        const double denominator = nx * dx[i] + ny * dy[i] + nz * dz[i];
+        const double tPlane = ((px - ox[i]) * nx + (py - oy[i]) * ny + (pz - oz[i]) * nz) / denominator;
+        const double lx = (ox[i] + tPlane * dx[i]) - px;
+        const double ly = (oy[i] + tPlane * dy[i]) - py;
+        const double lz = (oz[i] + tPlane * dz[i]) - pz;
+        const double distance = std::sqrt(lx * lx + ly * ly + lz * lz);
+        const bool hit = (std::fabs(denominator) >= parallelTolerance) & (tPlane >= packet.tMin[i]) & (distance <= outerRadius) & (distance >= innerRadius);
+        t[i] = hit ? tPlane : kInfinity;
+    }
+}
+
+RAYTRACER_SIMD_DISPATCH
+void IntersectTriangle(const LinePacket& packet, const std::array<Lanes, 3>& localOrigin, const std::array<Lanes, 3>& localDirection, const Vector3D& vertex, const std::array<Vector3D, 2>& edges, double tolerance, Lanes& t, Lanes& u, Lanes& v) {
+    const double e0x = edges[0][0], e0y = edges[0][1], e0z = edges[0][2];
+    const double e1x = edges[1][0], e1y = edges[1][1], e1z = edges[1][2];
+    const double v0x = vertex[0], v0y = vertex[1], v0z = vertex[2];
+    const auto& [ox, oy, oz] = localOrigin;
+    const auto& [dx, dy, dz] = localDirection;
+#pragma omp simd
+    for (std::size_t i = 0; i < kLanes; i++) {
+        // h = direction x e1
+        const double hx = dy[i] * e1z - dz[i] * e1y;
+        const double hy = dz[i] * e1x - dx[i] * e1z;
+        const double hz = dx[i] * e1y - dy[i] * e1x;
+        const double determinant = e0x * hx + e0y * hy + e0z * hz;
+        const double inverseDeterminant = 1.0 / determinant;
+
+        const double sx = ox[i] - v0x, sy = oy[i] - v0y, sz = oz[i] - v0z;
+        const double uLane = inverseDeterminant * (sx * hx + sy * hy + sz * hz);
+
+        // q = s x e0
+        const double qx = sy * e0z - sz * e0y;
+        const double qy = sz * e0x - sx * e0z;
+        const double qz = sx * e0y - sy * e0x;
+        const double vLane = inverseDeterminant * (dx[i] * qx + dy[i] * qy + dz[i] * qz);
+        const double tLane = inverseDeterminant * (e1x * qx + e1y * qy + e1z * qz);
+
+        // Bitwise operators instead of short-circuit evaluation keep the loop free of branches
+        const bool outsideU = ((uLane < 0.0) & (std::fabs(uLane) > tolerance)) | ((uLane > 1.0) & (std::fabs(uLane - 1.0) > tolerance));
+        const bool outsideV = ((vLane < 0.0) & (std::fabs(vLane) > tolerance)) | ((uLane + vLane > 1.0) & (std::fabs(uLane + vLane - 1.0) > tolerance));
+        const bool hit = (std::fabs(determinant) >= tolerance) & !outsideU & !outsideV & (tLane > packet.tMin[i]);
+        t[i] = hit ? tLane : kInfinity;
+        u[i] = uLane;
+        v[i] = vLane;
+    }
+}
+
+}  // namespace Raytracer::Geometry::PacketKernels
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Geometry/BoundingBox.hpp"
+#include "Geometry/LinePacket.hpp"
+#include "Geometry/Vector.hpp"
+
+#include <array>
+
+// The packet kernels are compiled for several instruction sets (SSE2, AVX2, AVX-512) and the best version for the CPU is selected
+// when the program is loaded. Other platforms get a single version for the instruction set the compiler targets.
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define RAYTRACER_SIMD_DISPATCH __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define RAYTRACER_SIMD_DISPATCH
+#endif
+
+// The intersection kernels write the line parameter of the closest hit at or above the line's tMin for all lanes of the packet, or
+// infinity if the line misses. The formulas are the same as in the scalar FindHit() of the corresponding shape.
+namespace Raytracer::Geometry::PacketKernels {
+
+using Lanes = LinePacket::Lanes;
+
+// Rotation (row-major) of the translated origins and of the directions into a local frame
+void TransformToLocal(const LinePacket& packet, const std::array<double, 9>& rotation, const Vector3D& position, std::array<Lanes, 3>& localOrigin, std::array<Lanes, 3>& localDirection);
+
+// Slab test of all lanes against a box for parameters in [tMin, tMax[lane]], true if any lane overlaps the box
+bool IntersectBoundingBox(const LinePacket& packet, const BoundingBox& box, double tMin, const Lanes& tMax);
+
+void IntersectSphere(const LinePacket& packet, const Vector3D& center, double radius, Lanes& t);
+
+// Rectangle and ring (disk) in the plane through center with the given normal, reject lines that are parallel to the plane
+void IntersectRectangle(const LinePacket& packet, const Vector3D& center, const Vector3D& normal, const Vector3D& eX, const Vector3D& eY, double width, double height, double parallelTolerance, Lanes& t);
+void IntersectRing(const LinePacket& packet, const Vector3D& center, const Vector3D& normal, double innerRadius, double outerRadius, double parallelTolerance, Lanes& t);
+
+// Möller–Trumbore in the local coordinates of the triangle, also writes the barycentric coordinates of the hits
+void IntersectTriangle(const LinePacket& packet, const std::array<Lanes, 3>& localOrigin, const std::array<Lanes, 3>& localDirection, const Vector3D& vertex, const std::array<Vector3D, 2>& edges, double tolerance, Lanes& t, Lanes& u, Lanes& v);
+
+}  // namespace Raytracer::Geometry::PacketKernels
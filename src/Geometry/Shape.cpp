@@ -5,7 +5,12 @@ namespace Raytracer::Geometry {
 Shape::Shape(Type type, const Vector3D& position, const Vector3D& orientation, const Vector3D& referenceDirection) :
     mType(type),
     mPosition(position),
-    mOrthonormalBasis(orientation, referenceDirection) {
+    mOrthonormalBasis(orientation, referenceDirection),
+    mTransform(mOrthonormalBasis, mPosition) {
+}
+
+Shape::Type Shape::GetType() const {
+    return mType;
 }
 
 Vector3D Shape::GetBasisVector(OrthonormalBasis::BasisVector axis) const {
@@ -16,12 +21,72 @@ Vector3D Shape::GetOrientation() const {
     return GetBasisVector(OrthonormalBasis::BasisVector::eZ);
 }
 
+const AffineTransform& Shape::GetTransform() const {
+    return mTransform;
+}
+
 Vector3D Shape::GetPosition() const {
     return mPosition;
 }
 
 void Shape::SetPosition(const Vector3D& newPosition) {
     mPosition = newPosition;
+    mTransform = AffineTransform(mOrthonormalBasis, mPosition);
+    InvalidateCaches();
+}
+
+void Shape::SetOrthonormalBasis(const OrthonormalBasis& basis) {
+    mOrthonormalBasis = basis;
+    mTransform = AffineTransform(mOrthonormalBasis, mPosition);
+    InvalidateCaches();
+}
+
+std::optional<Intersection> Shape::Intersect(const Line& line) const {
+    if (auto hit = FindHit(line)) {
+        return ComputeSurfaceInteraction(line, *hit);
+    }
+    return std::nullopt;
+}
+
+void Shape::FindHits(const LinePacket& packet, PacketHits& hits) const {
+    hits.Clear();
+    for (std::size_t i = 0; i < packet.size; i++) {
+        hits.SetHit(i, FindHit(packet.GetLine(i)));
+    }
+}
+
+bool Shape::Occluded(const Line& line, double tMin, double tMax) const {
+    if (!line.IntersectsBoundingBox(GetBoundingBox(), tMax)) {
+        return false;
+    }
+    auto hit = FindHit(line);
+    return hit.has_value() && hit->t > tMin && hit->t < tMax;
+}
+
+BoundingBox Shape::GetBoundingBox() const {
+    return mBoundingBoxCache.Get([this]() {
+        return ComputeBoundingBox();
+    });
+}
+
+std::vector<Vector3D> Shape::SampleSurfacePoints(std::size_t numPoints, Sampler& sampler) const {
+    std::vector<Vector3D> points;
+    points.reserve(numPoints);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        points.push_back(SampleSurfacePoint(sampler));
+    }
+    return points;
+}
+
+const std::vector<Vector3D>& Shape::GetKeyPoints() const {
+    return mKeyPointsCache.Get([this]() {
+        return ComputeKeyPoints();
+    });
+}
+
+void Shape::InvalidateCaches() {
+    mBoundingBoxCache.Invalidate();
+    mKeyPointsCache.Invalidate();
 }
 
 std::pair<double, double> Shape::GetSurfaceParameters(const Vector3D& point) const {
@@ -45,6 +110,8 @@ void Shape::Rotate(double angle, const Line& axis) {
 
 void Shape::Spin(double angle, Vector3D axis) {
     mOrthonormalBasis.Rotate(angle, axis);
+    mTransform = AffineTransform(mOrthonormalBasis, mPosition);
+    InvalidateCaches();
 }
 
 void Shape::PrintInfo() const {
@@ -71,6 +138,8 @@ std::string Shape::TypeToString(Type type) {
             return "Half Torus";
         case Type::HALF_TORUS_WITH_SPHERICAL_CAPS:
             return "Half Torus with Spherical Caps";
+        case Type::MESH:
+            return "Mesh";
         case Type::OCTAHEDRON:
             return "Octahedron";
         case Type::PLANE:
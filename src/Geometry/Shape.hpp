@@ -1,13 +1,20 @@
 #pragma once
 
+#include "Geometry/AffineTransform.hpp"
+#include "Geometry/BoundingBox.hpp"
 #include "Geometry/Intersection.hpp"
 #include "Geometry/Line.hpp"
+#include "Geometry/LinePacket.hpp"
 #include "Geometry/OrthonormalBasis.hpp"
 #include "Geometry/Vector.hpp"
+#include "Utilities/Sampler.hpp"
 
+#include <atomic>
+#include <memory>
 #include <optional>
 #include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -24,6 +31,7 @@ public:
         DISK,
         HALF_TORUS,
         HALF_TORUS_WITH_SPHERICAL_CAPS,
+        MESH,
         OCTAHEDRON,
         PLANE,
         RECTANGLE,
@@ -41,19 +49,43 @@ public:
     Shape(Type type, const Vector3D& position, const Vector3D& orientation, const Vector3D& referenceDirection = Vector3D({0.0, 0.0, 0.0}));
     virtual ~Shape() = default;
 
-    virtual std::optional<Intersection> Intersect(const Line& line) const = 0;
+    // Intersection tests run in two phases: FindHit() only determines where along the line the closest hit is, and
+    // ComputeSurfaceInteraction() completes that hit with the point and normal. Callers that test several shapes, like
+    // composite shapes or the scene, only complete the closest hit.
+    virtual std::optional<Hit> FindHit(const Line& line) const = 0;
+    virtual Intersection ComputeSurfaceInteraction(const Line& line, const Hit& hit) const = 0;
+
+    // Both phases at once
+    std::optional<Intersection> Intersect(const Line& line) const;
+
+    // FindHit() for all lines of a packet. Shapes with a SIMD packet kernel override it, the others test the lines one by one.
+    virtual void FindHits(const LinePacket& packet, PacketHits& hits) const;
+
+    // Any-hit query for shadow rays: true if the line hits the shape for some tMin < t < tMax.
+    // Unlike Intersect(), no intersection point or normal is computed.
+    virtual bool Occluded(const Line& line, double tMin, double tMax) const;
 
     Type GetType() const;
     Vector3D GetBasisVector(OrthonormalBasis::BasisVector axis) const;
     Vector3D GetOrientation() const;
 
+    // World to local transform, kept in sync with position and orientation
+    const AffineTransform& GetTransform() const;
+
     Vector3D GetPosition() const;
-    void SetPosition(const Vector3D& newPosition);
+    virtual void SetPosition(const Vector3D& newPosition);
 
     virtual double SurfaceArea() const = 0;
 
-    virtual std::vector<Vector3D> SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const = 0;
-    virtual std::vector<Vector3D> GetKeyPoints() const = 0;
+    // Uniformly distributed point on the surface
+    virtual Vector3D SampleSurfacePoint(Sampler& sampler) const = 0;
+    std::vector<Vector3D> SampleSurfacePoints(std::size_t numPoints, Sampler& sampler) const;
+
+    // Representative surface points, e.g. for deterministic light sampling (cached until the shape is moved)
+    const std::vector<Vector3D>& GetKeyPoints() const;
+
+    // Tight axis-aligned bounds in world coordinates (cached until the shape is moved)
+    BoundingBox GetBoundingBox() const;
 
     // Parametrize the surface in range [-0.5, 0.5]
     virtual std::pair<double, double> GetSurfaceParameters(const Vector3D& point) const;
@@ -64,18 +96,81 @@ public:
     // Rotate around center without changing position
     virtual void Spin(double angle, Vector3D axis = Vector3D({0.0, 0.0, 0.0}));
 
+    // Independent copy, e.g. to move the copy without affecting the original
+    virtual std::shared_ptr<Shape> Clone() const = 0;
+
     virtual void PrintInfo() const;
 
+    static std::string TypeToString(Type type);
+
 protected:
     Type mType;
     Vector3D mPosition;
     OrthonormalBasis mOrthonormalBasis;
+    AffineTransform mTransform;
 
-    static constexpr double sEpsilon = 1e-6;
+    static constexpr double sEpsilon = 1e-6 * kToleranceScale;
 
-    static std::string TypeToString(Type type);
+    void SetOrthonormalBasis(const OrthonormalBasis& basis);
+
+    virtual BoundingBox ComputeBoundingBox() const = 0;
+    virtual std::vector<Vector3D> ComputeKeyPoints() const = 0;
+    void InvalidateCaches();
 
     void PrintInfoBase() const;
+
+private:
+    // Lazily computed geometry that can be queried concurrently by render threads
+    template <typename T>
+    class GeometryCache {
+    public:
+        GeometryCache() = default;
+        // Copies start out invalid and recompute the value for the new owner
+        GeometryCache(const GeometryCache&) {}
+        GeometryCache& operator=(const GeometryCache&) {
+            Invalidate();
+            return *this;
+        }
+
+        // The first thread to arrive computes the value, the others wait for it.
+        // If the computation throws, the cache becomes invalid again, so that the waiting threads do not wait forever.
+        template <typename Compute>
+        const T& Get(Compute&& compute) const {
+            State state = mState.load(std::memory_order_acquire);
+            while (state != State::VALID) {
+                State expected = State::INVALID;
+                if (mState.compare_exchange_strong(expected, State::WRITING, std::memory_order_acq_rel)) {
+                    try {
+                        mValue = compute();
+                    } catch (...) {
+                        mState.store(State::INVALID, std::memory_order_release);
+                        throw;
+                    }
+                    mState.store(State::VALID, std::memory_order_release);
+                    break;
+                }
+                std::this_thread::yield();
+                state = mState.load(std::memory_order_acquire);
+            }
+            return mValue;
+        }
+
+        void Invalidate() {
+            mState.store(State::INVALID, std::memory_order_release);
+        }
+
+    private:
+        enum class State {
+            INVALID,
+            WRITING,
+            VALID
+        };
+        mutable std::atomic<State> mState{State::INVALID};
+        mutable T mValue;
+    };
+
+    GeometryCache<BoundingBox> mBoundingBoxCache;
+    GeometryCache<std::vector<Vector3D>> mKeyPointsCache;
 };
 
 }  // namespace Raytracer::Geometry
@@ -8,6 +8,7 @@
 #include "Geometry/Shapes/Disk.hpp"
 #include "Geometry/Shapes/HalfTorus.hpp"
 #include "Geometry/Shapes/HalfTorusWithSphericalCaps.hpp"
+#include "Geometry/Shapes/Mesh.hpp"
 #include "Geometry/Shapes/Octahedron.hpp"
 #include "Geometry/Shapes/Rectangle.hpp"
 #include "Geometry/Shapes/Ring.hpp"
@@ -2,6 +2,11 @@
 
 #include "Geometry/Shapes/Rectangle.hpp"
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+
 namespace Raytracer::Geometry {
 
 Box::Box(const Vector3D& center, const Vector3D& heightDirection, const Vector3D& widthDirection, double length, double width, double height) :
@@ -12,6 +17,65 @@ Box::Box(const Vector3D& center, const Vector3D& heightDirection, const Vector3D
     ComposeShape();
 }
 
+std::optional<Hit> Box::FindHit(const Line& line) const {
+    SlabInterval interval = ComputeSlabInterval(line);
+    if (interval.tEnter > interval.tExit) {
+        return std::nullopt;
+    } else if (interval.tEnter >= line.GetTMin()) {
+        return Hit{interval.tEnter, interval.enterFace};
+    } else if (interval.tExit >= line.GetTMin()) {
+        return Hit{interval.tExit, interval.exitFace};
+    }
+    return std::nullopt;
+}
+
+void Box::FindHits(const LinePacket& packet, PacketHits& hits) const {
+    // The scalar slab test is cheaper than testing the six faces as a packet
+    Shape::FindHits(packet, hits);
+}
+
+bool Box::Occluded(const Line& line, double tMin, double tMax) const {
+    // The surface is crossed twice, so both the entry and the exit point can occlude
+    SlabInterval interval = ComputeSlabInterval(line);
+    if (interval.tEnter > interval.tExit) {
+        return false;
+    }
+    tMin = std::max(tMin, line.GetTMin());
+    return (interval.tEnter > tMin && interval.tEnter < tMax) || (interval.tExit > tMin && interval.tExit < tMax);
+}
+
+Box::SlabInterval Box::ComputeSlabInterval(const Line& line) const {
+    // Axis-aligned boxes only translate the line, the transform skips the rotation
+    const Vector3D origin = mTransform.ToLocalPoint(line.GetOrigin());
+    const Vector3D direction = mTransform.ToLocalDirection(line.GetDirection());
+    const std::array<double, 3> halfExtents = {0.5 * mLength, 0.5 * mWidth, 0.5 * mHeight};
+
+    // Components of the faces on the negative and positive side of each axis, see ComposeShape()
+    constexpr std::array<std::array<std::uint32_t, 2>, 3> kFaces = {{{2, 3}, {5, 4}, {1, 0}}};
+
+    SlabInterval interval;
+    for (std::size_t axis = 0; axis < 3; axis++) {
+        const double inverseDirection = 1.0 / direction[axis];
+        double tNear = (-halfExtents[axis] - origin[axis]) * inverseDirection;
+        double tFar = (halfExtents[axis] - origin[axis]) * inverseDirection;
+        std::uint32_t nearFace = kFaces[axis][0];
+        std::uint32_t farFace = kFaces[axis][1];
+        if (tNear > tFar) {
+            std::swap(tNear, tFar);
+            std::swap(nearFace, farFace);
+        }
+        if (tNear > interval.tEnter) {
+            interval.tEnter = tNear;
+            interval.enterFace = nearFace;
+        }
+        if (tFar < interval.tExit) {
+            interval.tExit = tFar;
+            interval.exitFace = farFace;
+        }
+    }
+    return interval;
+}
+
 void Box::ComposeShape() {
     mComponents.clear();
     // Create 6 rectangles for the box faces
@@ -61,6 +125,12 @@ void Box::ComposeShape() {
                                              mHeight));
 }
 
+std::shared_ptr<Shape> Box::Clone() const {
+    auto clone = std::make_shared<Box>(*this);
+    clone->CloneComponents();
+    return clone;
+}
+
 void Box::PrintInfo() const {
     PrintInfoCompositeBase();
     std::cout << "\tLength: " << mLength << std::endl
@@ -3,17 +3,36 @@
 #include "Geometry/CompositeShape.hpp"
 #include "Geometry/Vector.hpp"
 
+#include <cstdint>
+#include <limits>
+
 namespace Raytracer::Geometry {
 
 class Box : public CompositeShape {
 public:
     Box(const Vector3D& center, const Vector3D& heightDirection, const Vector3D& widthDirection, double length, double width, double height);
 
+    // A single slab test in the box frame instead of testing all six faces
+    virtual std::optional<Hit> FindHit(const Line& line) const override;
+    virtual void FindHits(const LinePacket& packet, PacketHits& hits) const override;
+    virtual bool Occluded(const Line& line, double tMin, double tMax) const override;
+
+    virtual std::shared_ptr<Shape> Clone() const override;
+
     virtual void PrintInfo() const override;
 
 private:
     double mLength, mWidth, mHeight;
 
+    // Parameters where the line enters and exits the box, together with the components of the crossed faces
+    struct SlabInterval {
+        double tEnter = -std::numeric_limits<double>::infinity();
+        double tExit = std::numeric_limits<double>::infinity();
+        std::uint32_t enterFace = 0;
+        std::uint32_t exitFace = 0;
+    };
+    SlabInterval ComputeSlabInterval(const Line& line) const;
+
     virtual void ComposeShape() override;
 };
 
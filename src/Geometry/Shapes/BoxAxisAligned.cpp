@@ -9,4 +9,10 @@ BoxAxisAligned::BoxAxisAligned(const Vector3D& center, double length, double wid
     mType = Type::BOX_AXIS_ALIGNED;
 }
 
+std::shared_ptr<Shape> BoxAxisAligned::Clone() const {
+    auto clone = std::make_shared<BoxAxisAligned>(*this);
+    clone->CloneComponents();
+    return clone;
+}
+
 }  // namespace Raytracer::Geometry
@@ -9,6 +9,8 @@ class BoxAxisAligned : public Box {
 public:
     BoxAxisAligned(const Vector3D& center, double length, double width, double height);
 
+    virtual std::shared_ptr<Shape> Clone() const override;
+
 private:
     // Rotation method deleted to enforce axis-alignment
     void Spin(double angle, OrthonormalBasis::BasisVector axis) = delete;
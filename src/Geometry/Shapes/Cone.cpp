@@ -1,5 +1,7 @@
 #include "Geometry/Shapes/Cone.hpp"
 
+#include "Utilities/Math.hpp"
+
 namespace Raytracer::Geometry {
 
 Cone::Cone(const Vector3D& position, const Vector3D& orientation, double radius, double height) :
@@ -9,7 +11,7 @@ Cone::Cone(const Vector3D& position, const Vector3D& orientation, double radius,
     mSlantHeight = std::sqrt(mHeight * mHeight + mRadius * mRadius);
 }
 
-std::optional<Intersection> Cone::Intersect(const Line& line) const {
+std::optional<Hit> Cone::FindHit(const Line& line) const {
     // Line
     Vector3D origin = line.GetOrigin();
     Vector3D direction = line.GetDirection();
@@ -28,80 +30,93 @@ std::optional<Intersection> Cone::Intersect(const Line& line) const {
 
     double discriminant = b * b - 4.0 * a * c;
 
-    std::vector<double> roots;
+    Math::Roots<2> roots;
     if (discriminant < 0.0) {
         return std::nullopt;  // No intersection
     } else if (std::abs(discriminant) < sEpsilon) {
         double root = -b / (2.0 * a);
-        roots.push_back(root);
+        roots.Add(root);
     } else {
         double sqrtDiscriminant = std::sqrt(discriminant);
         double root1 = (-b - sqrtDiscriminant) / (2.0 * a);
         double root2 = (-b + sqrtDiscriminant) / (2.0 * a);
-        roots.push_back(root1);
-        roots.push_back(root2);
+        roots.Add(root1);
+        roots.Add(root2);
     }
 
-    std::vector<Intersection> intersections;
+    std::optional<Hit> closestHit;
     for (double root : roots) {
         if (root < line.GetTMin()) {
             continue;  // Ignore intersections behind the ray origin
         }
-        Vector3D intersectionPoint = line.PointAtParameter(root);
-        Vector3D v = intersectionPoint - coneApex;
-        double heightAlongAxis = v.Dot(coneNormal);
+        double heightAlongAxis = (line.PointAtParameter(root) - coneApex).Dot(coneNormal);
         if (heightAlongAxis <= 0.0 && heightAlongAxis >= -mHeight) {
-            Vector3D axialComponent = coneNormal * heightAlongAxis;
-            Vector3D radialComponent = v - axialComponent;
-            double tanTheta = mRadius / mHeight;
-            Vector3D normal = (radialComponent - tanTheta * tanTheta * axialComponent).Normalized();
-            intersections.push_back(Intersection{root, intersectionPoint, normal});
+            if (!closestHit || root < closestHit->t) {
+                closestHit = Hit{root};
+            }
         }
     }
-    if (intersections.empty()) {
-        return std::nullopt;
-    }
-    return *std::min_element(intersections.begin(), intersections.end());
+    return closestHit;
+}
+
+Intersection Cone::ComputeSurfaceInteraction(const Line& line, const Hit& hit) const {
+    Vector3D coneNormal = GetBasisVector(OrthonormalBasis::BasisVector::eZ);
+    Vector3D coneApex = mPosition + mHeight * coneNormal;
+
+    Vector3D intersectionPoint = line.PointAtParameter(hit.t);
+    Vector3D v = intersectionPoint - coneApex;
+    double heightAlongAxis = v.Dot(coneNormal);
+    Vector3D axialComponent = coneNormal * heightAlongAxis;
+    Vector3D radialComponent = v - axialComponent;
+    double tanTheta = mRadius / mHeight;
+    Vector3D normal = (radialComponent - tanTheta * tanTheta * axialComponent).NormalizedUnchecked();
+    return Intersection{hit.t, intersectionPoint, normal};
 }
 
 double Cone::SurfaceArea() const {
     return M_PI * mRadius * std::sqrt(mHeight * mHeight + mRadius * mRadius);
 }
 
-std::vector<Vector3D> Cone::SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const {
-    std::vector<Vector3D> points;
-
+Vector3D Cone::SampleSurfacePoint(Sampler& sampler) const {
     std::uniform_real_distribution<double> dist(0.0, 1.0);
 
-    for (std::size_t i = 0; i < numPoints; ++i) {
-        double u = dist(prng);
-        double v = dist(prng);
+    double u = dist(sampler);
+    double v = dist(sampler);
 
-        double rho = std::sqrt(u) * mSlantHeight;
-        double theta = 2.0 * M_PI * v;
+    double rho = std::sqrt(u) * mSlantHeight;
+    double theta = 2.0 * M_PI * v;
 
-        double cosTheta = mHeight / mSlantHeight;
-        double sinTheta = mRadius / mSlantHeight;
-
-        double radialDistance = (rho * sinTheta);
-        double x = radialDistance * std::cos(theta);
-        double y = radialDistance * std::sin(theta);
-        double z = mHeight - (rho * cosTheta);
-        Vector3D localPoint{x, y, z};
-        Vector3D globalPoint = mOrthonormalBasis.ToGlobal(localPoint) + mPosition;
-        points.push_back(globalPoint);
-    }
-    return points;
+    double cosTheta = mHeight / mSlantHeight;
+    double sinTheta = mRadius / mSlantHeight;
+
+    double radialDistance = (rho * sinTheta);
+    Real x = radialDistance * std::cos(theta);
+    Real y = radialDistance * std::sin(theta);
+    Real z = mHeight - (rho * cosTheta);
+    Vector3D localPoint{x, y, z};
+    Vector3D globalPoint = mTransform.ToGlobalPoint(localPoint);
+    return globalPoint;
 }
 
-std::vector<Vector3D> Cone::GetKeyPoints() const {
+std::vector<Vector3D> Cone::ComputeKeyPoints() const {
     return {mPosition};
 }
 
+BoundingBox Cone::ComputeBoundingBox() const {
+    // Base disk and apex
+    BoundingBox box = BoundingBox::FromDisk(mPosition, GetOrientation(), mRadius);
+    box.Expand(mPosition + mHeight * GetOrientation());
+    return box;
+}
+
 std::pair<double, double> Cone::GetSurfaceParameters(const Vector3D& point) const {
     return {0.0, 0.0};
 }
 
+std::shared_ptr<Shape> Cone::Clone() const {
+    return std::make_shared<Cone>(*this);
+}
+
 void Cone::PrintInfo() const {
     PrintInfoBase();
     std::cout << "\tRadius: " << mRadius << std::endl
@@ -15,16 +15,22 @@ class Cone : public Shape {
 public:
     Cone(const Vector3D& position, const Vector3D& orientation, double radius, double height);
 
-    virtual std::optional<Intersection> Intersect(const Line& line) const override;
+    virtual std::optional<Hit> FindHit(const Line& line) const override;
+    virtual Intersection ComputeSurfaceInteraction(const Line& line, const Hit& hit) const override;
 
     virtual double SurfaceArea() const override;
-    virtual std::vector<Vector3D> SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const override;
+    virtual Vector3D SampleSurfacePoint(Sampler& sampler) const override;
 
-    virtual std::vector<Vector3D> GetKeyPoints() const override;
     virtual std::pair<double, double> GetSurfaceParameters(const Vector3D& point) const override;
 
+    virtual std::shared_ptr<Shape> Clone() const override;
+
     virtual void PrintInfo() const override;
 
+protected:
+    virtual BoundingBox ComputeBoundingBox() const override;
+    virtual std::vector<Vector3D> ComputeKeyPoints() const override;
+
 private:
     double mRadius;
     double mHeight;
@@ -15,6 +15,12 @@ Cylinder::Cylinder(const Vector3D& position, const Vector3D& orientation, double
     ComposeShape();
 }
 
+std::shared_ptr<Shape> Cylinder::Clone() const {
+    auto clone = std::make_shared<Cylinder>(*this);
+    clone->CloneComponents();
+    return clone;
+}
+
 void Cylinder::PrintInfo() const {
     PrintInfoCompositeBase();
     std::cout << "\tRadius: " << mRadius << std::endl
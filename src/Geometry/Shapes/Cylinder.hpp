@@ -8,6 +8,8 @@ class Cylinder : public CompositeShape {
 public:
     Cylinder(const Vector3D& position, const Vector3D& orientation, double radius, double height);
 
+    virtual std::shared_ptr<Shape> Clone() const override;
+
     virtual void PrintInfo() const override;
 
 private:
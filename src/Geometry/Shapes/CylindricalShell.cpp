@@ -16,6 +16,12 @@ CylindricalShell::CylindricalShell(const Vector3D& position, const Vector3D& ori
     ComposeShape();
 }
 
+std::shared_ptr<Shape> CylindricalShell::Clone() const {
+    auto clone = std::make_shared<CylindricalShell>(*this);
+    clone->CloneComponents();
+    return clone;
+}
+
 void CylindricalShell::PrintInfo() const {
     PrintInfoCompositeBase();
     std::cout << "\tInner Radius: " << mInnerRadius << std::endl
@@ -8,6 +8,8 @@ class CylindricalShell : public CompositeShape {
 public:
     CylindricalShell(const Vector3D& position, const Vector3D& orientation, double innerRadius, double outerRadius, double height);
 
+    virtual std::shared_ptr<Shape> Clone() const override;
+
     virtual void PrintInfo() const override;
 
 private:
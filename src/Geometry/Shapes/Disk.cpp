@@ -7,10 +7,14 @@ Disk::Disk(const Vector3D& position, const Vector3D& normal, double radius) :
     mType = Type::DISK;
 }
 
-std::vector<Vector3D> Disk::GetKeyPoints() const {
+std::vector<Vector3D> Disk::ComputeKeyPoints() const {
     return {mPosition};
 }
 
+std::shared_ptr<Shape> Disk::Clone() const {
+    return std::make_shared<Disk>(*this);
+}
+
 void Disk::PrintInfo() const {
     PrintInfoBase();
     std::cout << "\tRadius:\t" << mOuterRadius << std::endl
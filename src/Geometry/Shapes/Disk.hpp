@@ -14,11 +14,12 @@ class Disk : public Ring {
 public:
     Disk(const Vector3D& position, const Vector3D& normal, double radius);
 
-    virtual std::vector<Vector3D> GetKeyPoints() const override;
+    virtual std::shared_ptr<Shape> Clone() const override;
 
     virtual void PrintInfo() const override;
 
-private:
+protected:
+    virtual std::vector<Vector3D> ComputeKeyPoints() const override;
 };
 
 }  // namespace Raytracer::Geometry
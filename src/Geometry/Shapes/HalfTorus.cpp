@@ -7,68 +7,46 @@ namespace Raytracer::Geometry {
 HalfTorus::HalfTorus(const Vector3D& position, const Vector3D& orientation, const Vector3D& referenceDirection, double majorRadius, double minorRadius) :
     Torus(position, orientation, majorRadius, minorRadius) {
     mType = Type::HALF_TORUS;
-    mOrthonormalBasis = OrthonormalBasis(orientation, referenceDirection);
+    SetOrthonormalBasis(OrthonormalBasis(orientation, referenceDirection));
 }
 
-std::optional<Intersection> HalfTorus::Intersect(const Line& line) const {
+std::optional<Hit> HalfTorus::FindHit(const Line& line) const {
+    // Cheap rejection before solving the quartic equation
+    if (!line.IntersectsBoundingBox(GetBoundingBox())) {
+        return std::nullopt;
+    }
+
     // Line in world space
     Vector3D origin = line.GetOrigin();
     Vector3D direction = line.GetDirection();
 
     // Transform line to local torus coordinates (torus centered at origin, major circle in XY plane)
-    Vector3D O = mOrthonormalBasis.ToLocal(origin - mPosition);  // local origin
-    Vector3D D = mOrthonormalBasis.ToLocal(direction);           // local direction (NOT normalized on purpose)
+    Vector3D O = mTransform.ToLocalPoint(origin);         // local origin
+    Vector3D D = mTransform.ToLocalDirection(direction);  // local direction (NOT normalized on purpose)
 
-    auto quarticCoeffs = ComputeQuarticCoefficients(O, D);
-    std::vector<double> roots = Math::SolveQuarticDurandKerner(quarticCoeffs[0], quarticCoeffs[1], quarticCoeffs[2], quarticCoeffs[3], quarticCoeffs[4]);
-
-    // Filter roots: keep smallest t within [tMin + eps, tMax - eps]
-    double tMin = std::numeric_limits<double>::infinity();
-    for (double t : roots) {
-        if (!std::isfinite(t)) {
-            continue;
-        }
-        if (t < line.GetTMin() + sEpsilon) {
-            continue;
-        }
+    // Keep the closest intersection with the full torus that lies on the half torus; the shading is inherited from the torus
+    for (double t : ComputeIntersectionParameters(Vector<3, double>(O), Vector<3, double>(D), line.GetTMin() + sEpsilon)) {
         Vector3D point = O + D * t;
         // Check if point is in the "half" of the torus, i.e. that phi is in [0, pi]
         double phi = std::atan2(point[1], point[0]);
-        if (phi < 0.0 || phi > M_PI) {
-            continue;
-        }
-        if (t < tMin) {
-            tMin = t;
+        if (phi >= 0.0 && phi <= M_PI) {
+            return Hit{t};
         }
     }
-
-    if (tMin == std::numeric_limits<double>::infinity()) {
-        return std::nullopt;
-    }
-
-    // Compute local and global intersection point
-    Vector3D localPoint = O + D * tMin;
-    Vector3D globalPoint = mOrthonormalBasis.ToGlobal(localPoint) + mPosition;
-
-    // Transform normal to global space (assumes ToGlobal preserves directions, not positions)
-    Vector3D normal = ComputeNormalAtPoint(localPoint);
-
-    return Intersection{tMin, globalPoint, normal};
+    return std::nullopt;
 }
 
 double HalfTorus::SurfaceArea() const {
     return 2.0 * M_PI * M_PI * mMajorRadius * mMinorRadius;
 }
 
-std::vector<Vector3D> HalfTorus::SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const {
-    std::vector<Vector3D> points;
-
+Vector3D HalfTorus::SampleSurfacePoint(Sampler& sampler) const {
     std::uniform_real_distribution<double> dist(0.0, 1.0);
 
-    while (points.size() < numPoints) {
-        double u = dist(prng);
-        double v = dist(prng);
-        double w = dist(prng);
+    while (true) {
+        double u = dist(sampler);
+        double v = dist(sampler);
+        double w = dist(sampler);
 
         double theta = M_PI * u;  // Half torus: theta in [0, pi]
         double phi = 2.0 * M_PI * v;
@@ -79,18 +57,17 @@ std::vector<Vector3D> HalfTorus::SampleSurfacePoints(std::size_t numPoints, std:
             continue;
         }
 
-        double x = (mMajorRadius + mMinorRadius * std::cos(phi)) * std::cos(theta);
-        double y = (mMajorRadius + mMinorRadius * std::cos(phi)) * std::sin(theta);
-        double z = mMinorRadius * std::sin(phi);
+        Real x = (mMajorRadius + mMinorRadius * std::cos(phi)) * std::cos(theta);
+        Real y = (mMajorRadius + mMinorRadius * std::cos(phi)) * std::sin(theta);
+        Real z = mMinorRadius * std::sin(phi);
 
         Vector3D localPoint{x, y, z};
-        Vector3D globalPoint = mOrthonormalBasis.ToGlobal(localPoint) + mPosition;
-        points.push_back(globalPoint);
+        Vector3D globalPoint = mTransform.ToGlobalPoint(localPoint);
+        return globalPoint;
     }
-    return points;
 }
 
-std::vector<Vector3D> HalfTorus::GetKeyPoints() const {
+std::vector<Vector3D> HalfTorus::ComputeKeyPoints() const {
     return {
         mPosition,
         mPosition + GetBasisVector(OrthonormalBasis::BasisVector::eX) * mMajorRadius,
@@ -98,10 +75,34 @@ std::vector<Vector3D> HalfTorus::GetKeyPoints() const {
         mPosition + GetBasisVector(OrthonormalBasis::BasisVector::eY) * mMajorRadius};
 }
 
+BoundingBox HalfTorus::ComputeBoundingBox() const {
+    // Bounds of the half circle with angles in [0, pi], padded by the minor radius.
+    // Along each axis, the extrema lie at the end points or where the derivative of the circle's coordinate vanishes.
+    const Vector3D& eX = GetBasisVector(OrthonormalBasis::BasisVector::eX);
+    const Vector3D& eY = GetBasisVector(OrthonormalBasis::BasisVector::eY);
+    BoundingBox box;
+    box.Expand(mPosition + mMajorRadius * eX);
+    box.Expand(mPosition - mMajorRadius * eX);
+    for (std::size_t i = 0; i < 3; i++) {
+        for (double angle : {std::atan2(eY[i], eX[i]), std::atan2(-eY[i], -eX[i])}) {
+            if (angle >= 0.0 && angle <= M_PI) {
+                box.Expand(mPosition + mMajorRadius * (std::cos(angle) * eX + std::sin(angle) * eY));
+            }
+        }
+    }
+    const Real minorRadius = mMinorRadius;
+    Vector3D padding({minorRadius, minorRadius, minorRadius});
+    return BoundingBox(box.GetMinimum() - padding, box.GetMaximum() + padding);
+}
+
 std::pair<double, double> HalfTorus::GetSurfaceParameters(const Vector3D& point) const {
     return {0.0, 0.0};
 }
 
+std::shared_ptr<Shape> HalfTorus::Clone() const {
+    return std::make_shared<HalfTorus>(*this);
+}
+
 void HalfTorus::PrintInfo() const {
     PrintInfoBase();
     std::cout << "\tReference Direction: " << mOrthonormalBasis.GetBasisVector(OrthonormalBasis::BasisVector::eX) << std::endl
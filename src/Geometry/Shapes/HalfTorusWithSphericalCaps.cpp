@@ -12,10 +12,16 @@ HalfTorusWithSphericalCaps::HalfTorusWithSphericalCaps(const Vector3D& position,
     CompositeShape(Shape::Type::CYLINDER, position, orientation),
     mMajorRadius(majorRadius),
     mMinorRadius(minorRadius) {
-    mOrthonormalBasis = OrthonormalBasis(orientation, referenceDirection);
+    SetOrthonormalBasis(OrthonormalBasis(orientation, referenceDirection));
     ComposeShape();
 }
 
+std::shared_ptr<Shape> HalfTorusWithSphericalCaps::Clone() const {
+    auto clone = std::make_shared<HalfTorusWithSphericalCaps>(*this);
+    clone->CloneComponents();
+    return clone;
+}
+
 void HalfTorusWithSphericalCaps::PrintInfo() const {
     PrintInfoCompositeBase();
     std::cout << "\tReference Direction: " << mOrthonormalBasis.GetBasisVector(OrthonormalBasis::BasisVector::eX) << std::endl
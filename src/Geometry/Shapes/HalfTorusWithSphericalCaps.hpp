@@ -8,6 +8,8 @@ class HalfTorusWithSphericalCaps : public CompositeShape {
 public:
     HalfTorusWithSphericalCaps(const Vector3D& position, const Vector3D& orientation, const Vector3D& referenceDirection, double majorRadius, double minorRadius);
 
+    virtual std::shared_ptr<Shape> Clone() const override;
+
     virtual void PrintInfo() const override;
 
 private:
@@ -0,0 +1,289 @@
+#include "Geometry/Shapes/Mesh.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace Raytracer::Geometry {
+
+std::size_t Mesh::Buffers::NumberOfVertices() const {
+    return x.size();
+}
+
+std::size_t Mesh::Buffers::NumberOfTriangles() const {
+    return indices.size() / 3;
+}
+
+bool Mesh::Buffers::HasNormals() const {
+    return !normalX.empty();
+}
+
+bool Mesh::Buffers::HasTextureCoordinates() const {
+    return !u.empty();
+}
+
+void Mesh::Buffers::AddVertex(const Vector3D& position) {
+    x.push_back(static_cast<float>(position[0]));
+    y.push_back(static_cast<float>(position[1]));
+    z.push_back(static_cast<float>(position[2]));
+}
+
+void Mesh::Buffers::AddTriangle(std::uint32_t vertex1, std::uint32_t vertex2, std::uint32_t vertex3) {
+    indices.insert(indices.end(), {vertex1, vertex2, vertex3});
+}
+
+void Mesh::Buffers::Validate() const {
+    const std::size_t numVertices = NumberOfVertices();
+    if (y.size() != numVertices || z.size() != numVertices) {
+        throw std::invalid_argument("Mesh: Vertex position buffers have different sizes.");
+    }
+    if (HasNormals() && (normalX.size() != numVertices || normalY.size() != numVertices || normalZ.size() != numVertices)) {
+        throw std::invalid_argument("Mesh: Normal buffers must be empty or contain one normal per vertex.");
+    }
+    if (HasTextureCoordinates() && (u.size() != numVertices || v.size() != numVertices)) {
+        throw std::invalid_argument("Mesh: Texture coordinate buffers must be empty or contain one entry per vertex.");
+    }
+    if (indices.empty() || indices.size() % 3 != 0) {
+        throw std::invalid_argument("Mesh: The index buffer must contain three indices per triangle.");
+    }
+    if (*std::max_element(indices.begin(), indices.end()) >= numVertices) {
+        throw std::invalid_argument("Mesh: Vertex index out of range.");
+    }
+}
+
+Mesh::Mesh(Buffers buffers, const Vector3D& position, const Vector3D& orientation, const Vector3D& referenceDirection) :
+    Shape(Type::MESH, position, orientation, referenceDirection),
+    mBuffers(std::move(buffers)) {
+    mBuffers.Validate();
+
+    const std::size_t numTriangles = mBuffers.NumberOfTriangles();
+    std::vector<BoundingBox> triangleBounds(numTriangles);
+    mCumulativeAreas.resize(numTriangles);
+    double area = 0.0;
+    for (std::size_t i = 0; i < numTriangles; i++) {
+        const Vector3D v0 = GetVertex(mBuffers.indices[3 * i]);
+        const Vector3D v1 = GetVertex(mBuffers.indices[3 * i + 1]);
+        const Vector3D v2 = GetVertex(mBuffers.indices[3 * i + 2]);
+        triangleBounds[i].Expand(v0);
+        triangleBounds[i].Expand(v1);
+        triangleBounds[i].Expand(v2);
+        area += 0.5 * (v1 - v0).Cross(v2 - v0).Norm();
+        mCumulativeAreas[i] = area;
+    }
+    mBVH = BVH(triangleBounds);
+}
+
+std::optional<Hit> Mesh::FindHit(const Line& line) const {
+    // Intersect in local coordinates, where the BVH was built. The basis is orthonormal, so the line parameter is the same in both systems.
+    const Vector3D origin = mTransform.ToLocalPoint(line.GetOrigin());
+    const Vector3D direction = mTransform.ToLocalDirection(line.GetDirection());
+    const Line localLine(origin, direction);
+
+    double tMax = std::numeric_limits<double>::infinity();
+    std::size_t closestTriangle = NumberOfTriangles();
+    double closestU = 0.0;
+    double closestV = 0.0;
+    mBVH.Traverse(localLine, line.GetTMin(), tMax, [&](std::size_t triangle) {
+        double t, u, v;
+        if (IntersectTriangle(triangle, origin, direction, line.GetTMin(), tMax, t, u, v)) {
+            tMax = t;
+            closestTriangle = triangle;
+            closestU = u;
+            closestV = v;
+        }
+        return false;
+    });
+    if (closestTriangle == NumberOfTriangles()) {
+        return std::nullopt;
+    }
+    return Hit{tMax, 0, static_cast<std::uint32_t>(closestTriangle), closestU, closestV};
+}
+
+Intersection Mesh::ComputeSurfaceInteraction(const Line& line, const Hit& hit) const {
+    const std::uint32_t* vertices = &mBuffers.indices[3 * hit.primitive];
+    Vector3D normal;
+    if (mBuffers.HasNormals()) {
+        // Smooth shading with interpolated vertex normals
+        normal = (1.0 - hit.u - hit.v) * GetVertexNormal(vertices[0]) + hit.u * GetVertexNormal(vertices[1]) + hit.v * GetVertexNormal(vertices[2]);
+    } else {
+        const Vector3D v0 = GetVertex(vertices[0]);
+        normal = (GetVertex(vertices[1]) - v0).Cross(GetVertex(vertices[2]) - v0);
+    }
+    return Intersection{hit.t, line.PointAtParameter(hit.t), mTransform.ToGlobalDirection(normal.NormalizedUnchecked())};
+}
+
+bool Mesh::Occluded(const Line& line, double tMin, double tMax) const {
+    const Vector3D origin = mTransform.ToLocalPoint(line.GetOrigin());
+    const Vector3D direction = mTransform.ToLocalDirection(line.GetDirection());
+    const Line localLine(origin, direction);
+
+    tMin = std::max(tMin, line.GetTMin());
+    bool occluded = false;
+    mBVH.Traverse(localLine, tMin, tMax, [&](std::size_t triangle) {
+        double t, u, v;
+        occluded = IntersectTriangle(triangle, origin, direction, tMin, tMax, t, u, v);
+        return occluded;
+    });
+    return occluded;
+}
+
+double Mesh::SurfaceArea() const {
+    return mCumulativeAreas.back();
+}
+
+Vector3D Mesh::SampleSurfacePoint(Sampler& sampler) const {
+    // Pick a triangle with probability proportional to its area
+    const double area = sampler.Uniform() * SurfaceArea();
+    const std::size_t triangle = std::min<std::size_t>(std::upper_bound(mCumulativeAreas.begin(), mCumulativeAreas.end(), area) - mCumulativeAreas.begin(), NumberOfTriangles() - 1);
+
+    double u = sampler.Uniform();
+    double v = sampler.Uniform();
+    // Ensure the point is inside the triangle
+    if (u + v > 1.0) {
+        u = 1.0 - u;
+        v = 1.0 - v;
+    }
+
+    const Vector3D v0 = GetVertex(mBuffers.indices[3 * triangle]);
+    const Vector3D localPoint = v0 + u * (GetVertex(mBuffers.indices[3 * triangle + 1]) - v0) + v * (GetVertex(mBuffers.indices[3 * triangle + 2]) - v0);
+    return mTransform.ToGlobalPoint(localPoint);
+}
+
+std::vector<Vector3D> Mesh::ComputeKeyPoints() const {
+    std::vector<Vector3D> keyPoints;
+    keyPoints.reserve(NumberOfVertices());
+    for (std::uint32_t i = 0; i < NumberOfVertices(); i++) {
+        keyPoints.push_back(mTransform.ToGlobalPoint(GetVertex(i)));
+    }
+    return keyPoints;
+}
+
+std::pair<double, double> Mesh::GetSurfaceParameters(const Vector3D& point) const {
+    if (!mBuffers.HasTextureCoordinates()) {
+        return {0.0, 0.0};
+    }
+
+    // Find the triangle whose plane passes closest to the point among the triangles that contain its projection
+    const Vector3D localPoint = mTransform.ToLocalPoint(point);
+    const Real tolerance = sEpsilon * (1.0 + mBVH.GetBoundingBox().GetExtent().Norm());
+    const Vector3D margin({tolerance, tolerance, tolerance});
+    double closestDistance = std::numeric_limits<double>::infinity();
+    std::pair<double, double> parameters = {0.0, 0.0};
+    mBVH.Query(BoundingBox(localPoint - margin, localPoint + margin), [&](std::size_t triangle) {
+        const std::uint32_t* vertices = &mBuffers.indices[3 * triangle];
+        const Vector3D v0 = GetVertex(vertices[0]);
+        const Vector3D edge1 = GetVertex(vertices[1]) - v0;
+        const Vector3D edge2 = GetVertex(vertices[2]) - v0;
+        const Vector3D w = localPoint - v0;
+
+        // Barycentric coordinates of the projection onto the triangle's plane
+        const double d11 = edge1.Dot(edge1);
+        const double d12 = edge1.Dot(edge2);
+        const double d22 = edge2.Dot(edge2);
+        const double denominator = d11 * d22 - d12 * d12;
+        if (denominator <= 0.0) {
+            return false;
+        }
+        const double u = (d22 * w.Dot(edge1) - d12 * w.Dot(edge2)) / denominator;
+        const double v = (d11 * w.Dot(edge2) - d12 * w.Dot(edge1)) / denominator;
+        if (u < -kBarycentricTolerance || v < -kBarycentricTolerance || u + v > 1.0 + kBarycentricTolerance) {
+            return false;
+        }
+
+        const double distance = (w - u * edge1 - v * edge2).Norm();
+        if (distance < closestDistance) {
+            closestDistance = distance;
+            const double weight0 = 1.0 - u - v;
+            const double textureU = weight0 * mBuffers.u[vertices[0]] + u * mBuffers.u[vertices[1]] + v * mBuffers.u[vertices[2]];
+            const double textureV = weight0 * mBuffers.v[vertices[0]] + u * mBuffers.v[vertices[1]] + v * mBuffers.v[vertices[2]];
+            parameters = {textureU - 0.5, textureV - 0.5};
+        }
+        return false;
+    });
+    return parameters;
+}
+
+std::size_t Mesh::NumberOfVertices() const {
+    return mBuffers.NumberOfVertices();
+}
+
+std::size_t Mesh::NumberOfTriangles() const {
+    return mBuffers.NumberOfTriangles();
+}
+
+std::size_t Mesh::MemoryUsage() const {
+    const std::size_t floatsPerVertex = 3 + (mBuffers.HasNormals() ? 3 : 0) + (mBuffers.HasTextureCoordinates() ? 2 : 0);
+    return NumberOfVertices() * floatsPerVertex * sizeof(float) +
+           mBuffers.indices.size() * sizeof(std::uint32_t) +
+           mCumulativeAreas.size() * sizeof(double) +
+           mBVH.NumberOfNodes() * sizeof(BVH::Node) +
+           mBVH.NumberOfPrimitives() * sizeof(std::uint32_t);
+}
+
+BoundingBox Mesh::ComputeBoundingBox() const {
+    // Transform the corners of the local bounds, which is exact as long as the mesh is not spun
+    const BoundingBox localBox = mBVH.GetBoundingBox();
+    const Vector3D& minimum = localBox.GetMinimum();
+    const Vector3D& maximum = localBox.GetMaximum();
+    BoundingBox box;
+    for (int corner = 0; corner < 8; corner++) {
+        Vector3D localCorner({(corner & 1) ? maximum[0] : minimum[0], (corner & 2) ? maximum[1] : minimum[1], (corner & 4) ? maximum[2] : minimum[2]});
+        box.Expand(mTransform.ToGlobalPoint(localCorner));
+    }
+    return box;
+}
+
+std::shared_ptr<Shape> Mesh::Clone() const {
+    return std::make_shared<Mesh>(*this);
+}
+
+void Mesh::PrintInfo() const {
+    PrintInfoBase();
+    std::cout << "Vertices:\t" << NumberOfVertices() << std::endl
+              << "Triangles:\t" << NumberOfTriangles() << std::endl
+              << "Normals:\t" << (mBuffers.HasNormals() ? "[x]" : "[ ]") << std::endl
+              << "Texture Coords:\t" << (mBuffers.HasTextureCoordinates() ? "[x]" : "[ ]") << std::endl
+              << "Memory:\t\t" << MemoryUsage() / 1024.0 / 1024.0 << " MB (" << double(MemoryUsage()) / NumberOfTriangles() << " bytes per triangle)" << std::endl
+              << "BVH Nodes:\t" << mBVH.NumberOfNodes() << " (Depth: " << mBVH.Depth() << ")" << std::endl
+              << std::endl;
+}
+
+Vector3D Mesh::GetVertex(std::uint32_t index) const {
+    return Vector3D({mBuffers.x[index], mBuffers.y[index], mBuffers.z[index]});
+}
+
+Vector3D Mesh::GetVertexNormal(std::uint32_t index) const {
+    return Vector3D({mBuffers.normalX[index], mBuffers.normalY[index], mBuffers.normalZ[index]});
+}
+
+bool Mesh::IntersectTriangle(std::size_t triangle, const Vector3D& origin, const Vector3D& direction, double tMin, double tMax, double& t, double& u, double& v) const {
+    const std::uint32_t* vertices = &mBuffers.indices[3 * triangle];
+    const Vector3D v0 = GetVertex(vertices[0]);
+    const Vector3D edge1 = GetVertex(vertices[1]) - v0;
+    const Vector3D edge2 = GetVertex(vertices[2]) - v0;
+
+    // Unlike in Triangle, the determinant is not compared to an absolute epsilon, because mesh triangles can be arbitrarily small
+    const Vector3D h = direction.Cross(edge2);
+    const double det = edge1.Dot(h);
+    if (det == 0.0) {
+        return false;  // Parallel to triangle
+    }
+
+    const double invDet = 1.0 / det;
+    const Vector3D s = origin - v0;
+    u = invDet * s.Dot(h);
+    if (u < -kBarycentricTolerance || u > 1.0 + kBarycentricTolerance) {
+        return false;
+    }
+
+    const Vector3D q = s.Cross(edge1);
+    v = invDet * direction.Dot(q);
+    if (v < -kBarycentricTolerance || u + v > 1.0 + kBarycentricTolerance) {
+        return false;
+    }
+
+    t = invDet * edge2.Dot(q);
+    return t > tMin && t < tMax;
+}
+
+}  // namespace Raytracer::Geometry
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Geometry/BVH.hpp"
+#include "Geometry/Intersection.hpp"
+#include "Geometry/Line.hpp"
+#include "Geometry/Shape.hpp"
+#include "Geometry/Vector.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Raytracer::Geometry {
+
+// Triangle mesh with indexed vertex buffers that are shared between the triangles.
+// The buffers are stored in structure-of-arrays layout and single precision in the local coordinates of the mesh, together with a BVH over the triangles.
+// Moving or spinning the mesh only changes its position and orthonormal basis, the buffers and the BVH are never rebuilt.
+class Mesh : public Shape {
+public:
+    struct Buffers {
+        std::vector<float> x, y, z;                    // Vertex positions
+        std::vector<float> normalX, normalY, normalZ;  // Optional vertex normals, either empty or one per vertex
+        std::vector<float> u, v;                       // Optional texture coordinates in [0, 1], either empty or one per vertex
+        std::vector<std::uint32_t> indices;            // Three vertex indices per triangle
+
+        std::size_t NumberOfVertices() const;
+        std::size_t NumberOfTriangles() const;
+        bool HasNormals() const;
+        bool HasTextureCoordinates() const;
+
+        void AddVertex(const Vector3D& position);
+        void AddTriangle(std::uint32_t vertex1, std::uint32_t vertex2, std::uint32_t vertex3);
+
+        // Throws if the buffer sizes are inconsistent or an index is out of range
+        void Validate() const;
+    };
+
+    // The buffers are given in local coordinates, whose z axis is the orientation and whose x axis is the reference direction
+    explicit Mesh(Buffers buffers, const Vector3D& position = Vector3D({0.0, 0.0, 0.0}), const Vector3D& orientation = Vector3D({0.0, 0.0, 1.0}), const Vector3D& referenceDirection = Vector3D({1.0, 0.0, 0.0}));
+
+    std::optional<Hit> FindHit(const Line& line) const override;
+    Intersection ComputeSurfaceInteraction(const Line& line, const Hit& hit) const override;
+    bool Occluded(const Line& line, double tMin, double tMax) const override;
+
+    double SurfaceArea() const override;
+
+    // Area-weighted, uniform sample over all triangles
+    Vector3D SampleSurfacePoint(Sampler& sampler) const override;
+
+    // Interpolated texture coordinates of the triangle that contains the point
+    std::pair<double, double> GetSurfaceParameters(const Vector3D& point) const override;
+
+    std::size_t NumberOfVertices() const;
+    std::size_t NumberOfTriangles() const;
+
+    // Bytes allocated for the vertex, index, and BVH buffers
+    std::size_t MemoryUsage() const;
+
+    std::shared_ptr<Shape> Clone() const override;
+
+    void PrintInfo() const override;
+
+protected:
+    BoundingBox ComputeBoundingBox() const override;
+
+    // All vertices in world coordinates
+    std::vector<Vector3D> ComputeKeyPoints() const override;
+
+private:
+    Buffers mBuffers;
+    BVH mBVH;                               // Built in local coordinates
+    std::vector<double> mCumulativeAreas;  // For area-weighted sampling of the triangles
+
+    // Tolerance that closes the gaps between neighboring triangles
+    static constexpr double kBarycentricTolerance = 1e-9 * kToleranceScale;
+
+    Vector3D GetVertex(std::uint32_t index) const;
+    Vector3D GetVertexNormal(std::uint32_t index) const;
+
+    // Möller–Trumbore test in local coordinates, returns the line parameter and the barycentric coordinates of the hit
+    bool IntersectTriangle(std::size_t triangle, const Vector3D& origin, const Vector3D& direction, double tMin, double tMax, double& t, double& u, double& v) const;
+};
+
+}  // namespace Raytracer::Geometry
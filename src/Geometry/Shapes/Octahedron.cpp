@@ -10,6 +10,12 @@ Octahedron::Octahedron(const Vector3D& center, const Vector3D& orientation, cons
     ComposeShape();
 }
 
+std::shared_ptr<Shape> Octahedron::Clone() const {
+    auto clone = std::make_shared<Octahedron>(*this);
+    clone->CloneComponents();
+    return clone;
+}
+
 void Octahedron::PrintInfo() const {
     PrintInfoCompositeBase();
     std::cout << "\tEdge Length: " << mEdgeLength << std::endl
@@ -19,7 +25,7 @@ void Octahedron::PrintInfo() const {
 void Octahedron::ComposeShape() {
     mComponents.clear();
 
-    const double a = mEdgeLength / std::sqrt(2.0);
+    const Real a = mEdgeLength / std::sqrt(2.0);
 
     // 6 vertices of a regular octahedron centered at the origin
     std::array<Vector3D, 6> vertices = {
@@ -33,7 +39,7 @@ void Octahedron::ComposeShape() {
 
     // Transform into world space using your orthonormal basis and center
     for (auto& v : vertices) {
-        v = mOrthonormalBasis.ToGlobal(v) + mPosition;
+        v = mTransform.ToGlobalPoint(v);
     }
 
     // Create triangles (ensure consistent winding for outward normals)
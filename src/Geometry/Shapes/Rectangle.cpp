@@ -1,5 +1,7 @@
 #include "Geometry/Shapes/Rectangle.hpp"
 
+#include "Geometry/PacketKernels.hpp"
+
 namespace Raytracer::Geometry {
 
 Rectangle::Rectangle(const Vector3D& center, const Vector3D& normal, const Vector3D& widthDirection, double width, double height) :
@@ -8,7 +10,7 @@ Rectangle::Rectangle(const Vector3D& center, const Vector3D& normal, const Vecto
     mHeight(height) {
 }
 
-std::optional<Intersection> Rectangle::Intersect(const Line& line) const {
+std::optional<Hit> Rectangle::FindHit(const Line& line) const {
     const Vector3D& normal = GetBasisVector(OrthonormalBasis::BasisVector::eZ);
     double denom = normal.Dot(line.GetDirection());
     if (std::fabs(denom) < sEpsilon) {
@@ -20,37 +22,54 @@ std::optional<Intersection> Rectangle::Intersect(const Line& line) const {
         return std::nullopt;
     }
 
-    Vector3D hitPoint = line(t);
-
-    std::pair<double, double> uv = GetSurfaceParameters(hitPoint);
+    std::pair<double, double> uv = GetSurfaceParameters(line(t));
 
     if (std::abs(uv.first) <= 0.5 && std::abs(uv.second) <= 0.5) {
-        return Intersection{t, hitPoint, normal};
+        return Hit{t};
     }
     return std::nullopt;
 }
 
+Intersection Rectangle::ComputeSurfaceInteraction(const Line& line, const Hit& hit) const {
+    return Intersection{hit.t, line(hit.t), GetBasisVector(OrthonormalBasis::BasisVector::eZ)};
+}
+
+void Rectangle::FindHits(const LinePacket& packet, PacketHits& hits) const {
+    hits.Clear();
+    PacketKernels::IntersectRectangle(packet, mPosition, GetBasisVector(OrthonormalBasis::BasisVector::eZ), GetBasisVector(OrthonormalBasis::BasisVector::eX), GetBasisVector(OrthonormalBasis::BasisVector::eY), mWidth, mHeight, sEpsilon, hits.t);
+}
+
+bool Rectangle::Occluded(const Line& line, double tMin, double tMax) const {
+    const Vector3D& normal = GetBasisVector(OrthonormalBasis::BasisVector::eZ);
+    double denom = normal.Dot(line.GetDirection());
+    if (std::fabs(denom) < sEpsilon) {
+        return false;
+    }
+
+    double t = (mPosition - line.GetOrigin()).Dot(normal) / denom;
+    if (t < line.GetTMin() || t <= tMin || t >= tMax) {
+        return false;
+    }
+
+    std::pair<double, double> uv = GetSurfaceParameters(line(t));
+    return std::abs(uv.first) <= 0.5 && std::abs(uv.second) <= 0.5;
+}
+
 double Rectangle::SurfaceArea() const {
     return mWidth * mHeight;
 }
 
-std::vector<Vector3D> Rectangle::SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const {
-    std::vector<Vector3D> points;
-
+Vector3D Rectangle::SampleSurfacePoint(Sampler& sampler) const {
     std::uniform_real_distribution<double> distU(-mWidth / 2.0, mWidth / 2.0);
     std::uniform_real_distribution<double> distV(-mHeight / 2.0, mHeight / 2.0);
 
-    for (std::size_t i = 0; i < numPoints; ++i) {
-        double u = distU(prng);
-        double v = distV(prng);
-        Vector3D point = mPosition + u * GetBasisVector(OrthonormalBasis::BasisVector::eX) + v * GetBasisVector(OrthonormalBasis::BasisVector::eY);
-        points.push_back(point);
-    }
-
-    return points;
+    double u = distU(sampler);
+    double v = distV(sampler);
+    Vector3D point = mPosition + u * GetBasisVector(OrthonormalBasis::BasisVector::eX) + v * GetBasisVector(OrthonormalBasis::BasisVector::eY);
+    return point;
 }
 
-std::vector<Vector3D> Rectangle::GetKeyPoints() const {
+std::vector<Vector3D> Rectangle::ComputeKeyPoints() const {
     const Vector3D& u = GetBasisVector(OrthonormalBasis::BasisVector::eX);
     const Vector3D& v = GetBasisVector(OrthonormalBasis::BasisVector::eY);
     return {mPosition,
@@ -60,6 +79,16 @@ std::vector<Vector3D> Rectangle::GetKeyPoints() const {
             mPosition - u * (mWidth / 2.0) + v * (mHeight / 2.0)};
 }
 
+BoundingBox Rectangle::ComputeBoundingBox() const {
+    const Vector3D& u = GetBasisVector(OrthonormalBasis::BasisVector::eX);
+    const Vector3D& v = GetBasisVector(OrthonormalBasis::BasisVector::eY);
+    Vector3D halfExtent;
+    for (std::size_t i = 0; i < 3; i++) {
+        halfExtent[i] = 0.5 * (mWidth * std::abs(u[i]) + mHeight * std::abs(v[i]));
+    }
+    return BoundingBox(mPosition - halfExtent, mPosition + halfExtent);
+}
+
 std::pair<double, double> Rectangle::GetSurfaceParameters(const Vector3D& point) const {
     // Relative to center
     Vector3D localPoint = point - mPosition;
@@ -74,6 +103,10 @@ std::pair<double, double> Rectangle::GetSurfaceParameters(const Vector3D& point)
     return {u, v};
 }
 
+std::shared_ptr<Shape> Rectangle::Clone() const {
+    return std::make_shared<Rectangle>(*this);
+}
+
 void Rectangle::PrintInfo() const {
     PrintInfoBase();
     std::cout << "\tWidth: " << mWidth << std::endl
@@ -14,16 +14,24 @@ class Rectangle : public Shape {
 public:
     Rectangle(const Vector3D& center, const Vector3D& normal, const Vector3D& widthDirection, double width, double height);
 
-    virtual std::optional<Intersection> Intersect(const Line& line) const override;
+    virtual std::optional<Hit> FindHit(const Line& line) const override;
+    virtual Intersection ComputeSurfaceInteraction(const Line& line, const Hit& hit) const override;
+    virtual void FindHits(const LinePacket& packet, PacketHits& hits) const override;
+    virtual bool Occluded(const Line& line, double tMin, double tMax) const override;
 
     virtual double SurfaceArea() const override;
-    virtual std::vector<Vector3D> SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const override;
+    virtual Vector3D SampleSurfacePoint(Sampler& sampler) const override;
 
-    virtual std::vector<Vector3D> GetKeyPoints() const override;
     virtual std::pair<double, double> GetSurfaceParameters(const Vector3D& point) const override;
 
+    virtual std::shared_ptr<Shape> Clone() const override;
+
     virtual void PrintInfo() const override;
 
+protected:
+    virtual BoundingBox ComputeBoundingBox() const override;
+    virtual std::vector<Vector3D> ComputeKeyPoints() const override;
+
 private:
     double mWidth;
     double mHeight;
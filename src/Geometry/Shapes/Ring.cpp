@@ -1,5 +1,7 @@
 #include "Geometry/Shapes/Ring.hpp"
 
+#include "Geometry/PacketKernels.hpp"
+
 #include <cmath>
 
 namespace Raytracer::Geometry {
@@ -9,7 +11,7 @@ Ring::Ring(const Vector3D& position, const Vector3D& normal, double innerRadius,
     mInnerRadius(innerRadius),
     mOuterRadius(outerRadius) {}
 
-std::optional<Intersection> Ring::Intersect(const Line& line) const {
+std::optional<Hit> Ring::FindHit(const Line& line) const {
     const Vector3D& normal = GetBasisVector(OrthonormalBasis::BasisVector::eZ);
     double denom = normal.Dot(line.GetDirection());
     if (std::fabs(denom) < sEpsilon) {
@@ -21,37 +23,57 @@ std::optional<Intersection> Ring::Intersect(const Line& line) const {
         return std::nullopt;
     }
 
-    Vector3D hitPoint = line(t);
-    Vector3D localPoint = hitPoint - mPosition;
+    Vector3D localPoint = line(t) - mPosition;
 
     if (localPoint.Norm() <= mOuterRadius && localPoint.Norm() >= mInnerRadius) {
-        return Intersection{t, hitPoint, normal};
+        return Hit{t};
     }
     return std::nullopt;
 }
 
+Intersection Ring::ComputeSurfaceInteraction(const Line& line, const Hit& hit) const {
+    return Intersection{hit.t, line(hit.t), GetBasisVector(OrthonormalBasis::BasisVector::eZ)};
+}
+
+void Ring::FindHits(const LinePacket& packet, PacketHits& hits) const {
+    // Also used by disks, which are rings with zero inner radius
+    hits.Clear();
+    PacketKernels::IntersectRing(packet, mPosition, GetBasisVector(OrthonormalBasis::BasisVector::eZ), mInnerRadius, mOuterRadius, sEpsilon, hits.t);
+}
+
+bool Ring::Occluded(const Line& line, double tMin, double tMax) const {
+    const Vector3D& normal = GetBasisVector(OrthonormalBasis::BasisVector::eZ);
+    double denom = normal.Dot(line.GetDirection());
+    if (std::fabs(denom) < sEpsilon) {
+        return false;
+    }
+
+    double t = (mPosition - line.GetOrigin()).Dot(normal) / denom;
+    if (t < line.GetTMin() || t <= tMin || t >= tMax) {
+        return false;
+    }
+
+    double distance2 = (line(t) - mPosition).NormSquared();
+    return distance2 <= mOuterRadius * mOuterRadius && distance2 >= mInnerRadius * mInnerRadius;
+}
+
 double Ring::SurfaceArea() const {
     return M_PI * (mOuterRadius * mOuterRadius - mInnerRadius * mInnerRadius);
 }
 
-std::vector<Vector3D> Ring::SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const {
-    std::vector<Vector3D> points;
-
+Vector3D Ring::SampleSurfacePoint(Sampler& sampler) const {
     std::uniform_real_distribution<double> uniformDist(0.0, 1.0);
     std::uniform_real_distribution<double> angleDist(0.0, 2.0 * M_PI);
 
-    for (std::size_t i = 0; i < numPoints; ++i) {
-        double u = uniformDist(prng);
-        double r = std::sqrt(u * (mOuterRadius * mOuterRadius - mInnerRadius * mInnerRadius) + mInnerRadius * mInnerRadius);
-        double theta = angleDist(prng);
+    double u = uniformDist(sampler);
+    double r = std::sqrt(u * (mOuterRadius * mOuterRadius - mInnerRadius * mInnerRadius) + mInnerRadius * mInnerRadius);
+    double theta = angleDist(sampler);
 
-        Vector3D point = mPosition + r * (std::cos(theta) * mOrthonormalBasis[0] + std::sin(theta) * mOrthonormalBasis[1]);
-        points.push_back(point);
-    }
-    return points;
+    Vector3D point = mPosition + r * (std::cos(theta) * mOrthonormalBasis[0] + std::sin(theta) * mOrthonormalBasis[1]);
+    return point;
 }
 
-std::vector<Vector3D> Ring::GetKeyPoints() const {
+std::vector<Vector3D> Ring::ComputeKeyPoints() const {
     return {
         mPosition + 0.5 * (mInnerRadius + mOuterRadius) * mOrthonormalBasis[0],
         mPosition - 0.5 * (mInnerRadius + mOuterRadius) * mOrthonormalBasis[0],
@@ -60,10 +82,18 @@ std::vector<Vector3D> Ring::GetKeyPoints() const {
     };
 }
 
+BoundingBox Ring::ComputeBoundingBox() const {
+    return BoundingBox::FromDisk(mPosition, GetOrientation(), mOuterRadius);
+}
+
 std::pair<double, double> Ring::GetSurfaceParameters(const Vector3D& point) const {
     return {0.0, 0.0};  // Not implemented
 }
 
+std::shared_ptr<Shape> Ring::Clone() const {
+    return std::make_shared<Ring>(*this);
+}
+
 void Ring::PrintInfo() const {
     PrintInfoBase();
     std::cout << "\tInner Radius:\t" << mInnerRadius << std::endl
@@ -1,5 +1,7 @@
 #include "Geometry/Shapes/Sphere.hpp"
 
+#include "Geometry/PacketKernels.hpp"
+
 namespace Raytracer::Geometry {
 
 Sphere::Sphere(const Vector3D& position, double radius, const Vector3D& orientation, const Vector3D& reference_direction) :
@@ -7,7 +9,7 @@ Sphere::Sphere(const Vector3D& position, double radius, const Vector3D& orientat
     mRadius(radius) {
 }
 
-std::optional<Intersection> Sphere::Intersect(const Line& line) const {
+std::optional<Hit> Sphere::FindHit(const Line& line) const {
     Vector3D oc = line.GetOrigin() - mPosition;
 
     double a = line.GetDirection().NormSquared();
@@ -35,45 +37,75 @@ std::optional<Intersection> Sphere::Intersect(const Line& line) const {
     if (t == std::numeric_limits<double>::infinity()) {
         return std::nullopt;  // no valid root
     }
+    return Hit{t};
+}
 
-    Vector3D intersectionPoint = line(t);
-    Vector3D normal = (intersectionPoint - mPosition).Normalized();
+Intersection Sphere::ComputeSurfaceInteraction(const Line& line, const Hit& hit) const {
+    Vector3D intersectionPoint = line(hit.t);
+    Vector3D normal = (intersectionPoint - mPosition).NormalizedUnchecked();
+
+    return Intersection{hit.t, intersectionPoint, normal};
+}
 
-    return Intersection{t, intersectionPoint, normal};
+void Sphere::FindHits(const LinePacket& packet, PacketHits& hits) const {
+    hits.Clear();
+    PacketKernels::IntersectSphere(packet, mPosition, mRadius, hits.t);
+}
+
+bool Sphere::Occluded(const Line& line, double tMin, double tMax) const {
+    Vector3D oc = line.GetOrigin() - mPosition;
+
+    double a = line.GetDirection().NormSquared();
+    double b = 2.0 * oc.Dot(line.GetDirection());
+    double c = oc.NormSquared() - mRadius * mRadius;
+
+    double discriminant = b * b - 4 * a * c;
+    if (discriminant < 0.0) {
+        return false;
+    }
+
+    double sqrtD = std::sqrt(discriminant);
+    for (double r : {(-b - sqrtD) / (2.0 * a), (-b + sqrtD) / (2.0 * a)}) {
+        if (r >= line.GetTMin() && r > tMin && r < tMax) {
+            return true;
+        }
+    }
+    return false;
 }
 
 double Sphere::SurfaceArea() const {
     return 4.0 * M_PI * mRadius * mRadius;
 }
 
-std::vector<Vector3D> Sphere::SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const {
-    std::vector<Vector3D> points;
-
+Vector3D Sphere::SampleSurfacePoint(Sampler& sampler) const {
     std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
 
-    for (std::size_t i = 0; i < numPoints; ++i) {
-        double u = uniformDistribution(prng);
-        double v = uniformDistribution(prng);
+    double u = uniformDistribution(sampler);
+    double v = uniformDistribution(sampler);
 
-        double phi = 2.0 * M_PI * u;      // azimuthal angle
-        double cosTheta = 1.0 - 2.0 * v;  // polar angle
-        double sinTheta = std::sqrt(1.0 - cosTheta * cosTheta);
+    double phi = 2.0 * M_PI * u;      // azimuthal angle
+    double cosTheta = 1.0 - 2.0 * v;  // polar angle
+    double sinTheta = std::sqrt(1.0 - cosTheta * cosTheta);
 
-        Vector3D point = {
-            mRadius * sinTheta * std::cos(phi),
-            mRadius * sinTheta * std::sin(phi),
-            mRadius * cosTheta,
-        };
+    Vector3D point = {
+        static_cast<Real>(mRadius * sinTheta * std::cos(phi)),
+        static_cast<Real>(mRadius * sinTheta * std::sin(phi)),
+        static_cast<Real>(mRadius * cosTheta),
+    };
 
-        points.push_back(mPosition + point);
-    }
-    return points;
+    return mPosition + point;
 }
 
-std::vector<Vector3D> Sphere::GetKeyPoints() const {
+std::vector<Vector3D> Sphere::ComputeKeyPoints() const {
     return {mPosition};
 }
 
+BoundingBox Sphere::ComputeBoundingBox() const {
+    const Real radius = mRadius;
+    Vector3D halfExtent({radius, radius, radius});
+    return BoundingBox(mPosition - halfExtent, mPosition + halfExtent);
+}
+
 std::pair<double, double> Sphere::GetSurfaceParameters(const Vector3D& point) const {
     return GetSurfaceParameters(point, mPosition, mOrthonormalBasis);
 }
@@ -93,6 +125,10 @@ std::pair<double, double> Sphere::GetSurfaceParameters(const Vector3D& point, co
     return {u, v};
 }
 
+std::shared_ptr<Shape> Sphere::Clone() const {
+    return std::make_shared<Sphere>(*this);
+}
+
 void Sphere::PrintInfo() const {
     PrintInfoBase();
     std::cout << "\tRadius:\t" << mRadius << std::endl
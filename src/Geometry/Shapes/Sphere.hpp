@@ -8,19 +8,27 @@ class Sphere : public Shape {
 public:
     Sphere(const Vector3D& position, const double radius, const Vector3D& orientation = Vector3D({0.0, 0.0, 1.0}), const Vector3D& reference_direction = Vector3D({0.0, 0.0, 0.0}));
 
-    virtual std::optional<Intersection> Intersect(const Line& line) const override;
+    virtual std::optional<Hit> FindHit(const Line& line) const override;
+    virtual Intersection ComputeSurfaceInteraction(const Line& line, const Hit& hit) const override;
+    virtual void FindHits(const LinePacket& packet, PacketHits& hits) const override;
+    virtual bool Occluded(const Line& line, double tMin, double tMax) const override;
 
     virtual double SurfaceArea() const override;
-    virtual std::vector<Vector3D> SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const override;
+    virtual Vector3D SampleSurfacePoint(Sampler& sampler) const override;
 
-    virtual std::vector<Vector3D> GetKeyPoints() const override;
     virtual std::pair<double, double> GetSurfaceParameters(const Vector3D& point) const override;
 
     // Static version of GetSurfaceParameters
     static std::pair<double, double> GetSurfaceParameters(const Vector3D& point, const Vector3D& sphereCenter, const OrthonormalBasis& basis);
 
+    virtual std::shared_ptr<Shape> Clone() const override;
+
     virtual void PrintInfo() const override;
 
+protected:
+    virtual BoundingBox ComputeBoundingBox() const override;
+    virtual std::vector<Vector3D> ComputeKeyPoints() const override;
+
 private:
     double mRadius;
 };
@@ -8,7 +8,7 @@ SphericalCap::SphericalCap(const Vector3D& position, double radius, const Vector
     mCosMaxAngle(std::cos(maxAngle)) {
 }
 
-std::optional<Intersection> SphericalCap::Intersect(const Line& line) const {
+std::optional<Hit> SphericalCap::FindHit(const Line& line) const {
     Vector3D oc = line.GetOrigin() - mPosition;
 
     double a = line.GetDirection().NormSquared();
@@ -43,54 +43,73 @@ std::optional<Intersection> SphericalCap::Intersect(const Line& line) const {
     if (t == std::numeric_limits<double>::infinity()) {
         return std::nullopt;  // no valid intersection
     }
+    return Hit{t};
+}
 
-    Vector3D intersectionPoint = line(t);
-    Vector3D normal = (intersectionPoint - mPosition).Normalized();
+Intersection SphericalCap::ComputeSurfaceInteraction(const Line& line, const Hit& hit) const {
+    Vector3D intersectionPoint = line(hit.t);
+    Vector3D normal = (intersectionPoint - mPosition).NormalizedUnchecked();
 
-    return Intersection{t, intersectionPoint, normal};
+    return Intersection{hit.t, intersectionPoint, normal};
 }
 
 double SphericalCap::SurfaceArea() const {
     return 2.0 * M_PI * mRadius * mRadius;
 }
 
-std::vector<Vector3D> SphericalCap::SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const {
-    std::vector<Vector3D> points;
-
+Vector3D SphericalCap::SampleSurfacePoint(Sampler& sampler) const {
     std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
 
-    for (std::size_t i = 0; i < numPoints; ++i) {
-        double u = uniformDistribution(prng);
-        double v = uniformDistribution(prng);
+    double u = uniformDistribution(sampler);
+    double v = uniformDistribution(sampler);
 
-        double phi = 2.0 * M_PI * u;  // azimuthal angle [0, 2π]
-        double cosTheta = v;          // polar angle [0, π/2] - only hemisphere
-        double sinTheta = std::sqrt(1.0 - cosTheta * cosTheta);
+    double phi = 2.0 * M_PI * u;  // azimuthal angle [0, 2π]
+    double cosTheta = v;          // polar angle [0, π/2] - only hemisphere
+    double sinTheta = std::sqrt(1.0 - cosTheta * cosTheta);
 
-        // Point in local hemisphere coordinates (z+ is "up")
-        Vector3D localPoint = {
-            mRadius * sinTheta * std::cos(phi),
-            mRadius * sinTheta * std::sin(phi),
-            mRadius * cosTheta,
-        };
+    // Point in local hemisphere coordinates (z+ is "up")
+    Vector3D localPoint = {
+        static_cast<Real>(mRadius * sinTheta * std::cos(phi)),
+        static_cast<Real>(mRadius * sinTheta * std::sin(phi)),
+        static_cast<Real>(mRadius * cosTheta),
+    };
 
-        // Transform to world coordinates using orthonormal basis
-        Vector3D point = mOrthonormalBasis.ToGlobal(localPoint) + mPosition;
+    // Transform to world coordinates using orthonormal basis
+    Vector3D point = mTransform.ToGlobalPoint(localPoint);
 
-        points.push_back(point);
-    }
-    return points;
+    return point;
 }
 
-std::vector<Vector3D> SphericalCap::GetKeyPoints() const {
+std::vector<Vector3D> SphericalCap::ComputeKeyPoints() const {
     return {mPosition + mRadius * GetBasisVector(OrthonormalBasis::BasisVector::eZ)};
 }
 
+BoundingBox SphericalCap::ComputeBoundingBox() const {
+    // The cap's rim circle, plus the extremal points of the sphere that lie on the cap
+    const Vector3D& eZ = GetBasisVector(OrthonormalBasis::BasisVector::eZ);
+    double sinMaxAngle = std::sqrt(std::max(0.0, 1.0 - mCosMaxAngle * mCosMaxAngle));
+    BoundingBox box = BoundingBox::FromDisk(mPosition + mRadius * mCosMaxAngle * eZ, eZ, mRadius * sinMaxAngle);
+    for (std::size_t i = 0; i < 3; i++) {
+        for (double sign : {-1.0, 1.0}) {
+            if (sign * eZ[i] >= mCosMaxAngle) {
+                Vector3D extremalPoint = mPosition;
+                extremalPoint[i] += sign * mRadius;
+                box.Expand(extremalPoint);
+            }
+        }
+    }
+    return box;
+}
+
 std::pair<double, double> SphericalCap::GetSurfaceParameters(const Vector3D& point) const {
     // TODO: Implement preojection
     return {0.0, 0.0};
 }
 
+std::shared_ptr<Shape> SphericalCap::Clone() const {
+    return std::make_shared<SphericalCap>(*this);
+}
+
 void SphericalCap::PrintInfo() const {
     PrintInfoBase();
     std::cout << "\tRadius:\t" << mRadius << std::endl
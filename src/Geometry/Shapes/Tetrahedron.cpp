@@ -10,6 +10,12 @@ Tetrahedron::Tetrahedron(const Vector3D& center, const Vector3D& orientation, co
     ComposeShape();
 }
 
+std::shared_ptr<Shape> Tetrahedron::Clone() const {
+    auto clone = std::make_shared<Tetrahedron>(*this);
+    clone->CloneComponents();
+    return clone;
+}
+
 void Tetrahedron::PrintInfo() const {
     PrintInfoCompositeBase();
     std::cout << "\tEdge Length: " << mEdgeLength << std::endl
@@ -20,15 +26,19 @@ void Tetrahedron::ComposeShape() {
     mComponents.clear();
 
     // Define vertices relative to origin with base triangle centered at origin
+    const Real halfEdge = mEdgeLength / 2.0;
+    const Real inradius = mEdgeLength * std::sqrt(3.0) / 6.0;
+    const Real circumradius = mEdgeLength * std::sqrt(3.0) / 3.0;
+    const Real height = mEdgeLength * std::sqrt(6.0) / 3.0;
     std::array<Vector3D, 4> vertices = {
-        Vector3D({-mEdgeLength / 2.0, -mEdgeLength * std::sqrt(3.0) / 6.0, 0.0}),  // Base triangle vertex 1
-        Vector3D({mEdgeLength / 2.0, -mEdgeLength * std::sqrt(3.0) / 6.0, 0.0}),   // Base triangle vertex 2
-        Vector3D({0.0, mEdgeLength * std::sqrt(3.0) / 3.0, 0.0}),                  // Base triangle vertex 3
-        Vector3D({0.0, 0.0, mEdgeLength * std::sqrt(6.0) / 3.0})};                 // Apex vertex
+        Vector3D({-halfEdge, -inradius, 0.0}),  // Base triangle vertex 1
+        Vector3D({halfEdge, -inradius, 0.0}),   // Base triangle vertex 2
+        Vector3D({0.0, circumradius, 0.0}),     // Base triangle vertex 3
+        Vector3D({0.0, 0.0, height})};          // Apex vertex
 
     // Transform vertices to world coordinates (base triangle center at 'center' position)
     for (auto& vertex : vertices) {
-        vertex = mOrthonormalBasis.ToGlobal(vertex) + mPosition;
+        vertex = mTransform.ToGlobalPoint(vertex);
     }
 
     // Create triangles with correct winding for outward-pointing normals
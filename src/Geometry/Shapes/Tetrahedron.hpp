@@ -9,6 +9,8 @@ public:
     // Constructor (position is center of tetrahedron base triangle)
     Tetrahedron(const Vector3D& position, const Vector3D& orientation, const Vector3D& edgeDirection, double edgeLength);
 
+    virtual std::shared_ptr<Shape> Clone() const override;
+
     virtual void PrintInfo() const override;
 
 private:
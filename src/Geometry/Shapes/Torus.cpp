@@ -9,59 +9,49 @@ Torus::Torus(const Vector3D& position, const Vector3D& orientation, double major
     mMajorRadius(majorRadius),
     mMinorRadius(minorRadius) {}
 
-std::optional<Intersection> Torus::Intersect(const Line& line) const {
+std::optional<Hit> Torus::FindHit(const Line& line) const {
+    // Cheap rejection before solving the quartic equation
+    if (!line.IntersectsBoundingBox(GetBoundingBox())) {
+        return std::nullopt;
+    }
+
     // Line in world space
     Vector3D origin = line.GetOrigin();
     Vector3D direction = line.GetDirection();
 
     // Transform line to local torus coordinates (torus centered at origin, major circle in XY plane)
-    Vector3D O = mOrthonormalBasis.ToLocal(origin - mPosition);  // local origin
-    Vector3D D = mOrthonormalBasis.ToLocal(direction);           // local direction (NOT normalized on purpose)
-
-    auto quarticCoeffs = ComputeQuarticCoefficients(O, D);
-    std::vector<double> roots = Math::SolveQuarticDurandKerner(quarticCoeffs[0], quarticCoeffs[1], quarticCoeffs[2], quarticCoeffs[3], quarticCoeffs[4]);
+    Vector3D O = mTransform.ToLocalPoint(origin);         // local origin
+    Vector3D D = mTransform.ToLocalDirection(direction);  // local direction (NOT normalized on purpose)
 
-    // Filter roots: keep smallest t within [tMin + eps, tMax - eps]
-    double tMin = std::numeric_limits<double>::infinity();
-    for (double t : roots) {
-        if (!std::isfinite(t)) {
-            continue;
-        }
-        if (t < line.GetTMin() + sEpsilon) {
-            continue;
-        }
-        if (t < tMin) {
-            tMin = t;
-        }
-    }
-
-    if (tMin == std::numeric_limits<double>::infinity()) {
+    // The roots are in ascending order, so the first one is the closest intersection
+    Math::Roots<4> roots = ComputeIntersectionParameters(Vector<3, double>(O), Vector<3, double>(D), line.GetTMin() + sEpsilon);
+    if (roots.empty()) {
         return std::nullopt;
     }
+    return Hit{roots[0]};
+}
 
+Intersection Torus::ComputeSurfaceInteraction(const Line& line, const Hit& hit) const {
     // Compute local and global intersection point
-    Vector3D localPoint = O + D * tMin;
-    Vector3D globalPoint = mOrthonormalBasis.ToGlobal(localPoint) + mPosition;
-
-    // Transform normal to global space (assumes ToGlobal preserves directions, not positions)
-    Vector3D normal = ComputeNormalAtPoint(localPoint);
+    Vector3D O = mTransform.ToLocalPoint(line.GetOrigin());
+    Vector3D D = mTransform.ToLocalDirection(line.GetDirection());
+    Vector3D localPoint = O + D * hit.t;
+    Vector3D globalPoint = mTransform.ToGlobalPoint(localPoint);
 
-    return Intersection{tMin, globalPoint, normal};
+    return Intersection{hit.t, globalPoint, ComputeNormalAtPoint(localPoint)};
 }
 
 double Torus::SurfaceArea() const {
     return 4.0 * M_PI * M_PI * mMajorRadius * mMinorRadius;
 }
 
-std::vector<Vector3D> Torus::SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const {
-    std::vector<Vector3D> points;
-
+Vector3D Torus::SampleSurfacePoint(Sampler& sampler) const {
     std::uniform_real_distribution<double> dist(0.0, 1.0);
 
-    while (points.size() < numPoints) {
-        double u = dist(prng);
-        double v = dist(prng);
-        double w = dist(prng);
+    while (true) {
+        double u = dist(sampler);
+        double v = dist(sampler);
+        double w = dist(sampler);
 
         double theta = 2.0 * M_PI * u;
         double phi = 2.0 * M_PI * v;
@@ -72,18 +62,17 @@ std::vector<Vector3D> Torus::SampleSurfacePoints(std::size_t numPoints, std::mt1
             continue;
         }
 
-        double x = (mMajorRadius + mMinorRadius * std::cos(phi)) * std::cos(theta);
-        double y = (mMajorRadius + mMinorRadius * std::cos(phi)) * std::sin(theta);
-        double z = mMinorRadius * std::sin(phi);
+        Real x = (mMajorRadius + mMinorRadius * std::cos(phi)) * std::cos(theta);
+        Real y = (mMajorRadius + mMinorRadius * std::cos(phi)) * std::sin(theta);
+        Real z = mMinorRadius * std::sin(phi);
 
         Vector3D localPoint{x, y, z};
-        Vector3D globalPoint = mOrthonormalBasis.ToGlobal(localPoint) + mPosition;
-        points.push_back(globalPoint);
+        Vector3D globalPoint = mTransform.ToGlobalPoint(localPoint);
+        return globalPoint;
     }
-    return points;
 }
 
-std::vector<Vector3D> Torus::GetKeyPoints() const {
+std::vector<Vector3D> Torus::ComputeKeyPoints() const {
     return {mPosition,
             mPosition + GetBasisVector(OrthonormalBasis::BasisVector::eX) * mMajorRadius,
             mPosition - GetBasisVector(OrthonormalBasis::BasisVector::eX) * mMajorRadius,
@@ -91,10 +80,22 @@ std::vector<Vector3D> Torus::GetKeyPoints() const {
             mPosition - GetBasisVector(OrthonormalBasis::BasisVector::eY) * mMajorRadius};
 }
 
+BoundingBox Torus::ComputeBoundingBox() const {
+    // Major circle padded by the minor radius
+    BoundingBox circleBox = BoundingBox::FromDisk(mPosition, GetOrientation(), mMajorRadius);
+    const Real minorRadius = mMinorRadius;
+    Vector3D padding({minorRadius, minorRadius, minorRadius});
+    return BoundingBox(circleBox.GetMinimum() - padding, circleBox.GetMaximum() + padding);
+}
+
 std::pair<double, double> Torus::GetSurfaceParameters(const Vector3D& point) const {
     return {0.0, 0.0};
 }
 
+std::shared_ptr<Shape> Torus::Clone() const {
+    return std::make_shared<Torus>(*this);
+}
+
 void Torus::PrintInfo() const {
     PrintInfoBase();
     std::cout << "\tMajor Radius: " << mMajorRadius << std::endl
@@ -102,7 +103,7 @@ void Torus::PrintInfo() const {
               << std::endl;
 }
 
-std::array<double, 5> Torus::ComputeQuarticCoefficients(const Vector3D& localOrigin, const Vector3D& localDirection) const {
+std::array<double, 5> Torus::ComputeQuarticCoefficients(const Vector<3, double>& localOrigin, const Vector<3, double>& localDirection) const {
     double R = mMajorRadius;
     double r = mMinorRadius;
 
@@ -132,6 +133,32 @@ std::array<double, 5> Torus::ComputeQuarticCoefficients(const Vector3D& localOri
     return {a, b, c, d, e};
 }
 
+Math::Roots<4> Torus::ComputeIntersectionParameters(const Vector<3, double>& localOrigin, const Vector<3, double>& localDirection, double tMin) const {
+    // Early-out with the bounding sphere of radius R + r, which also bounds the interval that contains all roots
+    const double boundingRadius = mMajorRadius + mMinorRadius;
+    const double a = localDirection.Dot(localDirection);
+    const double halfB = localOrigin.Dot(localDirection);
+    const double c = localOrigin.Dot(localOrigin) - boundingRadius * boundingRadius;
+    const double discriminant = halfB * halfB - a * c;
+    if (discriminant < 0.0) {
+        return {};
+    }
+    const double sqrtDiscriminant = std::sqrt(discriminant);
+    const double tEnter = (-halfB - sqrtDiscriminant) / a;
+    const double tExit = (-halfB + sqrtDiscriminant) / a;
+    if (tExit < tMin) {
+        return {};
+    }
+
+    // Solve relative to the sphere entry point, which keeps the quartic's coefficients well conditioned for distant origins
+    auto coefficients = ComputeQuarticCoefficients(localOrigin + localDirection * tEnter, localDirection);
+    Math::Roots<4> roots = Math::SolveQuarticInInterval(coefficients, std::max(tMin, tEnter) - tEnter, tExit - tEnter);
+    for (std::size_t i = 0; i < roots.count; i++) {
+        roots.values[i] += tEnter;
+    }
+    return roots;
+}
+
 Vector3D Torus::ComputeNormalAtPoint(const Vector3D& localPoint) const {
     // Compute gradient of F(X) = (|X|^2 + R^2 - r^2)^2 - 4 R^2 (x^2 + y^2)
     // ∇F = (4 x Qp - 8 R^2 x, 4 y Qp - 8 R^2 y, 4 z Qp) where Qp = |X|^2 + R^2 - r^2
@@ -139,14 +166,13 @@ Vector3D Torus::ComputeNormalAtPoint(const Vector3D& localPoint) const {
     double r = mMinorRadius;
     double Qp = localPoint.Dot(localPoint) + R * R - r * r;
     Vector3D localNormal{
-        4.0 * localPoint[0] * Qp - 8.0 * R * R * localPoint[0],
-        4.0 * localPoint[1] * Qp - 8.0 * R * R * localPoint[1],
-        4.0 * localPoint[2] * Qp};
-    localNormal.Normalize();
-
-    // Transform normal to global space (assumes ToGlobal preserves directions, not positions)
-    Vector3D globalNormal = mOrthonormalBasis.ToGlobal(localNormal);
-    globalNormal.Normalize();
+        static_cast<Real>(4.0 * localPoint[0] * Qp - 8.0 * R * R * localPoint[0]),
+        static_cast<Real>(4.0 * localPoint[1] * Qp - 8.0 * R * R * localPoint[1]),
+        static_cast<Real>(4.0 * localPoint[2] * Qp)};
+
+    // The basis is orthonormal, so the rotation preserves lengths and a single normalization suffices
+    Vector3D globalNormal = mTransform.ToGlobalDirection(localNormal);
+    globalNormal.NormalizeUnchecked();
     return globalNormal;
 }
 
@@ -4,6 +4,7 @@
 #include "Geometry/Line.hpp"
 #include "Geometry/Shape.hpp"
 #include "Geometry/Vector.hpp"
+#include "Utilities/Math.hpp"
 
 #include <array>
 #include <optional>
@@ -16,21 +17,30 @@ class Torus : public Shape {
 public:
     Torus(const Vector3D& position, const Vector3D& orientation, double majorRadius, double minorRadius);
 
-    virtual std::optional<Intersection> Intersect(const Line& line) const override;
+    virtual std::optional<Hit> FindHit(const Line& line) const override;
+    virtual Intersection ComputeSurfaceInteraction(const Line& line, const Hit& hit) const override;
 
     virtual double SurfaceArea() const override;
-    virtual std::vector<Vector3D> SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const override;
+    virtual Vector3D SampleSurfacePoint(Sampler& sampler) const override;
 
-    virtual std::vector<Vector3D> GetKeyPoints() const override;
     virtual std::pair<double, double> GetSurfaceParameters(const Vector3D& point) const override;
 
+    virtual std::shared_ptr<Shape> Clone() const override;
+
     virtual void PrintInfo() const override;
 
 protected:
+    virtual BoundingBox ComputeBoundingBox() const override;
+    virtual std::vector<Vector3D> ComputeKeyPoints() const override;
+
     double mMajorRadius;
     double mMinorRadius;
 
-    std::array<double, 5> ComputeQuarticCoefficients(const Vector3D& localOrigin, const Vector3D& localDirection) const;
+    std::array<double, 5> ComputeQuarticCoefficients(const Vector<3, double>& localOrigin, const Vector<3, double>& localDirection) const;
+
+    // Line parameters t >= tMin of all intersections with the full torus in ascending order.
+    // The quartic is ill-conditioned, so it is set up in double precision also in single precision builds.
+    Math::Roots<4> ComputeIntersectionParameters(const Vector<3, double>& localOrigin, const Vector<3, double>& localDirection, double tMin) const;
     Vector3D ComputeNormalAtPoint(const Vector3D& localPoint) const;
 };
 
@@ -1,27 +1,25 @@
 #include "Geometry/Shapes/Triangle.hpp"
 
+#include "Geometry/PacketKernels.hpp"
+
 namespace Raytracer::Geometry {
 
 Triangle::Triangle(const Vector3D& vertex1, const Vector3D& vertex2, const Vector3D& vertex3) :
     Shape(Type::TRIANGLE, (vertex1 + vertex2 + vertex3) / 3.0, (vertex2 - vertex1).Cross(vertex3 - vertex1).Normalized(), (vertex2 - vertex1).Normalized()) {
     // Store vertices in local coordinate system (transformed through orthonormal basis)
-    Vector3D relVertex1 = vertex1 - mPosition;
-    Vector3D relVertex2 = vertex2 - mPosition;
-    Vector3D relVertex3 = vertex3 - mPosition;
-
-    mVertices[0] = mOrthonormalBasis.ToLocal(relVertex1);
-    mVertices[1] = mOrthonormalBasis.ToLocal(relVertex2);
-    mVertices[2] = mOrthonormalBasis.ToLocal(relVertex3);
+    mVertices[0] = mTransform.ToLocalPoint(vertex1);
+    mVertices[1] = mTransform.ToLocalPoint(vertex2);
+    mVertices[2] = mTransform.ToLocalPoint(vertex3);
     mEdges[0] = mVertices[1] - mVertices[0];
     mEdges[1] = mVertices[2] - mVertices[0];
 }
 
-std::optional<Intersection> Triangle::Intersect(const Line& line) const {
+std::optional<Hit> Triangle::FindHit(const Line& line) const {
     // Algorithm: Möller–Trumbore intersection algorithm
     // Perform calculations in local coordinate system with mPosition at origin
 
-    Vector3D origin = mOrthonormalBasis.ToLocal(line.GetOrigin() - mPosition);
-    Vector3D direction = mOrthonormalBasis.ToLocal(line.GetDirection());
+    Vector3D origin = mTransform.ToLocalPoint(line.GetOrigin());
+    Vector3D direction = mTransform.ToLocalDirection(line.GetDirection());
 
     // Möller–Trumbore intersection algorithm in local coordinates
     Vector3D h = direction.Cross(mEdges[1]);
@@ -49,73 +47,122 @@ std::optional<Intersection> Triangle::Intersect(const Line& line) const {
     double t = invDet * mEdges[1].Dot(q);
 
     if (t > line.GetTMin()) {
-        // Transform intersection point back to world coordinates
-        Vector3D localIntersection = origin + t * direction;
-        Vector3D worldIntersection = mPosition + mOrthonormalBasis.ToGlobal(localIntersection);
-
-        // Normal is always the Z-axis of the orthonormal basis
-        Vector3D normal = mOrthonormalBasis.GetBasisVector(OrthonormalBasis::BasisVector::eZ);
-
-        return Intersection{t, worldIntersection, normal};
+        return Hit{t, 0, 0, u, v};
     } else {
         return std::nullopt;
     }
 }
 
+Intersection Triangle::ComputeSurfaceInteraction(const Line& line, const Hit& hit) const {
+    // Transform intersection point back to world coordinates
+    Vector3D origin = mTransform.ToLocalPoint(line.GetOrigin());
+    Vector3D direction = mTransform.ToLocalDirection(line.GetDirection());
+    Vector3D localIntersection = origin + hit.t * direction;
+    Vector3D worldIntersection = mTransform.ToGlobalPoint(localIntersection);
+
+    // Normal is always the Z-axis of the orthonormal basis
+    Vector3D normal = mOrthonormalBasis.GetBasisVector(OrthonormalBasis::BasisVector::eZ);
+
+    return Intersection{hit.t, worldIntersection, normal};
+}
+
+void Triangle::FindHits(const LinePacket& packet, PacketHits& hits) const {
+    std::array<LinePacket::Lanes, 3> origin;
+    std::array<LinePacket::Lanes, 3> direction;
+    mTransform.ToLocal(packet, origin, direction);
+
+    hits.Clear();
+    PacketKernels::IntersectTriangle(packet, origin, direction, mVertices[0], mEdges, sEpsilon, hits.t, hits.u, hits.v);
+}
+
+bool Triangle::Occluded(const Line& line, double tMin, double tMax) const {
+    // Same Möller–Trumbore test as in FindHit(), without transforming the hit back to world coordinates
+    Vector3D origin = mTransform.ToLocalPoint(line.GetOrigin());
+    Vector3D direction = mTransform.ToLocalDirection(line.GetDirection());
+
+    Vector3D h = direction.Cross(mEdges[1]);
+    double det = mEdges[0].Dot(h);
+    if (std::fabs(det) < sEpsilon) {
+        return false;
+    }
+
+    double invDet = 1.0 / det;
+    Vector3D s = origin - mVertices[0];
+    double u = invDet * s.Dot(h);
+    if ((u < 0.0 && std::abs(u) > sEpsilon) || (u > 1.0 && std::abs(u - 1.0) > sEpsilon)) {
+        return false;
+    }
+
+    Vector3D q = s.Cross(mEdges[0]);
+    double v = invDet * direction.Dot(q);
+    if ((v < 0.0 && std::abs(v) > sEpsilon) || (u + v > 1.0 && std::abs(u + v - 1.0) > sEpsilon)) {
+        return false;
+    }
+
+    double t = invDet * mEdges[1].Dot(q);
+    return t > line.GetTMin() && t > tMin && t < tMax;
+}
+
 double Triangle::SurfaceArea() const {
     // Area = 0.5 * |e1 x e2|
     return 0.5 * mEdges[0].Cross(mEdges[1]).Norm();
 }
 
-std::vector<Vector3D> Triangle::SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const {
-    std::vector<Vector3D> points;
-
+Vector3D Triangle::SampleSurfacePoint(Sampler& sampler) const {
     std::uniform_real_distribution<double> dist(0.0, 1.0);
 
-    for (std::size_t i = 0; i < numPoints; ++i) {
-        double u = dist(prng);
-        double v = dist(prng);
-
-        // Ensure the point is inside the triangle
-        if (u + v > 1.0) {
-            u = 1.0 - u;
-            v = 1.0 - v;
-        }
+    double u = dist(sampler);
+    double v = dist(sampler);
 
-        // Sample point in local coordinates
-        Vector3D localPoint = mVertices[0] + u * mEdges[0] + v * mEdges[1];
-
-        // Transform to world coordinates
-        Vector3D worldPoint = mPosition + mOrthonormalBasis.ToGlobal(localPoint);
-        points.push_back(worldPoint);
+    // Ensure the point is inside the triangle
+    if (u + v > 1.0) {
+        u = 1.0 - u;
+        v = 1.0 - v;
     }
 
-    return points;
+    // Sample point in local coordinates
+    Vector3D localPoint = mVertices[0] + u * mEdges[0] + v * mEdges[1];
+
+    // Transform to world coordinates
+    Vector3D worldPoint = mTransform.ToGlobalPoint(localPoint);
+    return worldPoint;
 }
 
-std::vector<Vector3D> Triangle::GetKeyPoints() const {
+std::vector<Vector3D> Triangle::ComputeKeyPoints() const {
     std::vector<Vector3D> keyPoints;
 
     // Transform vertices from local to world coordinates
     keyPoints.push_back(mPosition);  // Center point
-    keyPoints.push_back(mPosition + mOrthonormalBasis.ToGlobal(mVertices[0]));
-    keyPoints.push_back(mPosition + mOrthonormalBasis.ToGlobal(mVertices[1]));
-    keyPoints.push_back(mPosition + mOrthonormalBasis.ToGlobal(mVertices[2]));
+    keyPoints.push_back(mTransform.ToGlobalPoint(mVertices[0]));
+    keyPoints.push_back(mTransform.ToGlobalPoint(mVertices[1]));
+    keyPoints.push_back(mTransform.ToGlobalPoint(mVertices[2]));
 
     return keyPoints;
 }
 
+BoundingBox Triangle::ComputeBoundingBox() const {
+    BoundingBox box;
+    for (const auto& vertex : mVertices) {
+        box.Expand(mTransform.ToGlobalPoint(vertex));
+    }
+    return box;
+}
+
 std::pair<double, double> Triangle::GetSurfaceParameters(const Vector3D& point) const {
     // TODO: Implement
     return {0.0, 0.0};
 }
 
+std::shared_ptr<Shape> Triangle::Clone() const {
+    return std::make_shared<Triangle>(*this);
+}
+
 void Triangle::PrintInfo() const {
     PrintInfoBase();
     std::cout << "Vertices (world coordinates):" << std::endl
-              << "\tV1: " << mPosition + mOrthonormalBasis.ToGlobal(mVertices[0]) << std::endl
-              << "\tV2: " << mPosition + mOrthonormalBasis.ToGlobal(mVertices[1]) << std::endl
-              << "\tV3: " << mPosition + mOrthonormalBasis.ToGlobal(mVertices[2]) << std::endl
+              << "\tV1: " << mTransform.ToGlobalPoint(mVertices[0]) << std::endl
+              << "\tV2: " << mTransform.ToGlobalPoint(mVertices[1]) << std::endl
+              << "\tV3: " << mTransform.ToGlobalPoint(mVertices[2]) << std::endl
               << std::endl;
 }
 
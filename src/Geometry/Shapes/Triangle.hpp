@@ -15,18 +15,25 @@ class Triangle : public Shape {
 public:
     Triangle(const Vector3D& vertex1, const Vector3D& vertex2, const Vector3D& vertex3);
 
-    std::optional<Intersection> Intersect(const Line& line) const override;
+    std::optional<Hit> FindHit(const Line& line) const override;
+    Intersection ComputeSurfaceInteraction(const Line& line, const Hit& hit) const override;
+    void FindHits(const LinePacket& packet, PacketHits& hits) const override;
+    bool Occluded(const Line& line, double tMin, double tMax) const override;
 
     double SurfaceArea() const override;
 
-    std::vector<Vector3D> SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const override;
-
-    std::vector<Vector3D> GetKeyPoints() const override;
+    Vector3D SampleSurfacePoint(Sampler& sampler) const override;
 
     std::pair<double, double> GetSurfaceParameters(const Vector3D& point) const override;
 
+    std::shared_ptr<Shape> Clone() const override;
+
     void PrintInfo() const override;
 
+protected:
+    BoundingBox ComputeBoundingBox() const override;
+    std::vector<Vector3D> ComputeKeyPoints() const override;
+
 private:
     std::array<Vector3D, 3> mVertices;  // Local coordinates of the triangle's vertices relative to mPosition
     std::array<Vector3D, 2> mEdges;     // Edges in local coordinates
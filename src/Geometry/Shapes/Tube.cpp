@@ -8,7 +8,7 @@ Tube::Tube(const Vector3D& position, const Vector3D& orientation, double radius,
     mLength(length) {
 }
 
-std::optional<Intersection> Tube::Intersect(const Line& line) const {
+std::optional<Hit> Tube::FindHit(const Line& line) const {
     Vector3D orientation = GetOrientation();
     Vector3D d = line.GetDirection();
     Vector3D oc = line.GetOrigin() - mPosition;
@@ -48,42 +48,35 @@ std::optional<Intersection> Tube::Intersect(const Line& line) const {
     if (tCylinder == std::numeric_limits<double>::infinity()) {
         return std::nullopt;  // No valid root
     }
+    return Hit{tCylinder};
+}
 
-    // Check if the intersection point is within the height bounds
-    Vector3D intersectionPoint = line(tCylinder);
+Intersection Tube::ComputeSurfaceInteraction(const Line& line, const Hit& hit) const {
+    Vector3D orientation = GetOrientation();
+    Vector3D intersectionPoint = line(hit.t);
     double heightAtIntersection = (intersectionPoint - mPosition).Dot(orientation);
-    if (std::abs(heightAtIntersection) <= mLength / 2.0) {
-        Vector3D normalAtHit = (intersectionPoint - mPosition - heightAtIntersection * orientation).Normalized();
-        return Intersection{tCylinder, intersectionPoint, normalAtHit};
-    }
-
-    return std::nullopt;
+    Vector3D normalAtHit = (intersectionPoint - mPosition - heightAtIntersection * orientation).NormalizedUnchecked();
+    return Intersection{hit.t, intersectionPoint, normalAtHit};
 }
 
 double Tube::SurfaceArea() const {
     return 2 * M_PI * mRadius * mLength;
 }
 
-std::vector<Vector3D> Tube::SampleSurfacePoints(std::size_t numPoints, std::mt19937& prng) const {
-    std::vector<Vector3D> points;
-
+Vector3D Tube::SampleSurfacePoint(Sampler& sampler) const {
     // Distributions for uniform sampling
     std::uniform_real_distribution<double> angleDist(0.0, 2.0 * M_PI);
     std::uniform_real_distribution<double> lengthDist(-0.5 * mLength, 0.5 * mLength);
 
-    for (std::size_t i = 0; i < numPoints; ++i) {
-        double theta = angleDist(prng);
-        double h = lengthDist(prng);
+    double theta = angleDist(sampler);
+    double h = lengthDist(sampler);
 
-        // Point on circle of given height
-        Vector3D circlePoint = mPosition + mRadius * (std::cos(theta) * GetBasisVector(OrthonormalBasis::BasisVector::eX) + std::sin(theta) * GetBasisVector(OrthonormalBasis::BasisVector::eY)) + GetBasisVector(OrthonormalBasis::BasisVector::eZ) * h;
-        points.push_back(circlePoint);
-    }
-
-    return points;
+    // Point on circle of given height
+    Vector3D circlePoint = mPosition + mRadius * (std::cos(theta) * GetBasisVector(OrthonormalBasis::BasisVector::eX) + std::sin(theta) * GetBasisVector(OrthonormalBasis::BasisVector::eY)) + GetBasisVector(OrthonormalBasis::BasisVector::eZ) * h;
+    return circlePoint;
 }
 
-std::vector<Vector3D> Tube::GetKeyPoints() const {
+std::vector<Vector3D> Tube::ComputeKeyPoints() const {
     auto eZ = GetBasisVector(OrthonormalBasis::BasisVector::eZ);
     std::vector<Vector3D> keyPoints = {
         mPosition,
@@ -95,11 +88,22 @@ std::vector<Vector3D> Tube::GetKeyPoints() const {
     return keyPoints;
 }
 
+BoundingBox Tube::ComputeBoundingBox() const {
+    Vector3D halfAxis = 0.5 * mLength * GetOrientation();
+    BoundingBox box = BoundingBox::FromDisk(mPosition + halfAxis, GetOrientation(), mRadius);
+    box.Expand(BoundingBox::FromDisk(mPosition - halfAxis, GetOrientation(), mRadius));
+    return box;
+}
+
 std::pair<double, double> Tube::GetSurfaceParameters(const Vector3D& point) const {
     // TODO: Implement projection
     return {0.0, 0.0};
 }
 
+std::shared_ptr<Shape> Tube::Clone() const {
+    return std::make_shared<Tube>(*this);
+}
+
 void Tube::PrintInfo() const {
     PrintInfoBase();
     std::cout << "\tRadius:\t" << mRadius << std::endl
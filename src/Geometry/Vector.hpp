@@ -1,27 +1,48 @@
 #pragma once
 
+#include "Utilities/Real.hpp"
+#include "Utilities/Simd.hpp"
+
 #include <array>
 #include <cmath>
 #include <format>
 #include <initializer_list>
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
 
 namespace Raytracer {
 
+// Vectors with two to four components are stored in SIMD registers if the target has wide enough registers, see Utilities/Simd.hpp.
+// Three components are then padded to four lanes, and the padding lane is always zero. The reductions (dot product, norm) add the
+// components in order, so the results are the same as with scalar code.
 template <std::size_t N, typename T = double>
 class Vector {
 public:
     Vector() = default;
 
-    explicit Vector(const std::array<T, N>& values) :
-        data(values) {}
+    explicit Vector(const std::array<T, N>& values) {
+        for (std::size_t i = 0; i < N; ++i) {
+            data[i] = values[i];
+        }
+    }
+
+    // Conversion between precisions, e.g. to evaluate ill-conditioned expressions in double precision
+    template <typename U>
+    explicit Vector(const Vector<N, U>& other) {
+        for (std::size_t i = 0; i < N; ++i) {
+            data[i] = static_cast<T>(other[i]);
+        }
+    }
 
     Vector(std::initializer_list<T> values) {
         if (values.size() != N) {
             throw std::invalid_argument("Initializer list size must match dimension");
         }
-        std::copy(values.begin(), values.end(), data.begin());
+        std::size_t i = 0;
+        for (const T& value : values) {
+            data[i++] = value;
+        }
     }
 
     // Element access
@@ -34,44 +55,51 @@ public:
 
     // Basic arithmetic
     Vector& operator+=(const Vector& other) {
-        for (std::size_t i = 0; i < N; ++i) {
-            data[i] += other[i];
-        }
+        Simd::AddAssign<T, N>(data, other.data);
         return *this;
     }
 
     Vector& operator-=(const Vector& other) {
-        for (std::size_t i = 0; i < N; ++i) {
-            data[i] -= other[i];
-        }
+        Simd::SubtractAssign<T, N>(data, other.data);
         return *this;
     }
 
     Vector& operator*=(const T& scalar) {
-        for (auto& x : data) {
-            x *= scalar;
-        }
+        Simd::MultiplyAssign<T, N>(data, scalar);
         return *this;
     }
 
     Vector& operator/=(const T& scalar) {
-        for (auto& x : data) {
-            x /= scalar;
-        }
+        Simd::DivideAssign<T, N>(data, scalar);
         return *this;
     }
 
     bool operator==(const Vector& other) const {
-        return data == other.data;
+        for (std::size_t i = 0; i < N; ++i) {
+            if (data[i] != other.data[i]) {
+                return false;
+            }
+        }
+        return true;
     }
 
     // Norms
     T Dot(const Vector& other) const {
-        T result{};
-        for (std::size_t i = 0; i < N; ++i) {
-            result += data[i] * other[i];
+        return Simd::Dot<T, N>(data, other.data);
+    }
+
+    // Dot product with fused multiply-adds where the hardware has them. It is rounded once per component instead of twice, so it may
+    // differ from Dot() in the last bit and is meant for code that does not need to reproduce the results of Dot() exactly.
+    T FusedDot(const Vector& other) const {
+        if constexpr (kFastFMA) {
+            T result = data[0] * other.data[0];
+            for (std::size_t i = 1; i < N; ++i) {
+                result = std::fma(data[i], other.data[i], result);
+            }
+            return result;
+        } else {
+            return Dot(other);
         }
-        return result;
     }
 
     T NormSquared() const {
@@ -100,36 +128,72 @@ public:
         return v;
     }
 
+    // Variants without the zero check for hot loops in which the vector cannot vanish, e.g. normals at valid hits or sampled directions.
+    // They give the same results as Normalize() and Normalized(), a zero vector turns into NaNs.
+    void NormalizeUnchecked() noexcept {
+        *this /= Norm();
+    }
+
+    [[nodiscard]] Vector NormalizedUnchecked() const noexcept {
+        Vector v = *this;
+        v /= Norm();
+        return v;
+    }
+
     // Cross product
     Vector Cross(const Vector& other) const {
         static_assert(N == 3, "Cross product is only defined in 3D");
-        return Vector{data[1] * other[2] - data[2] * other[1],
-                      data[2] * other[0] - data[0] * other[2],
-                      data[0] * other[1] - data[1] * other[0]};
+        Vector result;
+        if constexpr (kVectorized) {
+            // (y, z, x) * (z, x, y) - (z, x, y) * (y, z, x), the padding lane stays in place and zero
+            const Storage a1 = __builtin_shufflevector(data, data, 1, 2, 0, 3);
+            const Storage a2 = __builtin_shufflevector(data, data, 2, 0, 1, 3);
+            const Storage b1 = __builtin_shufflevector(other.data, other.data, 1, 2, 0, 3);
+            const Storage b2 = __builtin_shufflevector(other.data, other.data, 2, 0, 1, 3);
+            result.data = a1 * b2 - a2 * b1;
+        } else {
+            result.data[0] = data[1] * other.data[2] - data[2] * other.data[1];
+            result.data[1] = data[2] * other.data[0] - data[0] * other.data[2];
+            result.data[2] = data[0] * other.data[1] - data[1] * other.data[0];
+        }
+        return result;
     }
 
     // Iterators
-    auto begin() {
-        return data.begin();
+    T* begin() {
+        return &data[0];
     }
-    auto end() {
-        return data.end();
+    T* end() {
+        return &data[0] + N;
     }
-    auto begin() const {
-        return data.begin();
+    const T* begin() const {
+        return &data[0];
     }
-    auto end() const {
-        return data.end();
+    const T* end() const {
+        return &data[0] + N;
     }
 
 private:
-    std::array<T, N> data{};
+    static constexpr bool kVectorized = Simd::kVectorized<T, N>;
+    using Storage = Simd::Storage<T, N>;
+
+#if defined(FP_FAST_FMA) && defined(FP_FAST_FMAF)
+    static constexpr bool kFastFMA = true;
+#elif defined(FP_FAST_FMA)
+    static constexpr bool kFastFMA = std::is_same_v<T, double>;
+#elif defined(FP_FAST_FMAF)
+    static constexpr bool kFastFMA = std::is_same_v<T, float>;
+#else
+    static constexpr bool kFastFMA = false;
+#endif
+
+    Storage data{};
 };
 
-using Vector2D = Vector<2, double>;
-using Vector3D = Vector<3, double>;
+using Vector2D = Vector<2, Real>;
+using Vector3D = Vector<3, Real>;
 
-// Free operators
+// Free operators. The scalar is not deduced, so that e.g. a double scales a single precision vector.
 template <std::size_t N, typename T>
 Vector<N, T> operator+(Vector<N, T> lhs, const Vector<N, T>& rhs) {
     lhs += rhs;
@@ -143,19 +207,19 @@ Vector<N, T> operator-(Vector<N, T> lhs, const Vector<N, T>& rhs) {
 }
 
 template <std::size_t N, typename T>
-Vector<N, T> operator*(Vector<N, T> v, const T& scalar) {
+Vector<N, T> operator*(Vector<N, T> v, const std::type_identity_t<T>& scalar) {
     v *= scalar;
     return v;
 }
 
 template <std::size_t N, typename T>
-Vector<N, T> operator*(const T& scalar, Vector<N, T> v) {
+Vector<N, T> operator*(const std::type_identity_t<T>& scalar, Vector<N, T> v) {
     v *= scalar;
     return v;
 }
 
 template <std::size_t N, typename T>
-Vector<N, T> operator/(Vector<N, T> v, const T& scalar) {
+Vector<N, T> operator/(Vector<N, T> v, const std::type_identity_t<T>& scalar) {
     v /= scalar;
     return v;
 }
@@ -0,0 +1,193 @@
+#include "Rendering/AccumulationBuffer.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace Raytracer {
+
+AccumulationBuffer::AccumulationBuffer(std::size_t width, std::size_t height, bool trackVariance) :
+    AccumulationBuffer(width, height, 0, height, trackVariance) {
+}
+
+AccumulationBuffer::AccumulationBuffer(std::size_t width, std::size_t height, std::size_t firstRow, std::size_t endRow, bool trackVariance) :
+    mWidth(width),
+    mHeight(height),
+    mFirstRow(firstRow),
+    mEndRow(endRow),
+    mTrackVariance(trackVariance) {
+    if (mWidth == 0 || mHeight == 0) {
+        throw std::invalid_argument("AccumulationBuffer dimensions must be positive (non-zero).");
+    }
+    if (mFirstRow > mEndRow || mEndRow > mHeight) {
+        throw std::invalid_argument("AccumulationBuffer rows must lie within the image.");
+    }
+    constexpr std::size_t pixelsPerCacheLine = kCacheLineSize / sizeof(Pixel);
+    mStride = (mWidth + pixelsPerCacheLine - 1) / pixelsPerCacheLine * pixelsPerCacheLine;
+    mPixels.resize(mStride * (mEndRow - mFirstRow));
+    if (mTrackVariance) {
+        mMoments.resize(mStride * (mEndRow - mFirstRow));
+    }
+}
+
+std::size_t AccumulationBuffer::GetWidth() const {
+    return mWidth;
+}
+
+std::size_t AccumulationBuffer::GetHeight() const {
+    return mHeight;
+}
+
+std::size_t AccumulationBuffer::GetFirstRow() const {
+    return mFirstRow;
+}
+
+std::size_t AccumulationBuffer::GetEndRow() const {
+    return mEndRow;
+}
+
+bool AccumulationBuffer::TracksVariance() const {
+    return mTrackVariance;
+}
+
+Color AccumulationBuffer::GetMean(std::size_t x, std::size_t y) const {
+    const Pixel& pixel = mPixels[Index(x, y)];
+    if (pixel.sampleCount == 0.0f) {
+        return Color(0.0, 0.0, 0.0);
+    }
+    const double count = pixel.sampleCount;
+    return Color(pixel.r / count, pixel.g / count, pixel.b / count);
+}
+
+std::size_t AccumulationBuffer::GetSampleCount(std::size_t x, std::size_t y) const {
+    return static_cast<std::size_t>(mPixels[Index(x, y)].sampleCount);
+}
+
+double AccumulationBuffer::GetRelativeError(std::size_t x, std::size_t y) const {
+    const double count = mPixels[Index(x, y)].sampleCount;
+    if (mMoments.empty() || count < 2.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    const Moments& moments = mMoments[Index(x, y)];
+    const double variance = std::max(0.0, double(moments.m2) / (count - 1.0));
+    const double standardError = std::sqrt(variance / count);
+    return standardError / std::max(double(moments.mean), kMinimumLuminance);
+}
+
+void AccumulationBuffer::Clear() {
+    std::fill(mPixels.begin(), mPixels.end(), Pixel{});
+    std::fill(mMoments.begin(), mMoments.end(), Moments{});
+}
+
+void AccumulationBuffer::CopyRegion(const AccumulationBuffer& source, std::size_t xBegin, std::size_t xEnd, std::size_t yBegin, std::size_t yEnd) {
+    if (source.mWidth != mWidth || source.mHeight != mHeight || source.mFirstRow != mFirstRow || source.mEndRow != mEndRow ||
+        source.TracksVariance() != TracksVariance()) {
+        throw std::invalid_argument("AccumulationBuffer::CopyRegion: Buffers do not match.");
+    }
+    xEnd = std::min(xEnd, mWidth);
+    yBegin = std::max(yBegin, mFirstRow);
+    yEnd = std::min(yEnd, mEndRow);
+    for (std::size_t y = yBegin; y < yEnd; y++) {
+        const std::size_t begin = Index(xBegin, y);
+        const std::size_t end = Index(xEnd, y);
+        std::copy(source.mPixels.begin() + begin, source.mPixels.begin() + end, mPixels.begin() + begin);
+        if (!mMoments.empty()) {
+            std::copy(source.mMoments.begin() + begin, source.mMoments.begin() + end, mMoments.begin() + begin);
+        }
+    }
+}
+
+void AccumulationBuffer::Merge(const AccumulationBuffer& other) {
+    if (other.mWidth != mWidth || other.mHeight != mHeight || other.mFirstRow < mFirstRow || other.mEndRow > mEndRow ||
+        other.TracksVariance() != TracksVariance()) {
+        throw std::invalid_argument("AccumulationBuffer::Merge: Buffers do not match.");
+    }
+    // Both buffers have the same stride, so the other band is a contiguous range of this one
+    const std::size_t offset = Index(0, other.mFirstRow);
+    for (std::size_t j = 0; j < other.mPixels.size(); j++) {
+        const std::size_t i = offset + j;
+        Pixel& pixel = mPixels[i];
+        const Pixel& otherPixel = other.mPixels[j];
+        if (otherPixel.sampleCount == 0.0f) {
+            continue;
+        }
+        if (!mMoments.empty()) {
+            Moments& moments = mMoments[i];
+            const Moments& otherMoments = other.mMoments[j];
+            const float count = pixel.sampleCount + otherPixel.sampleCount;
+            const float delta = otherMoments.mean - moments.mean;
+            moments.mean += delta * otherPixel.sampleCount / count;
+            moments.m2 += otherMoments.m2 + delta * delta * pixel.sampleCount * otherPixel.sampleCount / count;
+        }
+        pixel.r += otherPixel.r;
+        pixel.g += otherPixel.g;
+        pixel.b += otherPixel.b;
+        pixel.sampleCount += otherPixel.sampleCount;
+    }
+}
+
+void AccumulationBuffer::Write(std::ostream& stream) const {
+    const std::uint64_t header[5] = {mWidth, mHeight, mFirstRow, mEndRow, TracksVariance() ? 1u : 0u};
+    stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+    for (std::size_t y = mFirstRow; y < mEndRow; y++) {
+        stream.write(reinterpret_cast<const char*>(&mPixels[Index(0, y)]), mWidth * sizeof(Pixel));
+        if (!mMoments.empty()) {
+            stream.write(reinterpret_cast<const char*>(&mMoments[Index(0, y)]), mWidth * sizeof(Moments));
+        }
+    }
+}
+
+AccumulationBuffer AccumulationBuffer::Read(std::istream& stream) {
+    std::uint64_t header[5];
+    if (!stream.read(reinterpret_cast<char*>(header), sizeof(header))) {
+        throw std::runtime_error("AccumulationBuffer::Read: Unexpected end of stream.");
+    }
+    AccumulationBuffer buffer(header[0], header[1], header[2], header[3], header[4] != 0);
+    for (std::size_t y = buffer.mFirstRow; y < buffer.mEndRow; y++) {
+        stream.read(reinterpret_cast<char*>(&buffer.mPixels[buffer.Index(0, y)]), buffer.mWidth * sizeof(Pixel));
+        if (!buffer.mMoments.empty()) {
+            stream.read(reinterpret_cast<char*>(&buffer.mMoments[buffer.Index(0, y)]), buffer.mWidth * sizeof(Moments));
+        }
+    }
+    if (!stream) {
+        throw std::runtime_error("AccumulationBuffer::Read: Unexpected end of stream.");
+    }
+    return buffer;
+}
+
+std::size_t AccumulationBuffer::SerializedSize(std::size_t width, std::size_t numberOfRows, bool trackVariance) {
+    return 5 * sizeof(std::uint64_t) + width * numberOfRows * (sizeof(Pixel) + (trackVariance ? sizeof(Moments) : 0));
+}
+
+void AccumulationBuffer::Resolve(Image& image) const {
+    if (image.GetWidth() != mWidth || image.GetHeight() != mHeight) {
+        throw std::invalid_argument("AccumulationBuffer::Resolve: Image size does not match the buffer.");
+    }
+#pragma omp parallel for
+    for (std::size_t y = mFirstRow; y < mEndRow; y++) {
+        for (std::size_t x = 0; x < mWidth; x++) {
+            image.SetPixel(x, y, GetMean(x, y));
+        }
+    }
+}
+
+Image AccumulationBuffer::CreateSampleCountImage() const {
+    float maximumCount = 0.0f;
+    for (const Pixel& pixel : mPixels) {
+        maximumCount = std::max(maximumCount, pixel.sampleCount);
+    }
+    Image image(mWidth, mHeight);
+    if (maximumCount == 0.0f) {
+        return image;
+    }
+    for (std::size_t y = mFirstRow; y < mEndRow; y++) {
+        for (std::size_t x = 0; x < mWidth; x++) {
+            const double value = mPixels[Index(x, y)].sampleCount / maximumCount;
+            image.SetPixel(x, y, Color(value, value, value));
+        }
+    }
+    return image;
+}
+
+}  // namespace Raytracer
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Utilities/AlignedAllocator.hpp"
+#include "Utilities/Color.hpp"
+#include "Utilities/Image.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <istream>
+#include <ostream>
+
+namespace Raytracer {
+
+// Flat, cache-line aligned buffer that accumulates the radiance samples of every pixel in single precision.
+// Each row of the pixel array is padded to a whole number of cache lines, so tiles whose width is a multiple of four pixels never share a
+// cache line of it. The variance moments take half the space per pixel and use the same stride, so their tiles can share cache lines.
+// Optionally, the running mean and variance of each pixel's luminance are tracked (Welford's algorithm) to estimate the per-pixel error for adaptive sampling.
+// A buffer may store only a band of rows of the image, e.g. the tiles of one render shard. Pixels are still addressed by their position in the whole image and must lie in the band.
+class AccumulationBuffer {
+public:
+    struct alignas(16) Pixel {
+        float r = 0.0f;
+        float g = 0.0f;
+        float b = 0.0f;
+        float sampleCount = 0.0f;
+    };
+
+    AccumulationBuffer(std::size_t width, std::size_t height, bool trackVariance = false);
+    // Store only the rows [firstRow, endRow) of a width x height image
+    AccumulationBuffer(std::size_t width, std::size_t height, std::size_t firstRow, std::size_t endRow, bool trackVariance = false);
+
+    std::size_t GetWidth() const;
+    std::size_t GetHeight() const;
+    std::size_t GetFirstRow() const;
+    std::size_t GetEndRow() const;
+    bool TracksVariance() const;
+
+    void AddSample(std::size_t x, std::size_t y, const Color& color) {
+        AddSamples(x, y, color, 1);
+        if (!mMoments.empty()) {
+            Moments& moments = mMoments[Index(x, y)];
+            const float luminance = static_cast<float>(color.Luminance());
+            const float delta = luminance - moments.mean;
+            moments.mean += delta / mPixels[Index(x, y)].sampleCount;
+            moments.m2 += delta * (luminance - moments.mean);
+        }
+    }
+
+    // Add the sum of several samples at once. This does not update the variance estimate.
+    void AddSamples(std::size_t x, std::size_t y, const Color& colorSum, std::size_t numSamples) {
+        Pixel& pixel = mPixels[Index(x, y)];
+        pixel.r += static_cast<float>(colorSum.R());
+        pixel.g += static_cast<float>(colorSum.G());
+        pixel.b += static_cast<float>(colorSum.B());
+        pixel.sampleCount += static_cast<float>(numSamples);
+    }
+
+    Color GetMean(std::size_t x, std::size_t y) const;
+    std::size_t GetSampleCount(std::size_t x, std::size_t y) const;
+
+    // Standard error of the mean luminance relative to the mean luminance. Infinite for fewer than two samples or if the variance is not tracked.
+    double GetRelativeError(std::size_t x, std::size_t y) const;
+
+    void Clear();
+
+    // Copy the pixels of the region [xBegin, xEnd) x [yBegin, yEnd) from a buffer of the same size and band
+    void CopyRegion(const AccumulationBuffer& source, std::size_t xBegin, std::size_t xEnd, std::size_t yBegin, std::size_t yEnd);
+
+    // Add the samples of another buffer of the same size whose band lies within this one, e.g. of another shard of the render. The variance estimates are combined as well (Chan et al.).
+    void Merge(const AccumulationBuffer& other);
+
+    // Compact binary form without the row padding, e.g. for checkpoints. Read() throws if the stream ends early.
+    void Write(std::ostream& stream) const;
+    static AccumulationBuffer Read(std::istream& stream);
+    // Number of bytes that Write() produces for a buffer that stores the given number of rows
+    static std::size_t SerializedSize(std::size_t width, std::size_t numberOfRows, bool trackVariance);
+
+    // Write the mean of every pixel in the band into an existing image of the same size
+    void Resolve(Image& image) const;
+
+    // Grayscale image of the samples per pixel, normalized to the largest sample count. Rows outside the band are black.
+    Image CreateSampleCountImage() const;
+
+private:
+    std::size_t mWidth;
+    std::size_t mHeight;
+    std::size_t mFirstRow;
+    std::size_t mEndRow;
+    std::size_t mStride;  // Pixels per row including padding
+    AlignedVector<Pixel> mPixels;
+
+    struct Moments {
+        float mean = 0.0f;
+        float m2 = 0.0f;  // Sum of squared deviations from the mean
+    };
+    AlignedVector<Moments> mMoments;  // Empty unless the variance is tracked
+    bool mTrackVariance;
+
+    std::size_t Index(std::size_t x, std::size_t y) const {
+        return (y - mFirstRow) * mStride + x;
+    }
+
+    // Lower bound for the mean luminance in the relative error, so that dark pixels do not need an excessive number of samples
+    static constexpr double kMinimumLuminance = 1e-3;
+};
+
+}  // namespace Raytracer
@@ -1,21 +1,161 @@
 #include "Rendering/Camera.hpp"
 
+#include "Rendering/AccumulationBuffer.hpp"
+#include "Rendering/RenderCheckpoint.hpp"
+#include "Rendering/RenderStatistics.hpp"
 #include "Rendering/RendererDeterministic.hpp"
 #include "Rendering/RendererPathTracer.hpp"
 #include "Rendering/RendererPathTracerNEE.hpp"
+#include "Rendering/RendererPathTracerWavefront.hpp"
 #include "Rendering/RendererRayTracer.hpp"
 #include "Rendering/RendererSimple.hpp"
+#include "Rendering/TileScheduler.hpp"
 #include "Utilities/Configuration.hpp"
 #include "Utilities/Denoiser.hpp"
 
 #include "libphysica/Utilities.hpp"
 
 #include <omp.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
-#include <random>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <vector>
 
 namespace Raytracer {
 
+namespace {
+
+// An exception must not leave an OpenMP parallel region or critical section, which would terminate the process or deadlock the other threads.
+// The first exception of any thread is kept instead, cancels the remaining work, and is rethrown after the region.
+class ParallelExceptions {
+public:
+    template <typename Function>
+    void Run(Function&& function) noexcept {
+        if (IsCancelled()) {
+            return;
+        }
+        try {
+            function();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mException) {
+                mException = std::current_exception();
+            }
+            mCancelled.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    bool IsCancelled() const {
+        return mCancelled.load(std::memory_order_relaxed);
+    }
+
+    void Rethrow() const {
+        if (mException) {
+            std::rethrow_exception(mException);
+        }
+    }
+
+private:
+    std::atomic<bool> mCancelled{false};
+    std::mutex mMutex;
+    std::exception_ptr mException;
+};
+
+// Hands out the camera and a snapshot of the scene for the frames of a video in increasing order. Both are stepped frame by frame from the
+// start, like a sequential render, so accelerating and rotating objects move the same way whichever thread or shard renders a frame.
+class FrameSequence {
+public:
+    struct Frame {
+        std::size_t index;
+        Camera camera;
+        Scene scene;
+    };
+
+    FrameSequence(const Camera& camera, const Scene& scene, double timeStep, std::vector<std::size_t> frames) :
+        mCamera(camera),
+        mScene(scene),
+        mTimeStep(timeStep),
+        mFrames(std::move(frames)) {
+    }
+
+    // Next frame, or nothing after the last one. Safe to call from several threads.
+    std::optional<Frame> Next() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mNext == mFrames.size()) {
+            return std::nullopt;
+        }
+        const std::size_t index = mFrames[mNext++];
+        if (index > mFrame) {
+            // The previous snapshots are shared with the frames that render them, so the scene is never evolved in place
+            mScene = mScene.Snapshot(index - mFrame, mTimeStep);
+            for (; mFrame < index; mFrame++) {
+                mCamera.Evolve(mTimeStep);
+            }
+        }
+        return Frame{index, mCamera, mScene};
+    }
+
+private:
+    std::mutex mMutex;
+    Camera mCamera;
+    Scene mScene;
+    double mTimeStep;
+    std::vector<std::size_t> mFrames;  // Increasing
+    std::size_t mNext = 0;
+    std::size_t mFrame = 0;  // Frame of mCamera and mScene
+};
+
+std::vector<std::size_t> FrameRange(std::size_t begin, std::size_t end) {
+    std::vector<std::size_t> frames(end > begin ? end - begin : 0);
+    std::iota(frames.begin(), frames.end(), begin);
+    return frames;
+}
+
+// Moves the camera and the scene past the last frame of a video, in the same steps as the frames
+void AdvanceFrames(Camera& camera, Scene& scene, double timeStep, std::size_t numberOfFrames) {
+    for (std::size_t i = 0; i < numberOfFrames; i++) {
+        camera.Evolve(timeStep);
+    }
+    scene.Evolve(timeStep, numberOfFrames);
+}
+
+// Image shard file named image_shard_<index>_of_<count>.shard, which records the shard count of its render
+struct ImageShardFile {
+    std::filesystem::path path;
+    std::size_t index;
+    std::size_t count;
+};
+
+std::vector<ImageShardFile> FindImageShards(const std::string& directory) {
+    std::vector<ImageShardFile> shards;
+    if (!std::filesystem::is_directory(directory)) {
+        return shards;
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        const std::string filename = entry.path().filename().string();
+        ImageShardFile shard{entry.path(), 0, 0};
+        int length = 0;
+        if (std::sscanf(filename.c_str(), "image_shard_%zu_of_%zu.shard%n", &shard.index, &shard.count, &length) == 2 && std::size_t(length) == filename.size() && shard.index < shard.count) {
+            shards.push_back(shard);
+        }
+    }
+    std::sort(shards.begin(), shards.end(), [](const ImageShardFile& a, const ImageShardFile& b) {
+        return a.path < b.path;
+    });
+    return shards;
+}
+
+}  // namespace
+
 Camera::Camera(Renderer::Type rendererType) :
     mPosition({0, 0, 0}),
     mEz({1, 0, 0}),
@@ -73,8 +213,8 @@ void Camera::InitializeOrbitTrajectory(double angularVelocity) {
     ConfigureCamera();
 
     // Set angular and spin velocity for orbit around z axis
-    Vector3D angularVelocityVec({0, 0, angularVelocity});
-    Vector3D spinVec({0, 0, angularVelocity});
+    Vector3D angularVelocityVec({0, 0, static_cast<Real>(angularVelocity)});
+    Vector3D spinVec({0, 0, static_cast<Real>(angularVelocity)});
     SetAngularVelocity(angularVelocityVec);
     SetVelocity(Vector3D());
     SetSpin(spinVec);
@@ -106,6 +246,60 @@ void Camera::SetUseAntiAliasing(bool useAA) {
     mUseAntiAliasing = useAA;
 }
 
+void Camera::SetParallelFrames(bool parallelFrames) {
+    mParallelFrames = parallelFrames;
+}
+
+void Camera::SetScheduler(Scheduler scheduler, std::size_t tileSize) {
+    if (tileSize == 0) {
+        throw std::invalid_argument("Camera::SetScheduler: Tile size must be positive.");
+    }
+    mScheduler = scheduler;
+    mTileSize = tileSize;
+}
+
+void Camera::SetAdaptiveSampling(const AdaptiveSampling& adaptiveSampling) {
+    if (adaptiveSampling.enabled && (adaptiveSampling.minimumSamples < 2 || adaptiveSampling.relativeErrorThreshold <= 0.0)) {
+        throw std::invalid_argument("Camera::SetAdaptiveSampling: Need at least 2 samples and a positive error threshold.");
+    }
+    mAdaptiveSampling = adaptiveSampling;
+}
+
+void Camera::SetTimeBudget(double seconds) {
+    if (seconds < 0.0) {
+        throw std::invalid_argument("Camera::SetTimeBudget: Time budget must not be negative.");
+    }
+    mTimeBudgetSeconds = seconds;
+}
+
+void Camera::SetSeed(std::uint64_t seed) {
+    mSeed = seed;
+}
+
+void Camera::SetCheckpointInterval(double seconds, std::string directory) {
+    if (seconds < 0.0) {
+        throw std::invalid_argument("Camera::SetCheckpointInterval: Interval must not be negative.");
+    }
+    mCheckpointIntervalSeconds = seconds;
+    mCheckpointDirectory = std::move(directory);
+}
+
+void Camera::SetResume(bool resume) {
+    mResume = resume;
+}
+
+void Camera::SetShard(std::size_t index, std::size_t count) {
+    if (count < 2 || index >= count) {
+        throw std::invalid_argument("Camera::SetShard: Shard " + std::to_string(index) + " of " + std::to_string(count) + " does not exist, a render needs at least two shards.");
+    }
+    mShardIndex = index;
+    mShardCount = count;
+}
+
+void Camera::SetShardDirectory(std::string directory) {
+    mShardDirectory = std::move(directory);
+}
+
 void Camera::SetDenoisingMethod(Denoiser::Method method, std::size_t iterations) {
     mDenoisingMethod = method;
     mDenoisingIterations = iterations;
@@ -115,67 +309,296 @@ void Camera::SetRemoveHotPixels(bool remove) {
     mRemoveHotPixels = remove;
 }
 
+Camera::Resolution Camera::GetResolution() const {
+    return mResolution;
+}
+
+double Camera::GetFramesPerSecond() const {
+    return mFramesPerSecond;
+}
+
 Image Camera::RenderImage(const Scene& scene, bool printProgressBar, bool createConvergingVideo) const {
     // Set the starting time
     auto startTime = std::chrono::high_resolution_clock::now();
     std::size_t samples = mSamplesPerPixel;
-    if (mRenderer->IsDeterministic() && !mUseAntiAliasing && mSamplesPerPixel > 1) {
+    bool timeBudgeted = mTimeBudgetSeconds > 0.0;
+    if (mRenderer->IsDeterministic() && !mUseAntiAliasing && (mSamplesPerPixel > 1 || timeBudgeted)) {
         std::cerr << "Warning: Renderer is deterministic, and anti-aliasing is disabled. Setting samples to 1." << std::endl;
         samples = 1;
+        timeBudgeted = false;
+    }
+    if (timeBudgeted) {
+        // Sample passes continue until the time budget is used up
+        samples = std::numeric_limits<std::size_t>::max();
+    }
+
+    // A shard renders only its range of tiles and saves their samples for the merge, which post-processes the whole image
+    const bool sharded = mShardCount > 1;
+    if (sharded && timeBudgeted) {
+        throw std::runtime_error("Camera::RenderImage: A render with a time budget cannot be split into shards.");
+    }
+    const std::string imageName = sharded ? std::format("image_shard_{}_of_{}", mShardIndex, mShardCount) : "image";
+    const std::string shardFilepath = sharded ? GetShardDirectory() + "/" + imageName + ".shard" : mFrameShardFilepath;
+    if (sharded) {
+        // Shards of an earlier render with a different shard count would overlap with the tiles of this one in the merge
+        for (const ImageShardFile& shard : FindImageShards(GetShardDirectory())) {
+            if (shard.count != mShardCount) {
+                std::error_code error;  // Another shard of this render may have removed it already
+                std::filesystem::remove(shard.path, error);
+            }
+        }
     }
 
-    // Some denoising methods need the G-Buffer
-    const bool needGbuffer = !mRenderer->IsDeterministic() && mDenoisingMethod == Denoiser::Method::JOINT_BILATERAL_FILTER;
+    // Some denoising methods need the G-Buffer, a shard leaves it to the merge
     std::optional<GBuffer> gBuffer;
-    if (needGbuffer) {
+    if (NeedsGBuffer() && shardFilepath.empty()) {
         gBuffer.emplace(mResolution.width, mResolution.height);
     }
 
-    std::size_t renderedPixels = 0;
-    auto totalPixels = mResolution.width * mResolution.height * samples;
-    std::vector<std::vector<Color>> accumulatedColors(mResolution.height, std::vector<Color>(mResolution.width, Color(0.0, 0.0, 0.0)));
+    // Adaptive sampling stops sampling converged pixels after the minimum number of samples
+    const bool adaptive = mAdaptiveSampling.enabled && samples > mAdaptiveSampling.minimumSamples;
+    // A shard only stores the rows of its tiles
+    std::size_t firstRow = 0;
+    std::size_t endRow = mResolution.height;
+    if (sharded) {
+        const TileScheduler shardTiles(mResolution.width, mResolution.height, mTileSize, 1, mShardIndex, mShardCount);
+        firstRow = endRow = 0;
+        if (shardTiles.FirstTile() < shardTiles.EndTile()) {
+            firstRow = shardTiles.GetTile(shardTiles.FirstTile()).yBegin;
+            endRow = shardTiles.GetTile(shardTiles.EndTile() - 1).yEnd;
+        }
+    }
+    AccumulationBuffer accumulation(mResolution.width, mResolution.height, firstRow, endRow, adaptive);
+    auto hasConverged = [&](std::size_t x, std::size_t y, std::size_t samplesSoFar) {
+        return adaptive && samplesSoFar >= mAdaptiveSampling.minimumSamples && accumulation.GetRelativeError(x, y) < mAdaptiveSampling.relativeErrorThreshold;
+    };
+
+    Image image(mResolution.width, mResolution.height);
     std::unique_ptr<Video> video = nullptr;
-    if (createConvergingVideo && samples > 1) {
+    if (createConvergingVideo && samples > 1 && shardFilepath.empty()) {
         video = std::make_unique<Video>(mFramesPerSecond);
     }
-    for (std::size_t s = 0; s < samples; s++) {
-#pragma omp parallel for collapse(2) schedule(static)
-        for (std::size_t y = 0; y < mResolution.height; y++) {
-            for (std::size_t x = 0; x < mResolution.width; x++) {
-                if (s == 0 && gBuffer.has_value()) {
-                    // Fill G-Buffer
-                    const bool useAntiAliasingForGBuffer = false;
-                    Ray gBufferRay = CreateRay(x, y, useAntiAliasingForGBuffer);
-                    GBufferData gBufferData = mRenderer->ComputeGBuffer(gBufferRay, scene);
-                    gBuffer->SetData(x, y, gBufferData);
-                }
 
-                // Sample the pixel
-                Ray ray = CreateRay(x, y);
-                Color pixel = mRenderer->TraceRay(ray, scene);
+    // Checkpoints, except for converging videos, whose frames would be lost
+    const bool tiled = (mScheduler == Scheduler::TILES || sharded) && !video && !timeBudgeted;
+    const std::size_t tileSize = tiled ? mTileSize : 0;
+    const std::string checkpointFilepath = GetCheckpointFilepath(imageName);
+    const bool saveCheckpoints = mCheckpointIntervalSeconds > 0.0 && !video;
+    std::optional<RenderCheckpoint> checkpoint;
+    if (mResume && !video) {
+        checkpoint = LoadCheckpoint(checkpointFilepath);
+    }
+    if (checkpoint) {
+        if (checkpoint->width != mResolution.width || checkpoint->height != mResolution.height || checkpoint->frame != mFrameIndex || checkpoint->samplesPerPixel != samples || checkpoint->tileSize != tileSize || !checkpoint->accumulation || checkpoint->accumulation->TracksVariance() != adaptive || checkpoint->accumulation->GetFirstRow() != firstRow || checkpoint->accumulation->GetEndRow() != endRow) {
+            throw std::runtime_error("Camera::RenderImage: Checkpoint " + checkpointFilepath + " does not match the render settings.");
+        }
+        accumulation = std::move(*checkpoint->accumulation);
+        checkpoint->accumulation.reset();
+        startTime -= std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(std::chrono::duration<double>(checkpoint->elapsedSeconds));
+        if (gBuffer) {
+            // The G-Buffer is not part of the checkpoint, but cheap to recompute with one primary ray per pixel
+            FillGBuffer(scene, *gBuffer);
+        }
+        std::cout << "Resuming from checkpoint " << checkpointFilepath << std::endl;
+    }
+    const std::uint64_t seed = checkpoint ? checkpoint->seed : mSeed;
+    auto lastCheckpointTime = std::chrono::high_resolution_clock::now();
+    auto isCheckpointDue = [&]() {
+        return saveCheckpoints && std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - lastCheckpointTime).count() >= mCheckpointIntervalSeconds;
+    };
+    auto saveCheckpoint = [&](const std::string& filepath, const AccumulationBuffer& finishedSamples, std::size_t completedPasses, const std::vector<bool>& completedTiles) {
+        RenderCheckpoint{
+            .seed = seed,
+            .frame = mFrameIndex,
+            .width = mResolution.width,
+            .height = mResolution.height,
+            .samplesPerPixel = samples,
+            .tileSize = tileSize,
+            .completedPasses = completedPasses,
+            .completedTiles = completedTiles,
+            .elapsedSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count(),
+            .accumulation = finishedSamples,
+        }
+            .Save(filepath);
+        lastCheckpointTime = std::chrono::high_resolution_clock::now();
+    };
 
-                accumulatedColors[y][x] += pixel;
-            }
-            if (printProgressBar) {
-                std::size_t done;
+    std::size_t renderedSamples = 0;
+    std::size_t totalSamples = mResolution.width * mResolution.height * samples;
+    auto updateProgressBar = [&](std::size_t newSamples) {
+        if (!printProgressBar || timeBudgeted) {
+            return;
+        }
+        std::size_t done;
 #pragma omp atomic capture
-                done = ++renderedPixels;
+        done = renderedSamples += newSamples;
+
+        if ((done - newSamples) / kProgressBarStep != done / kProgressBarStep || done == totalSamples) {
+            double duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+#pragma omp critical(progress_bar)
+            libphysica::Print_Progress_Bar(double(done) / double(totalSamples), 0, 60, duration, "Blue");
+        }
+    };
+
+    // Samples the pixels of a region that have not converged yet as one batch, row by row. Returns the number of sampled pixels.
+    auto sampleRegion = [&](std::size_t xBegin, std::size_t xEnd, std::size_t yBegin, std::size_t yEnd, std::size_t s) {
+        // Every thread reuses its own buffers, which only grow
+        thread_local std::vector<Pixel> pixels;
+        thread_local std::vector<Color> colors;
+        pixels.clear();
+        for (std::size_t y = yBegin; y < yEnd; y++) {
+            for (std::size_t x = xBegin; x < xEnd; x++) {
+                if (!hasConverged(x, y, s)) {
+                    pixels.push_back({x, y});
+                }
+            }
+        }
+        colors.resize(pixels.size());
+        SamplePixels(scene, pixels, seed, s, gBuffer, colors);
+        for (std::size_t i = 0; i < pixels.size(); i++) {
+            accumulation.AddSample(pixels[i].x, pixels[i].y, colors[i]);
+        }
+        return pixels.size();
+    };
 
-                if ((done % 200000) == 0 || done == totalPixels) {
-                    double duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
-                    libphysica::Print_Progress_Bar(double(done) / double(totalPixels), 0, 60, duration, "Blue");
+    auto traceStartTime = std::chrono::high_resolution_clock::now();
+    if (tiled) {
+        // Every worker renders all samples of a tile at once and steals tiles from the others when it runs out of work
+        // Inside another parallel region, e.g. when frames render in parallel, the region below runs on a single thread
+        TileScheduler scheduler(mResolution.width, mResolution.height, mTileSize, omp_in_parallel() ? 1 : omp_get_max_threads(), mShardIndex, mShardCount);
+        if (sharded) {
+            totalSamples = 0;
+            for (std::size_t index = scheduler.FirstTile(); index < scheduler.EndTile(); index++) {
+                totalSamples += scheduler.GetTile(index).NumberOfPixels() * samples;
+            }
+        }
+        std::vector<bool> completedTiles(scheduler.NumberOfTiles(), false);
+        if (checkpoint) {
+            if (checkpoint->completedTiles.size() != completedTiles.size()) {
+                throw std::runtime_error("Camera::RenderImage: Checkpoint " + checkpointFilepath + " does not match the render settings.");
+            }
+            completedTiles = checkpoint->completedTiles;
+        }
+        // Only the finished tiles go into a checkpoint, the others start over after resuming
+        std::optional<AccumulationBuffer> finishedTiles;
+        if (saveCheckpoints) {
+            finishedTiles.emplace(accumulation);
+        }
+        ParallelExceptions exceptions;
+#pragma omp parallel
+        {
+            const std::size_t worker = omp_get_thread_num();
+            while (auto tile = exceptions.IsCancelled() ? std::nullopt : scheduler.Next(worker)) {
+                exceptions.Run([&] {
+                    // The tiles that were finished before resuming are never written, so they can be read without synchronization
+                    if (!checkpoint || !checkpoint->completedTiles[tile->index]) {
+                        // Sample the tile until all of its pixels have converged
+                        for (std::size_t s = 0; s < samples && sampleRegion(tile->xBegin, tile->xEnd, tile->yBegin, tile->yEnd, s) > 0; s++) {
+                        }
+                        if (saveCheckpoints) {
+#pragma omp critical(checkpoint)
+                            exceptions.Run([&] {
+                                completedTiles[tile->index] = true;
+                                finishedTiles->CopyRegion(accumulation, tile->xBegin, tile->xEnd, tile->yBegin, tile->yEnd);
+                                if (isCheckpointDue()) {
+                                    saveCheckpoint(checkpointFilepath, *finishedTiles, 0, completedTiles);
+                                }
+                            });
+                        }
+                    }
+                    updateProgressBar(tile->NumberOfPixels() * samples);
+                });
+            }
+        }
+        exceptions.Rethrow();
+        if (!shardFilepath.empty()) {
+            // The samples of the shard replace its checkpoint
+            std::vector<bool> shardTiles(completedTiles.size(), false);
+            std::fill(shardTiles.begin() + scheduler.FirstTile(), shardTiles.begin() + scheduler.EndTile(), true);
+            saveCheckpoint(shardFilepath, accumulation, 0, shardTiles);
+            if (saveCheckpoints) {
+                std::filesystem::remove(checkpointFilepath);
+            }
+        } else if (saveCheckpoints) {
+            saveCheckpoint(checkpointFilepath, accumulation, 0, std::vector<bool>(completedTiles.size(), true));
+        }
+    } else {
+        // One pass over the whole image per sample, e.g. to record the converging video or to render within a time budget
+        const std::size_t firstPass = checkpoint ? checkpoint->completedPasses : 0;
+        renderedSamples = firstPass * mResolution.width * mResolution.height;
+        std::size_t completedPasses = firstPass;
+        for (std::size_t s = firstPass; s < samples; s++) {
+            std::size_t sampledPixels = 0;
+            ParallelExceptions exceptions;
+#pragma omp parallel for schedule(dynamic) reduction(+ : sampledPixels)
+            for (std::size_t y = 0; y < mResolution.height; y++) {
+                exceptions.Run([&] {
+                    sampledPixels += sampleRegion(0, mResolution.width, y, y + 1, s);
+                    updateProgressBar(mResolution.width);
+                });
+            }
+            exceptions.Rethrow();
+            completedPasses = s + 1;
+            if (video) {
+                accumulation.Resolve(image);
+                video->AddFrame(image);
+            }
+            if (isCheckpointDue()) {
+                saveCheckpoint(checkpointFilepath, accumulation, completedPasses, {});
+            }
+            if (timeBudgeted) {
+                double duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+                if (printProgressBar) {
+                    libphysica::Print_Progress_Bar(std::min(1.0, duration / mTimeBudgetSeconds), 0, 60, duration, "Blue");
+                }
+                // Stop once the budget is used up, or when adaptive sampling considers every pixel converged
+                if (duration >= mTimeBudgetSeconds || sampledPixels == 0) {
+                    break;
                 }
             }
         }
-        if (video) {
-            Image tempImage = CreateRawImage(accumulatedColors, s + 1);
-            video->AddFrame(tempImage);
+        if (!shardFilepath.empty()) {
+            saveCheckpoint(shardFilepath, accumulation, completedPasses, {});
+        } else if (saveCheckpoints) {
+            saveCheckpoint(checkpointFilepath, accumulation, completedPasses, {});
         }
     }
 
-    Image image = CreateRawImage(accumulatedColors, samples);
+    accumulation.Resolve(image);
+    if (mRecordTimings) {
+        RenderStatistics::AddTime(RenderStatistics::Stage::TRACE, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - traceStartTime).count());
+    }
+
+    // The achieved samples per pixel go into the statistics, since adaptive sampling and time budgets make them unpredictable.
+    // Pixels without samples belong to other shards.
+    std::size_t renderedPixels = 0;
+    std::size_t sampleSum = 0;
+    std::size_t maximumSamples = 0;
+    for (std::size_t y = accumulation.GetFirstRow(); y < accumulation.GetEndRow(); y++) {
+        for (std::size_t x = 0; x < mResolution.width; x++) {
+            const std::size_t sampleCount = accumulation.GetSampleCount(x, y);
+            renderedPixels += (sampleCount > 0) ? 1 : 0;
+            sampleSum += sampleCount;
+            maximumSamples = std::max(maximumSamples, sampleCount);
+        }
+    }
+    RenderStatistics::AddSamples(renderedPixels, sampleSum, maximumSamples);
+    if (!shardFilepath.empty()) {
+        if (printProgressBar) {
+            std::cout << "\nSaved the samples of the shard to " << shardFilepath << std::endl;
+        }
+        // Without post-processing, which needs the whole image
+        return image;
+    }
     ProcessImage(image, gBuffer);
 
+    if (adaptive && mAdaptiveSampling.saveSampleCountImage) {
+        std::string directory = Configuration::GetInstance().GetOutputDirectory() + "/images";
+        std::filesystem::create_directories(directory);
+        std::string filepath = directory + "/samples_per_pixel_" + Configuration::GetInstance().GetRunID() + "_frame_" + std::to_string(mFrameIndex) + ".png";
+        accumulation.CreateSampleCountImage().Save(false, filepath);
+    }
+
     if (video) {
         video->AddFrame(image);
         std::string filepath = Configuration::GetInstance().GetOutputDirectory() + "/videos/converging_video_" + Configuration::GetInstance().GetRunID() + ".mp4";
@@ -187,48 +610,383 @@ Image Camera::RenderImage(const Scene& scene, bool printProgressBar, bool create
     if (printProgressBar) {
         libphysica::Print_Progress_Bar(1.0, 0, 60, totalDuration, "Blue");
         std::cout << "\nRendered image with " << 1.0 / totalDuration << " FPS" << std::endl;
+        if (adaptive || timeBudgeted) {
+            std::cout << "Achieved " << double(sampleSum) / renderedPixels << " samples per pixel on average (maximum " << maximumSamples << ")" << std::endl;
+        }
     }
 
     return image;
 }
 
-Video Camera::RenderVideo(Scene& scene, double durationSeconds, bool printProgressBar) {
+void Camera::RenderVideo(Scene& scene, double durationSeconds, const std::vector<FrameSink*>& sinks, bool printProgressBar) {
+    if (mShardCount > 1) {
+        RenderVideoShard(scene, durationSeconds, printProgressBar);
+        return;
+    }
     auto startTime = std::chrono::high_resolution_clock::now();
 
     std::size_t totalFrames = mFramesPerSecond * durationSeconds;
     double timeStep = 1.0 / mFramesPerSecond;
-    Video video(mFramesPerSecond);
-    for (std::size_t i = 0; i < totalFrames; i++) {
-        Image frame = RenderImage(scene);
-        video.AddFrame(frame);
-        if (printProgressBar) {
-            double duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
-            libphysica::Print_Progress_Bar(double(i + 1) / totalFrames, 0, 60, duration, "Red");
+
+    // The checkpoint of a video records the finished frames. The sinks must still have them, otherwise the video starts over.
+    const std::string checkpointFilepath = GetCheckpointFilepath("video");
+    std::size_t firstFrame = 0;
+    std::optional<RenderCheckpoint> checkpoint;
+    if (mResume) {
+        checkpoint = LoadCheckpoint(checkpointFilepath);
+    }
+    if (checkpoint) {
+        if (checkpoint->width != mResolution.width || checkpoint->height != mResolution.height) {
+            throw std::runtime_error("Camera::RenderVideo: Checkpoint " + checkpointFilepath + " does not match the render settings.");
+        }
+        mSeed = checkpoint->seed;
+        if (std::all_of(sinks.begin(), sinks.end(), [&](const FrameSink* sink) { return sink->CanResumeAfter(checkpoint->frame); })) {
+            for (FrameSink* sink : sinks) {
+                sink->ResumeAfter(checkpoint->frame);
+            }
+            firstFrame = std::min(checkpoint->frame, totalFrames);
+            std::cout << "Resuming from checkpoint " << checkpointFilepath << " after frame " << firstFrame << std::endl;
+        } else {
+            std::cerr << "Warning: The frames of the interrupted video are lost, e.g. because they were streamed. Rendering the video from the start." << std::endl;
         }
-        Evolve(timeStep);
-        scene.Evolve(timeStep);
     }
+
+    const bool parallelFrames = mParallelFrames && totalFrames > firstFrame + 1;
+    FrameSequence frames(*this, scene, timeStep, FrameRange(firstFrame, totalFrames));
+    auto renderFrame = [&](FrameSequence::Frame& frame) {
+        Camera& camera = frame.camera;
+        camera.mFrameIndex = frame.index;
+        camera.mCheckpointIntervalSeconds = 0.0;
+        camera.mResume = false;
+        camera.mRecordTimings = !parallelFrames;
+        return camera.RenderImage(frame.scene);
+    };
+
+    // Frames that finish before their predecessors wait in a reorder buffer, so that the sinks receive them in order
+    std::mutex mutex;
+    std::condition_variable frameEmitted;
+    std::map<std::size_t, Image> reorderBuffer;
+    std::size_t nextFrame = firstFrame;
+    auto lastCheckpointTime = std::chrono::high_resolution_clock::now();
+    ParallelExceptions exceptions;
+    auto emitFrame = [&](std::size_t i, Image&& frame) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (exceptions.IsCancelled()) {
+            return;
+        }
+        reorderBuffer.emplace(i, std::move(frame));
+        while (!reorderBuffer.empty() && reorderBuffer.begin()->first == nextFrame) {
+            auto encodeStartTime = std::chrono::high_resolution_clock::now();
+            for (FrameSink* sink : sinks) {
+                sink->AddFrame(reorderBuffer.begin()->second);
+            }
+            RenderStatistics::AddTime(RenderStatistics::Stage::ENCODE, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - encodeStartTime).count());
+            reorderBuffer.erase(reorderBuffer.begin());
+            nextFrame++;
+            // At most once per interval, and after the last frame, so that a video whose file fails to close can still be resumed
+            const auto now = std::chrono::high_resolution_clock::now();
+            if (mCheckpointIntervalSeconds > 0.0 && (nextFrame == totalFrames || std::chrono::duration<double>(now - lastCheckpointTime).count() >= mCheckpointIntervalSeconds)) {
+                RenderCheckpoint{.seed = mSeed, .frame = nextFrame, .width = mResolution.width, .height = mResolution.height}.Save(checkpointFilepath);
+                lastCheckpointTime = now;
+            }
+            if (printProgressBar) {
+                double duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+                libphysica::Print_Progress_Bar(double(nextFrame) / totalFrames, 0, 60, duration, "Red");
+            }
+        }
+        frameEmitted.notify_all();
+    };
+
+    if (parallelFrames) {
+        // Every thread renders whole frames. A thread does not start a frame too far ahead of the next frame in order, which bounds the reorder buffer.
+        const std::size_t maximumFramesAhead = 2 * omp_get_max_threads();
+        const auto parallelStartTime = std::chrono::high_resolution_clock::now();
+        const double encodeSecondsBefore = RenderStatistics::CollectTimings()[RenderStatistics::Stage::ENCODE];
+#pragma omp parallel
+        {
+            bool framesLeft = true;
+            while (framesLeft) {
+                exceptions.Run([&] {
+                    std::optional<FrameSequence::Frame> frame = frames.Next();
+                    framesLeft = frame.has_value();
+                    if (!frame) {
+                        return;
+                    }
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        frameEmitted.wait(lock, [&] { return exceptions.IsCancelled() || frame->index < nextFrame + maximumFramesAhead; });
+                    }
+                    if (!exceptions.IsCancelled()) {
+                        emitFrame(frame->index, renderFrame(*frame));
+                    }
+                });
+                if (exceptions.IsCancelled()) {
+                    // Wake up the threads that wait for the frames that will not be emitted anymore
+                    std::lock_guard<std::mutex> lock(mutex);
+                    frameEmitted.notify_all();
+                    break;
+                }
+            }
+        }
+        // The frames overlap, so their tracing and post-processing are recorded together as the wall time outside of encoding
+        const double encodeSeconds = RenderStatistics::CollectTimings()[RenderStatistics::Stage::ENCODE] - encodeSecondsBefore;
+        const double parallelSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - parallelStartTime).count();
+        RenderStatistics::AddTime(RenderStatistics::Stage::TRACE, std::max(0.0, parallelSeconds - encodeSeconds));
+        exceptions.Rethrow();
+    } else {
+        while (std::optional<FrameSequence::Frame> frame = frames.Next()) {
+            emitFrame(frame->index, renderFrame(*frame));
+        }
+    }
+
+    AdvanceFrames(*this, scene, timeStep, totalFrames);
     if (printProgressBar) {
         double totalDuration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
         std::cout << "\nRendered video with " << totalFrames / totalDuration << " FPS" << std::endl;
     }
-    return video;
 }
 
-// Better function name? Create Rendered Image? ConstructImage?
-Image Camera::CreateRawImage(const std::vector<std::vector<Color>>& accumulatedColors, std::size_t samples) const {
+Image Camera::MergeImageShards(const Scene& scene) const {
+    const std::string directory = GetShardDirectory();
+    const std::vector<ImageShardFile> shardFiles = FindImageShards(directory);
+    if (shardFiles.empty()) {
+        throw std::runtime_error("Camera::MergeImageShards: No image shards in " + directory);
+    }
+
+    // Shards of an earlier render with a different shard count, e.g. copied together with the new ones, are left out. The latest shard belongs to the new render.
+    const ImageShardFile& latest = *std::max_element(shardFiles.begin(), shardFiles.end(), [](const ImageShardFile& a, const ImageShardFile& b) {
+        return std::filesystem::last_write_time(a.path) < std::filesystem::last_write_time(b.path);
+    });
+    std::vector<std::filesystem::path> filepaths;
+    for (const ImageShardFile& shard : shardFiles) {
+        if (shard.count == latest.count) {
+            filepaths.push_back(shard.path);
+        }
+    }
+    if (filepaths.size() < shardFiles.size()) {
+        std::cerr << "Warning: Ignoring " << shardFiles.size() - filepaths.size() << " shards of an earlier render in " << directory << ", which was not split into " << latest.count << " shards." << std::endl;
+    }
+
+    // Every tile must be rendered by exactly one shard, whose rows are added into the whole image one shard at a time
+    std::optional<AccumulationBuffer> accumulation;
+    std::vector<bool> renderedTiles;
+    for (const auto& filepath : filepaths) {
+        std::optional<RenderCheckpoint> shard = RenderCheckpoint::Load(filepath.string());
+        if (!shard || shard->width != mResolution.width || shard->height != mResolution.height || shard->frame != mFrameIndex || !shard->accumulation) {
+            throw std::runtime_error("Camera::MergeImageShards: Shard " + filepath.string() + " does not match the render settings.");
+        }
+        if (!accumulation) {
+            accumulation.emplace(mResolution.width, mResolution.height, shard->accumulation->TracksVariance());
+            renderedTiles.assign(shard->completedTiles.size(), false);
+        }
+        if (shard->completedTiles.size() != renderedTiles.size()) {
+            throw std::runtime_error("Camera::MergeImageShards: Shard " + filepath.string() + " has a different tile size than the other shards.");
+        }
+        for (std::size_t tile = 0; tile < renderedTiles.size(); tile++) {
+            if (shard->completedTiles[tile] && renderedTiles[tile]) {
+                throw std::runtime_error("Camera::MergeImageShards: Shard " + filepath.string() + " overlaps with another shard.");
+            }
+            const std::size_t tileRow = tile / ((mResolution.width + shard->tileSize - 1) / shard->tileSize);
+            if (shard->completedTiles[tile] && (tileRow * shard->tileSize < shard->accumulation->GetFirstRow() || std::min((tileRow + 1) * shard->tileSize, mResolution.height) > shard->accumulation->GetEndRow())) {
+                throw std::runtime_error("Camera::MergeImageShards: Shard " + filepath.string() + " does not contain the samples of its tiles.");
+            }
+            renderedTiles[tile] = renderedTiles[tile] || shard->completedTiles[tile];
+        }
+        accumulation->Merge(*shard->accumulation);
+    }
+    if (std::find(renderedTiles.begin(), renderedTiles.end(), false) != renderedTiles.end()) {
+        throw std::runtime_error("Camera::MergeImageShards: Tiles are missing in " + directory + ", e.g. because a shard has not finished.");
+    }
+    std::cout << "Merged " << filepaths.size() << " shards from " << directory << std::endl;
+
     Image image(mResolution.width, mResolution.height);
+    accumulation->Resolve(image);
+    std::optional<GBuffer> gBuffer;
+    if (NeedsGBuffer()) {
+        gBuffer.emplace(mResolution.width, mResolution.height);
+        FillGBuffer(scene, *gBuffer);
+    }
+    ProcessImage(image, gBuffer);
+    return image;
+}
+
+void Camera::MergeVideoShards(Scene& scene, double durationSeconds, const std::vector<FrameSink*>& sinks, bool printProgressBar) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    std::size_t totalFrames = mFramesPerSecond * durationSeconds;
+    double timeStep = 1.0 / mFramesPerSecond;
+
+    FrameSequence frames(*this, scene, timeStep, FrameRange(0, totalFrames));
+    while (std::optional<FrameSequence::Frame> next = frames.Next()) {
+        const std::size_t i = next->index;
+        const std::string filepath = GetFrameShardFilepath(i);
+        std::optional<RenderCheckpoint> shard = RenderCheckpoint::Load(filepath);
+        if (!shard) {
+            throw std::runtime_error("Camera::MergeVideoShards: Frame " + std::to_string(i) + " is missing in " + GetShardDirectory() + ", e.g. because its shard has not finished.");
+        }
+        if (shard->width != mResolution.width || shard->height != mResolution.height || shard->frame != i || !shard->accumulation) {
+            throw std::runtime_error("Camera::MergeVideoShards: Shard " + filepath + " does not match the render settings.");
+        }
+
+        // The frame is post-processed as if it had been rendered in this process
+        Camera& camera = next->camera;
+        camera.mFrameIndex = i;
+        Image frame(mResolution.width, mResolution.height);
+        shard->accumulation->Resolve(frame);
+        std::optional<GBuffer> gBuffer;
+        if (NeedsGBuffer()) {
+            gBuffer.emplace(mResolution.width, mResolution.height);
+            camera.FillGBuffer(next->scene, *gBuffer);
+        }
+        camera.ProcessImage(frame, gBuffer);
+
+        auto encodeStartTime = std::chrono::high_resolution_clock::now();
+        for (FrameSink* sink : sinks) {
+            sink->AddFrame(frame);
+        }
+        RenderStatistics::AddTime(RenderStatistics::Stage::ENCODE, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - encodeStartTime).count());
+        if (printProgressBar) {
+            double duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+            libphysica::Print_Progress_Bar(double(i + 1) / totalFrames, 0, 60, duration, "Red");
+        }
+    }
+
+    AdvanceFrames(*this, scene, timeStep, totalFrames);
+    if (printProgressBar) {
+        std::cout << "\nMerged " << totalFrames << " frames from " << GetShardDirectory() << std::endl;
+    }
+}
+
+void Camera::RenderVideoShard(Scene& scene, double durationSeconds, bool printProgressBar) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    std::size_t totalFrames = mFramesPerSecond * durationSeconds;
+    double timeStep = 1.0 / mFramesPerSecond;
+
+    // The frames of an interrupted shard were saved one by one, so only the missing ones are rendered again
+    const std::size_t firstFrame = mShardIndex * totalFrames / mShardCount;
+    const std::size_t endFrame = (mShardIndex + 1) * totalFrames / mShardCount;
+    std::vector<std::size_t> missingFrames;
+    for (std::size_t i = firstFrame; i < endFrame; i++) {
+        if (!mResume || !std::filesystem::exists(GetFrameShardFilepath(i))) {
+            missingFrames.push_back(i);
+        }
+    }
+    if (missingFrames.size() < endFrame - firstFrame) {
+        std::cout << "Resuming the shard with " << missingFrames.size() << " of " << endFrame - firstFrame << " frames left" << std::endl;
+    }
+
+    std::size_t finishedFrames = endFrame - firstFrame - missingFrames.size();
+    FrameSequence frames(*this, scene, timeStep, std::move(missingFrames));
+    auto renderFrame = [&](FrameSequence::Frame& frame) {
+        Camera& camera = frame.camera;
+        camera.mFrameIndex = frame.index;
+        camera.mCheckpointIntervalSeconds = 0.0;
+        camera.mResume = false;
+        camera.mShardIndex = 0;
+        camera.mShardCount = 1;
+        camera.mFrameShardFilepath = GetFrameShardFilepath(frame.index);
+        camera.mRecordTimings = !mParallelFrames;
+        camera.RenderImage(frame.scene);
+        if (printProgressBar) {
+#pragma omp critical(progress_bar)
+            {
+                finishedFrames++;
+                double duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+                libphysica::Print_Progress_Bar(double(finishedFrames) / (endFrame - firstFrame), 0, 60, duration, "Red");
+            }
+        }
+    };
+
+    // The frames are saved independently of each other, so they need no ordering
+    if (mParallelFrames) {
+        const auto parallelStartTime = std::chrono::high_resolution_clock::now();
+        ParallelExceptions exceptions;
+#pragma omp parallel
+        {
+            bool framesLeft = true;
+            while (framesLeft && !exceptions.IsCancelled()) {
+                exceptions.Run([&] {
+                    std::optional<FrameSequence::Frame> frame = frames.Next();
+                    framesLeft = frame.has_value();
+                    if (frame) {
+                        renderFrame(*frame);
+                    }
+                });
+            }
+        }
+        RenderStatistics::AddTime(RenderStatistics::Stage::TRACE, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - parallelStartTime).count());
+        exceptions.Rethrow();
+    } else {
+        while (std::optional<FrameSequence::Frame> frame = frames.Next()) {
+            renderFrame(*frame);
+        }
+    }
+
+    AdvanceFrames(*this, scene, timeStep, totalFrames);
+    if (printProgressBar) {
+        std::cout << "\nSaved the samples of frames " << firstFrame << " to " << endFrame << " to " << GetShardDirectory() << std::endl;
+    }
+}
+
+void Camera::SamplePixels(const Scene& scene, std::span<const Pixel> pixels, std::uint64_t seed, std::size_t sample, std::optional<GBuffer>& gBuffer, std::span<Color> colors) const {
+    const std::size_t count = pixels.size();
+    thread_local std::vector<Sampler> samplers;
+    thread_local std::vector<Ray> rays;
+    samplers.resize(count);
+    rays.resize(count);
+
+    // Every pixel sample has its own random number stream
+    for (std::size_t i = 0; i < count; i++) {
+        samplers[i] = Sampler(seed, mFrameIndex, pixels[i].x, pixels[i].y, sample);
+    }
+
+    if (sample == 0 && gBuffer.has_value()) {
+        FillGBuffer(scene, pixels, *gBuffer);
+    }
+
+    // Sample the pixels
+    for (std::size_t i = 0; i < count; i++) {
+        rays[i] = CreateRay(pixels[i].x, pixels[i].y, samplers[i]);
+    }
+    mRenderer->TraceRays(rays, scene, samplers, colors);
+}
+
+void Camera::FillGBuffer(const Scene& scene, std::span<const Pixel> pixels, GBuffer& gBuffer) const {
+    // The G-Buffer uses the pixel centers, so the rays do not draw random numbers
+    const bool useAntiAliasingForGBuffer = false;
+    Sampler sampler;
+    thread_local std::vector<Ray> rays;
+    thread_local std::vector<GBufferData> gBufferData;
+    rays.resize(pixels.size());
+    gBufferData.resize(pixels.size());
+    for (std::size_t i = 0; i < pixels.size(); i++) {
+        rays[i] = CreateRay(pixels[i].x, pixels[i].y, sampler, useAntiAliasingForGBuffer);
+    }
+    mRenderer->ComputeGBuffer(rays, scene, gBufferData);
+    for (std::size_t i = 0; i < pixels.size(); i++) {
+        gBuffer.SetData(pixels[i].x, pixels[i].y, gBufferData[i]);
+    }
+}
+
+void Camera::FillGBuffer(const Scene& scene, GBuffer& gBuffer) const {
+#pragma omp parallel for schedule(dynamic)
     for (std::size_t y = 0; y < mResolution.height; y++) {
+        thread_local std::vector<Pixel> row;
+        row.clear();
         for (std::size_t x = 0; x < mResolution.width; x++) {
-            Color accumulatedColor = accumulatedColors[y][x];
-            Color colorAverage((accumulatedColor.R() / samples), (accumulatedColor.G() / samples), (accumulatedColor.B() / samples));
-            image.SetPixel(x, y, colorAverage);
+            row.push_back({x, y});
         }
+        FillGBuffer(scene, row, gBuffer);
     }
-    return image;
+}
+
+bool Camera::NeedsGBuffer() const {
+    return !mRenderer->IsDeterministic() && mDenoisingMethod == Denoiser::Method::JOINT_BILATERAL_FILTER;
 }
 
 void Camera::ProcessImage(Image& image, std::optional<GBuffer>& gBuffer) const {
+    auto startTime = std::chrono::high_resolution_clock::now();
     // 1. Remove outliers in linear space
     if (mRemoveHotPixels) {
         image = Denoiser::RemoveHotPixels(image);
@@ -237,12 +995,19 @@ void Camera::ProcessImage(Image& image, std::optional<GBuffer>& gBuffer) const {
     if (!mRenderer->IsDeterministic()) {
         Denoiser::ApplyDenoising(image, mDenoisingMethod, gBuffer, mDenoisingIterations);
     }
+    auto denoiseEndTime = std::chrono::high_resolution_clock::now();
+    if (mRecordTimings) {
+        RenderStatistics::AddTime(RenderStatistics::Stage::DENOISE, std::chrono::duration<double>(denoiseEndTime - startTime).count());
+    }
     // 3. Exposure adjustment
     image.ApplyGammaCorrection();
     // 4. Tone mapping
     image.ApplyReinhardToneMapping();
     // 5. Display transform
     image.ConvertLinearToSRGB();
+    if (mRecordTimings) {
+        RenderStatistics::AddTime(RenderStatistics::Stage::TONEMAP, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - denoiseEndTime).count());
+    }
 }
 
 void Camera::PrintInfo() const {
@@ -257,7 +1022,17 @@ void Camera::PrintInfo() const {
               << "\tDenoising Method:\t" << Denoiser::MethodToString(mDenoisingMethod) << " (Iterations: " << mDenoisingIterations << ")" << std::endl
               << "FPS:\t\t" << mFramesPerSecond << std::endl
               << "Samples/Pixel:\t" << mSamplesPerPixel << std::endl
+              << "Time Budget:\t" << (mTimeBudgetSeconds > 0.0 ? std::to_string(mTimeBudgetSeconds) + " s" : "[ ]") << std::endl
+              << "Checkpoints:\t" << (mCheckpointIntervalSeconds > 0.0 ? "every " + std::to_string(mCheckpointIntervalSeconds) + " s" : "[ ]") << (mResume ? " (resuming)" : "") << std::endl
+              << "Shard:\t\t" << (mShardCount > 1 ? std::to_string(mShardIndex) + "/" + std::to_string(mShardCount) : "[ ]") << std::endl
               << "Anti-Aliasing:\t" << (mUseAntiAliasing ? "[x]" : "[ ]") << std::endl
+              << "Scheduler:\t" << SchedulerToString(mScheduler) << " (Tile Size: " << mTileSize << ")" << std::endl
+              << "Adaptive:\t" << (mAdaptiveSampling.enabled ? "[x]" : "[ ]");
+    if (mAdaptiveSampling.enabled) {
+        std::cout << " (Min. Samples: " << mAdaptiveSampling.minimumSamples << ", Rel. Error: " << mAdaptiveSampling.relativeErrorThreshold << ")";
+    }
+    std::cout << std::endl
+              << "Seed:\t\t" << mSeed << std::endl
               << "Dynamic:\t" << (IsDynamic() ? "[x]" : "[ ]") << std::endl;
     if (IsDynamic()) {
         std::cout << "Velocity:\t" << mVelocity << std::endl
@@ -298,7 +1073,7 @@ void Camera::Spin(double angle, const Vector3D& axis) {
     ConfigureCamera();
 }
 
-Ray Camera::CreateRay(std::size_t x, std::size_t y, bool useAntiAliasing) const {
+Ray Camera::CreateRay(std::size_t x, std::size_t y, Sampler& sampler, bool useAntiAliasing) const {
     const double width = double(mResolution.width);
     const double height = double(mResolution.height);
 
@@ -306,16 +1081,14 @@ Ray Camera::CreateRay(std::size_t x, std::size_t y, bool useAntiAliasing) const
     double dx = 0.0;
     double dy = 0.0;
     if (mUseAntiAliasing && useAntiAliasing) {
-        static thread_local std::mt19937 generator(std::random_device{}());
-        static thread_local std::uniform_real_distribution<double> distribution(-0.5, 0.5);
-        dx = distribution(generator);
-        dy = distribution(generator);
+        dx = sampler.Uniform(-0.5, 0.5);
+        dy = sampler.Uniform(-0.5, 0.5);
     }
     const double u = (0.5 * width - (double(x) + 0.5) + dx) * mPixelSize;
     const double v = (0.5 * height - (double(y) + 0.5) + dy) * mPixelSize;
 
     Vector3D direction = (mEz * mDistance) + (mEx * u) + (mEy * v);
-    return Ray(mPosition, direction.Normalized());
+    return Ray(mPosition, direction.NormalizedUnchecked());
 }
 
 void Camera::ConfigureCamera() {
@@ -341,9 +1114,45 @@ std::unique_ptr<Renderer> Camera::CreateRenderer(Renderer::Type type) {
             return std::make_unique<RendererDeterministic>();
         case Renderer::Type::PATH_TRACER_NEE:
             return std::make_unique<RendererPathTracerNEE>();
+        case Renderer::Type::PATH_TRACER_WAVEFRONT:
+            return std::make_unique<RendererPathTracerWavefront>();
         default:
             throw std::invalid_argument("Unknown renderer type");
     }
 }
 
+std::string Camera::GetCheckpointFilepath(const std::string& name) const {
+    if (mCheckpointDirectory.empty()) {
+        return RenderCheckpoint::DefaultFilepath(name);
+    }
+    return mCheckpointDirectory + "/" + name + ".checkpoint";
+}
+
+std::optional<RenderCheckpoint> Camera::LoadCheckpoint(const std::string& filepath) const {
+    try {
+        return RenderCheckpoint::Load(filepath);
+    } catch (const std::runtime_error& e) {
+        std::cerr << "Warning: " << e.what() << " Starting the render from the beginning." << std::endl;
+        return std::nullopt;
+    }
+}
+
+std::string Camera::GetShardDirectory() const {
+    return mShardDirectory.empty() ? RenderCheckpoint::DefaultShardDirectory() : mShardDirectory;
+}
+
+std::string Camera::GetFrameShardFilepath(std::size_t frame) const {
+    return GetShardDirectory() + std::format("/video_frame_{:06}.shard", frame);
+}
+
+std::string Camera::SchedulerToString(Scheduler scheduler) {
+    switch (scheduler) {
+        case Scheduler::SAMPLE_PASSES:
+            return "Sample Passes";
+        case Scheduler::TILES:
+            return "Tiles";
+    }
+    throw std::invalid_argument("Unknown scheduler");
+}
+
 }  // namespace Raytracer
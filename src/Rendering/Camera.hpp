@@ -2,11 +2,19 @@
 
 #include "Geometry/Vector.hpp"
 #include "Rendering/Ray.hpp"
+#include "Rendering/RenderCheckpoint.hpp"
 #include "Rendering/Renderer.hpp"
 #include "Scene/Scene.hpp"
 #include "Utilities/Denoiser.hpp"
 #include "Utilities/Image.hpp"
+#include "Utilities/Sampler.hpp"
 #include "Utilities/Video.hpp"
+#include "Utilities/FrameSink.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
 
 namespace Raytracer {
 
@@ -15,11 +23,24 @@ public:
     Camera(Renderer::Type rendererType);
     Camera(const Vector3D& position, const Vector3D& direction, Renderer::Type rendererType);
 
+    enum class Scheduler {
+        SAMPLE_PASSES,  // One parallel pass over the whole image per sample
+        TILES,          // Workers render all samples of a tile at once, with work stealing between workers
+    };
+
     struct Resolution {
         std::size_t width{800};
         std::size_t height{600};
     };
 
+    // Stop sampling a pixel once its relative error drops below the threshold. The samples per pixel become the maximum.
+    struct AdaptiveSampling {
+        bool enabled{false};
+        std::size_t minimumSamples{16};
+        double relativeErrorThreshold{0.01};
+        bool saveSampleCountImage{false};  // Debug image of the samples per pixel
+    };
+
     void SetPosition(const Vector3D& position);
     void SetDirection(const Vector3D& direction);
 
@@ -38,15 +59,61 @@ public:
     void SetFramesPerSecond(double fps);
     void SetSamplesPerPixel(std::size_t samples);
     void SetUseAntiAliasing(bool useAA);
+    void SetScheduler(Scheduler scheduler, std::size_t tileSize = 16);
+    void SetAdaptiveSampling(const AdaptiveSampling& adaptiveSampling);
+
+    // Render the frames of a video in parallel with one frame per thread, instead of one frame after another with all threads.
+    // This scales better for small frames or few samples per pixel, but needs memory for more frames at once.
+    void SetParallelFrames(bool parallelFrames);
+
+    // Render progressive sample passes until the wall-clock budget is used up, instead of a fixed number of samples per pixel.
+    // The pass that is running when the budget runs out is finished. A budget of zero disables the time limit.
+    void SetTimeBudget(double seconds);
+
+    // Renders with the same seed are reproducible, independent of the number of threads
+    void SetSeed(std::uint64_t seed);
+
+    // Save the progress of a render to a checkpoint at most once per interval and when it is done: an image saves its finished samples,
+    // a video the number of its finished frames. The camera leaves the checkpoints in place, and the caller removes them once the result
+    // is saved, e.g. main() after writing the image or closing the video. Until then, resuming a finished render reproduces it.
+    // An empty directory saves to the checkpoints folder of the output directory. An interval of zero disables checkpoints.
+    void SetCheckpointInterval(double seconds, std::string directory = "");
+
+    // Continue from the checkpoint of an interrupted render with the same run ID, including its seed, so that the result matches an uninterrupted render.
+    // Renders without a checkpoint start from the beginning.
+    void SetResume(bool resume);
+
+    // Render only one of several shards, e.g. in processes on different machines: a contiguous range of tiles of an image, or of frames of a video.
+    // A shard saves the samples of its tiles or frames to the shard directory instead of post-processing them, MergeImageShards() and MergeVideoShards()
+    // combine them afterwards. With the same seed, the merged render matches a render in a single process. There must be at least two shards.
+    void SetShard(std::size_t index, std::size_t count);
+    // An empty directory uses the shards folder of the run in the output directory
+    void SetShardDirectory(std::string directory);
 
     void SetDenoisingMethod(Denoiser::Method method, std::size_t iterations = 1);
     void SetRemoveHotPixels(bool remove);
 
+    Resolution GetResolution() const;
+    double GetFramesPerSecond() const;
+
     Image RenderImage(const Scene& scene, bool printProgressBar = false, bool createConvergingVideo = false) const;
-    Video RenderVideo(Scene& scene, double durationSeconds, bool printProgressBar = true);
+    // Every frame is passed to the sinks as soon as it is rendered and freed afterwards, so that the memory does not grow with the duration.
+    // Frame i is rendered from snapshots of the camera and the scene at time i / fps, so that the frames are independent of each other.
+    // Afterwards, the camera and the scene are at the end of the video.
+    // A shard saves its frames for MergeVideoShards() instead of passing them to the sinks.
+    void RenderVideo(Scene& scene, double durationSeconds, const std::vector<FrameSink*>& sinks, bool printProgressBar = true);
+
+    // Combine the samples of all shards, then denoise and tone map the whole image or every frame. Throws if the samples of a tile or a frame are missing.
+    // Only the image shards with the shard count of the latest one are merged, shards of an earlier render with a different count are left out.
+    Image MergeImageShards(const Scene& scene) const;
+    void MergeVideoShards(Scene& scene, double durationSeconds, const std::vector<FrameSink*>& sinks, bool printProgressBar = true);
 
     void PrintInfo() const;
 
+    // Primary ray through the pixel, e.g. to trace single rays through a renderer outside of RenderImage()
+    Ray CreateRay(std::size_t x, std::size_t y, Sampler& sampler, bool useAntiAliasing = true) const;
+    static std::unique_ptr<Renderer> CreateRenderer(Renderer::Type type);
+
 private:
     Vector3D mPosition;
     Vector3D mVelocity = Vector3D();
@@ -64,9 +131,32 @@ private:
     Camera::Resolution mResolution;
     double mFramesPerSecond = 30.0;
 
-    std::unique_ptr<Renderer> mRenderer;
+    std::shared_ptr<Renderer> mRenderer;  // Stateless, so copies of the camera can share it
     std::size_t mSamplesPerPixel = 1;
     bool mUseAntiAliasing = false;
+    Scheduler mScheduler = Scheduler::TILES;
+    std::size_t mTileSize = 16;
+    bool mParallelFrames = false;
+    AdaptiveSampling mAdaptiveSampling;
+    double mTimeBudgetSeconds = 0.0;
+
+    // Checkpoints
+    double mCheckpointIntervalSeconds = 0.0;
+    std::string mCheckpointDirectory;
+    bool mResume = false;
+
+    // Shards
+    std::size_t mShardIndex = 0;
+    std::size_t mShardCount = 1;
+    std::string mShardDirectory;
+    std::string mFrameShardFilepath;  // Where a frame of a video shard saves its samples
+
+    // Random numbers
+    std::uint64_t mSeed = Sampler::RandomSeed();
+    std::size_t mFrameIndex = 0;  // Decorrelates the frames of a video
+
+    // Frames that render in parallel would add up their stage timings across threads, so the video records their wall time instead
+    bool mRecordTimings = true;
 
     // Post-processing flags and constants
     Denoiser::Method mDenoisingMethod = Denoiser::Method::NONE;
@@ -74,19 +164,33 @@ private:
     bool mRemoveHotPixels = false;
 
     const double kEpsilon = 1e-6;
+    static constexpr std::size_t kProgressBarStep = 200000;  // Samples between progress bar updates
 
     // Camera dynamics
     void Translate(const Vector3D& translation);
     void Rotate(double angle, const Vector3D& axis = Vector3D({0, 0, 1}));
     void Spin(double angle, const Vector3D& axis = Vector3D({0, 0, 1}));
 
-    Ray CreateRay(std::size_t x, std::size_t y, bool useAntiAliasing = true) const;
+    struct Pixel {
+        std::size_t x;
+        std::size_t y;
+    };
+    // Samples a batch of neighbouring pixels at once, so that the renderer can trace their coherent primary rays in packets and their paths in bulk
+    void SamplePixels(const Scene& scene, std::span<const Pixel> pixels, std::uint64_t seed, std::size_t sample, std::optional<GBuffer>& gBuffer, std::span<Color> colors) const;
+    void FillGBuffer(const Scene& scene, std::span<const Pixel> pixels, GBuffer& gBuffer) const;
+    void FillGBuffer(const Scene& scene, GBuffer& gBuffer) const;
+    bool NeedsGBuffer() const;
 
-    Image CreateRawImage(const std::vector<std::vector<Color>>& accumulatedColors, std::size_t samples) const;
     void ProcessImage(Image& image, std::optional<GBuffer>& gBuffer) const;
 
     void ConfigureCamera();
-    static std::unique_ptr<Renderer> CreateRenderer(Renderer::Type type);
+    std::string GetCheckpointFilepath(const std::string& name) const;
+    // Nothing if the checkpoint does not exist or is corrupt, so that the render starts from the beginning
+    std::optional<RenderCheckpoint> LoadCheckpoint(const std::string& filepath) const;
+    std::string GetShardDirectory() const;
+    std::string GetFrameShardFilepath(std::size_t frame) const;
+    void RenderVideoShard(Scene& scene, double durationSeconds, bool printProgressBar);
+    static std::string SchedulerToString(Scheduler scheduler);
 };
 
 }  // namespace Raytracer
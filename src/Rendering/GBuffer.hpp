@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Geometry/Vector.hpp"
+#include "Utilities/AlignedAllocator.hpp"
 #include "Utilities/Color.hpp"
 #include "Utilities/Image.hpp"
 
@@ -36,7 +37,7 @@ public:
 private:
     std::size_t mWidth;
     std::size_t mHeight;
-    std::vector<GBufferData> mData;
+    AlignedVector<GBufferData> mData;
 
     void CheckBounds(std::size_t x, std::size_t y) const;
 };
@@ -7,9 +7,7 @@ namespace Raytracer {
 
 Material::Material() : mBaseColor(1.0, 1.0, 1.0), mSpecularColor(1.0, 1.0, 1.0), mEmission(0.0, 0.0, 0.0), mRoughness(0.0) {
     // Default probabilities
-    mInteractionProbabilities[InteractionType::DIFFUSE] = 1.0;
-    mInteractionProbabilities[InteractionType::REFLECTIVE] = 0.0;
-    mInteractionProbabilities[InteractionType::REFRACTIVE] = 0.0;
+    mInteractionProbabilities = {1.0, 0.0, 0.0};  // Diffuse only
 }
 
 Material::Material(const Color& baseColor, double roughness, double refractiveIndex, double meanFreePath, double radiance) :
@@ -21,44 +19,42 @@ Material::Material(const Color& baseColor, double roughness, double refractiveIn
     mMeanFreePath(meanFreePath),
     mUseFresnel(true) {
     // Default probabilities
-    mInteractionProbabilities[InteractionType::DIFFUSE] = 1.0;
-    mInteractionProbabilities[InteractionType::REFLECTIVE] = 0.0;
-    mInteractionProbabilities[InteractionType::REFRACTIVE] = 0.0;
+    mInteractionProbabilities = {1.0, 0.0, 0.0};  // Diffuse only
     NormalizeProbabilities();
 }
 
-Material::InteractionType Material::Interact(Ray& ray, const Object::Intersection& intersection, bool applyRoughness) {
+Material::InteractionType Material::Interact(Ray& ray, const Object::Intersection& intersection, Sampler& sampler, bool applyRoughness) const {
     // Draw a random number in [0,1)
-    const double r = mDistribution(mGenerator);
+    const double r = sampler.Uniform();
 
     double cumulative = 0.0;
 
-    auto probabilities = mInteractionProbabilities;
+    InteractionProbabilities probabilities = mInteractionProbabilities;
     if (mUseFresnel) {
         double cosThetaI = ray.IncidentAngleCosine(intersection.normal);
         if (cosThetaI < 0.0) {
             cosThetaI = -cosThetaI;
         }
-        auto fresnelProbs = GetFresnelCorrectedProbabilities(cosThetaI);
-        probabilities = fresnelProbs;
+        probabilities = GetFresnelCorrectedProbabilities(cosThetaI);
     }
 
     // Ensure probabilities sum to 1.0 elsewhere (constructor or setup).
-    // Iterate deterministically (use std::map or a fixed array).
-    for (const auto& [type, prob] : probabilities) {
+    // Iterate deterministically in the order of the interaction types.
+    for (InteractionType type : kInteractionTypes) {
+        const double prob = probabilities[static_cast<std::size_t>(type)];
         cumulative += prob;
         if (r <= cumulative) {
             switch (type) {
                 case InteractionType::DIFFUSE:
-                    Diffuse(ray, intersection, prob);
+                    Diffuse(ray, intersection, sampler, prob);
                     return InteractionType::DIFFUSE;
 
                 case InteractionType::REFLECTIVE:
-                    Reflect(ray, intersection, applyRoughness, prob);
+                    Reflect(ray, intersection, sampler, applyRoughness, prob);
                     return InteractionType::REFLECTIVE;
 
                 case InteractionType::REFRACTIVE:
-                    Refract(ray, intersection, applyRoughness, prob);
+                    Refract(ray, intersection, sampler, applyRoughness, prob);
                     return InteractionType::REFRACTIVE;
             }
         }
@@ -67,17 +63,17 @@ Material::InteractionType Material::Interact(Ray& ray, const Object::Intersectio
     throw std::runtime_error("Material::Interact: No interaction type selected; check probabilities.");
 }
 
-void Material::Diffuse(Ray& ray, const Object::Intersection& intersection, double probability) {
+void Material::Diffuse(Ray& ray, const Object::Intersection& intersection, Sampler& sampler, double probability) const {
     // Diffuse surface: random new direction in hemisphere
     // Build ONB around normal
     Vector3D eZ = ray.IsEntering(intersection.normal) ? intersection.normal : -1.0 * intersection.normal;
     Vector3D a = (std::fabs(eZ[0]) > 0.707) ? Vector3D({0.0, 1.0, 0.0}) : Vector3D({1.0, 0.0, 0.0});
-    Vector3D eX = a.Cross(eZ).Normalized();
+    Vector3D eX = a.Cross(eZ).NormalizedUnchecked();
     Vector3D eY = eZ.Cross(eX);
 
     // Cosine-weighted hemisphere sample in local coords
-    double u1 = mDistribution(mGenerator);
-    double u2 = mDistribution(mGenerator);
+    double u1 = sampler.Uniform();
+    double u2 = sampler.Uniform();
     double cosTheta = std::sqrt(u1);
     double sinTheta = std::sqrt(1.0 - u1);
     double phi = 2.0 * M_PI * u2;
@@ -85,7 +81,7 @@ void Material::Diffuse(Ray& ray, const Object::Intersection& intersection, doubl
     double y = sinTheta * std::sin(phi);
 
     // Transform to world and normalize
-    Vector3D newDir = (x * eX + y * eY + cosTheta * eZ).Normalized();
+    Vector3D newDir = (x * eX + y * eY + cosTheta * eZ).NormalizedUnchecked();
 
     ray.SetOrigin(intersection.point + kEpsilon * newDir);
     ray.SetDirection(newDir);
@@ -96,12 +92,12 @@ void Material::Diffuse(Ray& ray, const Object::Intersection& intersection, doubl
     ray.UpdateThroughput(GetColor(intersection) / probability);
 }
 
-void Material::Reflect(Ray& ray, const Object::Intersection& intersection, bool applyRoughness, double probability) {
+void Material::Reflect(Ray& ray, const Object::Intersection& intersection, Sampler& sampler, bool applyRoughness, double probability) const {
     Vector3D incomingDir = ray.GetDirection();
     Vector3D newDir = incomingDir - 2 * incomingDir.Dot(intersection.normal) * intersection.normal;
     if (applyRoughness && mRoughness > 0.0) {
         double cosThetaMax = std::cos(mRoughness * (M_PI / 2.0));  // roughness=1 => 90° cone
-        newDir = SampleCone(newDir, cosThetaMax);
+        newDir = SampleCone(newDir, cosThetaMax, sampler);
         // For rough reflection, divide by probability since it's continuous sampling
         ray.UpdateThroughput(mSpecularColor / probability);
     } else {
@@ -113,9 +109,9 @@ void Material::Reflect(Ray& ray, const Object::Intersection& intersection, bool
     ray.IncrementDepth();
 }
 
-void Material::Refract(Ray& ray, const Object::Intersection& intersection, bool applyRoughness, double probability) {
-    Vector3D d = ray.GetDirection().Normalized();
-    Vector3D n = intersection.normal.Normalized();
+void Material::Refract(Ray& ray, const Object::Intersection& intersection, Sampler& sampler, bool applyRoughness, double probability) const {
+    Vector3D d = ray.GetDirection().NormalizedUnchecked();
+    Vector3D n = intersection.normal.NormalizedUnchecked();
 
     // Determine if the ray is entering or exiting
     double cosThetaI = ray.IncidentAngleCosine(n);
@@ -136,7 +132,7 @@ void Material::Refract(Ray& ray, const Object::Intersection& intersection, bool
     if (sin2ThetaT > 1.0) {
         Object::Intersection tmpIntersection = intersection;
         tmpIntersection.normal = n;  // Use the correct normal for reflection
-        Reflect(ray, tmpIntersection, applyRoughness, probability);
+        Reflect(ray, tmpIntersection, sampler, applyRoughness, probability);
         return;
     }
 
@@ -144,12 +140,12 @@ void Material::Refract(Ray& ray, const Object::Intersection& intersection, bool
 
     // Refracted direction
     Vector3D refractDir = eta * d + (eta * cosThetaI - cosThetaT) * n;
-    refractDir = refractDir.Normalized();
+    refractDir = refractDir.NormalizedUnchecked();
 
     // Roughness / glossy refraction
     if (applyRoughness && mRoughness > 0.0) {
         double cosThetaMax = std::cos(mRoughness * (M_PI / 4.0));  // half the reflection roughness
-        refractDir = SampleCone(refractDir, cosThetaMax);
+        refractDir = SampleCone(refractDir, cosThetaMax, sampler);
         // For rough refraction, divide by probability since it's continuous sampling
         ray.UpdateThroughput(GetColor(intersection) / probability);
     } else {
@@ -227,11 +223,18 @@ void Material::SetUseFresnel(bool useFresnel) {
 }
 
 std::map<Material::InteractionType, double> Material::GetInteractionProbabilities() const {
-    return mInteractionProbabilities;
+    std::map<InteractionType, double> probabilities;
+    for (InteractionType type : kInteractionTypes) {
+        probabilities[type] = mInteractionProbabilities[static_cast<std::size_t>(type)];
+    }
+    return probabilities;
 }
 
 void Material::SetInteractionProbabilities(const std::map<InteractionType, double>& probs) {
-    mInteractionProbabilities = probs;
+    mInteractionProbabilities = {};
+    for (const auto& [type, prob] : probs) {
+        mInteractionProbabilities[static_cast<std::size_t>(type)] = prob;
+    }
     NormalizeProbabilities();
 }
 
@@ -239,7 +242,8 @@ Material::InteractionType Material::MostLikelyInteraction() const {
     double maxProb = 0.0;
     InteractionType mostLikely = InteractionType::DIFFUSE;
 
-    for (const auto& [type, prob] : mInteractionProbabilities) {
+    for (InteractionType type : kInteractionTypes) {
+        const double prob = mInteractionProbabilities[static_cast<std::size_t>(type)];
         if (prob > maxProb) {
             maxProb = prob;
             mostLikely = type;
@@ -265,7 +269,8 @@ void Material::PrintInfo() const {
               << "\tMean Free Path:\t" << mMeanFreePath << std::endl
               << "\tUse Fresnel:\t" << (mUseFresnel ? "[x]" : "[ ]") << std::endl
               << "\tInteraction Probabilities:" << std::endl;
-    for (const auto& [type, prob] : mInteractionProbabilities) {
+    for (InteractionType type : kInteractionTypes) {
+        const double prob = mInteractionProbabilities[static_cast<std::size_t>(type)];
         std::string typeStr;
         switch (type) {
             case InteractionType::DIFFUSE:
@@ -285,48 +290,42 @@ void Material::PrintInfo() const {
 
 void Material::NormalizeProbabilities() {
     double total = 0.0;
-    for (const auto& pair : mInteractionProbabilities) {
-        total += pair.second;
+    for (double prob : mInteractionProbabilities) {
+        total += prob;
     }
-    for (auto& pair : mInteractionProbabilities) {
-        pair.second /= total;
+    for (double& prob : mInteractionProbabilities) {
+        prob /= total;
     }
 }
 
-std::map<Material::InteractionType, double> Material::GetFresnelCorrectedProbabilities(double cosThetaI) const {
-    double RO = mInteractionProbabilities.at(InteractionType::REFLECTIVE);
+Material::InteractionProbabilities Material::GetFresnelCorrectedProbabilities(double cosThetaI) const {
+    const auto [diffuseProbability, RO, refractiveProbability] = mInteractionProbabilities;
 
     if (RO < kEpsilon) {
         // No reflective component, nothing to adjust
         return mInteractionProbabilities;
     } else if (RO > 1.0 - kEpsilon) {
         // Perfect mirror, all probability to reflection
-        return {
-            {Material::InteractionType::DIFFUSE, 0.0},
-            {Material::InteractionType::REFLECTIVE, 1.0},
-            {Material::InteractionType::REFRACTIVE, 0.0}};
+        return {0.0, 1.0, 0.0};
     }
 
     // Schlick's approximation
     double R = RO + (1.0 - RO) * std::pow(1.0 - cosThetaI, 5);
 
     // Rescale the other two probabilities
-    double rescaledDiffuseProbability = mInteractionProbabilities.at(InteractionType::DIFFUSE) * (1.0 - R) / (1.0 - RO);
-    double rescaledRefractiveProbability = mInteractionProbabilities.at(InteractionType::REFRACTIVE) * (1.0 - R) / (1.0 - RO);
+    double rescaledDiffuseProbability = diffuseProbability * (1.0 - R) / (1.0 - RO);
+    double rescaledRefractiveProbability = refractiveProbability * (1.0 - R) / (1.0 - RO);
 
     // TODO Check the normalization
     // TODO Check validity when R0 = 0 or 1
     // TODO Incident angel as function
 
-    return {
-        {Material::InteractionType::DIFFUSE, rescaledDiffuseProbability},
-        {Material::InteractionType::REFLECTIVE, R},
-        {Material::InteractionType::REFRACTIVE, rescaledRefractiveProbability}};
+    return {rescaledDiffuseProbability, R, rescaledRefractiveProbability};
 }
 
-Vector3D Material::SampleCone(const Vector3D& axis, double cosThetaMax) {
-    double u1 = mDistribution(mGenerator);  // ∈ [0,1)
-    double u2 = mDistribution(mGenerator);
+Vector3D Material::SampleCone(const Vector3D& axis, double cosThetaMax, Sampler& sampler) {
+    double u1 = sampler.Uniform();  // ∈ [0,1)
+    double u2 = sampler.Uniform();
 
     // Uniform sampling of cos(theta) in [cosThetaMax, 1]
     double cosTheta = (1.0 - u1) + u1 * cosThetaMax;  // linear interpolation
@@ -340,10 +339,10 @@ Vector3D Material::SampleCone(const Vector3D& axis, double cosThetaMax) {
     // Build orthonormal basis
     Vector3D eZ = axis.Normalized();
     Vector3D a = (std::fabs(eZ[0]) > 0.707) ? Vector3D{0.0, 1.0, 0.0} : Vector3D{1.0, 0.0, 0.0};
-    Vector3D eX = a.Cross(eZ).Normalized();
+    Vector3D eX = a.Cross(eZ).NormalizedUnchecked();
     Vector3D eY = eZ.Cross(eX);
 
-    return (x * eX + y * eY + z * eZ).Normalized();
+    return (x * eX + y * eY + z * eZ).NormalizedUnchecked();
 }
 
 }  // namespace Raytracer
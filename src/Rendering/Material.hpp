@@ -3,11 +3,12 @@
 #include "Rendering/Ray.hpp"
 #include "Scene/Object.hpp"
 #include "Utilities/Color.hpp"
+#include "Utilities/Sampler.hpp"
 #include "Utilities/Texture.hpp"
 
+#include <array>
 #include <map>
 #include <optional>
-#include <random>
 
 namespace Raytracer {
 
@@ -22,11 +23,12 @@ public:
     Material();
     Material(const Color& baseColor, double roughness = 1.0, double refractiveIndex = 1.0, double meanFreePath = 0.0, double radiance = 0.0);
 
-    InteractionType Interact(Ray& ray, const Object::Intersection& intersection, bool applyRoughness = true);
+    // Random numbers are drawn from the caller's sampler, so that a material can be shared by all render threads
+    InteractionType Interact(Ray& ray, const Object::Intersection& intersection, Sampler& sampler, bool applyRoughness = true) const;
 
-    void Diffuse(Ray& incomingRay, const Object::Intersection& intersection, double probability = 1.0);
-    void Reflect(Ray& incomingRay, const Object::Intersection& intersection, bool applyRoughness, double probability = 1.0);
-    void Refract(Ray& incomingRay, const Object::Intersection& intersection, bool applyRoughness, double probability = 1.0);
+    void Diffuse(Ray& incomingRay, const Object::Intersection& intersection, Sampler& sampler, double probability = 1.0) const;
+    void Reflect(Ray& incomingRay, const Object::Intersection& intersection, Sampler& sampler, bool applyRoughness, double probability = 1.0) const;
+    void Refract(Ray& incomingRay, const Object::Intersection& intersection, Sampler& sampler, bool applyRoughness, double probability = 1.0) const;
 
     // Get color at intersection point (with texture if available)
     Color GetColor(const Object::Intersection& intersection) const;
@@ -71,20 +73,18 @@ private:
     bool mUseFresnel;
 
     static constexpr double kEpsilon = 1e-4;  // Increased to prevent refraction loops in glass
-    // Probability for each interaction type
-    std::map<InteractionType, double> mInteractionProbabilities;
-
-    // Random numbers:
-    std::mt19937 mGenerator{std::random_device{}()};
-    std::uniform_real_distribution<double> mDistribution{0.0, 1.0};
+    // Probability for each interaction type, indexed by InteractionType (a fixed array, so that no map is copied per interaction)
+    static constexpr std::array<InteractionType, 3> kInteractionTypes = {InteractionType::DIFFUSE, InteractionType::REFLECTIVE, InteractionType::REFRACTIVE};
+    using InteractionProbabilities = std::array<double, kInteractionTypes.size()>;
+    InteractionProbabilities mInteractionProbabilities{};
 
     // Optional texture
     std::optional<Texture> mColorTexture = std::nullopt;
 
     void NormalizeProbabilities();
-    std::map<InteractionType, double> GetFresnelCorrectedProbabilities(double cosThetaI) const;
+    InteractionProbabilities GetFresnelCorrectedProbabilities(double cosThetaI) const;
 
-    Vector3D SampleCone(const Vector3D& axis, double cosThetaMax);
+    static Vector3D SampleCone(const Vector3D& axis, double cosThetaMax, Sampler& sampler);
 };
 
 }  // namespace Raytracer
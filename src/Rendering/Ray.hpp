@@ -30,7 +30,7 @@ private:
 
     size_t mDepth = 0;  // Number of interactions
 
-    static constexpr double sEpsilon = 1e-6;
+    static constexpr double sEpsilon = 1e-6 * kToleranceScale;
 };
 
 }  // namespace Raytracer
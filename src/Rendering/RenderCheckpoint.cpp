@@ -0,0 +1,139 @@
+#include "Rendering/RenderCheckpoint.hpp"
+
+#include "Utilities/Configuration.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace Raytracer {
+
+namespace {
+
+void WriteValue(std::ostream& stream, std::uint64_t value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::uint64_t ReadValue(std::istream& stream) {
+    std::uint64_t value = 0;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+}  // namespace
+
+void RenderCheckpoint::Save(const std::string& filepath) const {
+    const std::filesystem::path path(filepath);
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path());
+    }
+    const std::filesystem::path temporaryPath = path.string() + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("RenderCheckpoint::Save: Could not write " + temporaryPath.string());
+        }
+        file.write(kMagic, sizeof(kMagic));
+        for (std::uint64_t value : {std::uint64_t(seed), std::uint64_t(frame), std::uint64_t(width), std::uint64_t(height), std::uint64_t(samplesPerPixel), std::uint64_t(tileSize), std::uint64_t(completedPasses)}) {
+            WriteValue(file, value);
+        }
+        file.write(reinterpret_cast<const char*>(&elapsedSeconds), sizeof(elapsedSeconds));
+        WriteValue(file, completedTiles.size());
+        std::vector<char> tiles(completedTiles.begin(), completedTiles.end());
+        file.write(tiles.data(), tiles.size());
+        WriteValue(file, accumulation.has_value() ? 1 : 0);
+        if (accumulation) {
+            accumulation->Write(file);
+        }
+        if (!file) {
+            throw std::runtime_error("RenderCheckpoint::Save: Could not write " + temporaryPath.string());
+        }
+    }
+    std::filesystem::rename(temporaryPath, path);
+}
+
+std::optional<RenderCheckpoint> RenderCheckpoint::Load(const std::string& filepath) {
+    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return std::nullopt;
+    }
+    const std::uint64_t fileSize = file.tellg();
+    file.seekg(0);
+    auto remainingBytes = [&]() {
+        return file ? fileSize - std::uint64_t(file.tellg()) : 0;
+    };
+    auto corrupt = [&](const std::string& reason) {
+        return std::runtime_error("RenderCheckpoint::Load: " + filepath + " is corrupt, " + reason + ".");
+    };
+    char magic[sizeof(kMagic)];
+    if (!file.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), kMagic)) {
+        throw std::runtime_error("RenderCheckpoint::Load: " + filepath + " is not a checkpoint.");
+    }
+
+    RenderCheckpoint checkpoint;
+    checkpoint.seed = ReadValue(file);
+    checkpoint.frame = ReadValue(file);
+    checkpoint.width = ReadValue(file);
+    checkpoint.height = ReadValue(file);
+    checkpoint.samplesPerPixel = ReadValue(file);
+    checkpoint.tileSize = ReadValue(file);
+    checkpoint.completedPasses = ReadValue(file);
+    file.read(reinterpret_cast<char*>(&checkpoint.elapsedSeconds), sizeof(checkpoint.elapsedSeconds));
+    if (!file) {
+        throw corrupt("the header is incomplete");
+    }
+    if (checkpoint.width == 0 || checkpoint.height == 0 || !std::isfinite(checkpoint.elapsedSeconds) || checkpoint.elapsedSeconds < 0.0) {
+        throw corrupt("the header is invalid");
+    }
+
+    // A tiled render has one flag per tile of its resolution
+    const std::uint64_t numberOfTiles = ReadValue(file);
+    if (numberOfTiles > remainingBytes()) {
+        throw corrupt("it is truncated");
+    }
+    const std::size_t tileSize = checkpoint.tileSize;
+    const std::uint64_t expectedTiles = (tileSize == 0) ? 0 : ((checkpoint.width + tileSize - 1) / tileSize) * ((checkpoint.height + tileSize - 1) / tileSize);
+    if (numberOfTiles != expectedTiles) {
+        throw corrupt("it has " + std::to_string(numberOfTiles) + " tiles instead of " + std::to_string(expectedTiles));
+    }
+    std::vector<char> tiles(numberOfTiles);
+    file.read(tiles.data(), tiles.size());
+    checkpoint.completedTiles.assign(tiles.begin(), tiles.end());
+
+    // The accumulation buffer has the resolution of the checkpoint, stores a band of its rows and ends the file
+    const std::uint64_t hasAccumulation = ReadValue(file);
+    if (!file) {
+        throw corrupt("it is truncated");
+    }
+    if (hasAccumulation != 0) {
+        std::uint64_t header[5] = {0, 0, 0, 0, 0};
+        file.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!file || header[0] != checkpoint.width || header[1] != checkpoint.height || header[2] > header[3] || header[3] > checkpoint.height) {
+            throw corrupt("the samples do not match its resolution");
+        }
+        file.seekg(-static_cast<std::streamoff>(sizeof(header)), std::ios::cur);
+        // Every pixel takes at least one Pixel, which bounds the band before its size is computed
+        const std::uint64_t numberOfRows = header[3] - header[2];
+        if ((numberOfRows > 0 && checkpoint.width > remainingBytes() / sizeof(AccumulationBuffer::Pixel) / numberOfRows) ||
+            AccumulationBuffer::SerializedSize(checkpoint.width, numberOfRows, header[4] != 0) != remainingBytes()) {
+            throw corrupt("the size of the samples does not match its resolution");
+        }
+        checkpoint.accumulation = AccumulationBuffer::Read(file);
+    }
+    if (!file || remainingBytes() != 0) {
+        throw corrupt("its size does not match its contents");
+    }
+    return checkpoint;
+}
+
+std::string RenderCheckpoint::DefaultFilepath(const std::string& name) {
+    return Configuration::GetInstance().GetOutputDirectory() + "/checkpoints/" + name + "_" + Configuration::GetInstance().GetRunID() + ".checkpoint";
+}
+
+std::string RenderCheckpoint::DefaultShardDirectory() {
+    return Configuration::GetInstance().GetOutputDirectory() + "/shards/" + Configuration::GetInstance().GetRunID();
+}
+
+}  // namespace Raytracer
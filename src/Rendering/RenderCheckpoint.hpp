@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Rendering/AccumulationBuffer.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Raytracer {
+
+// Progress of a render, saved periodically so that an interrupted render can continue where it stopped.
+// Every pixel sample draws its random numbers from its own stream derived from (seed, frame, pixel, sample), so the seed and the finished
+// work are the complete random state: a resumed render draws exactly the samples that the interrupted render would have drawn next.
+struct RenderCheckpoint {
+    std::uint64_t seed = 0;
+    std::size_t frame = 0;  // Frame of the image, or the number of finished frames of a video
+    std::size_t width = 0;
+    std::size_t height = 0;
+    std::size_t samplesPerPixel = 0;
+    std::size_t tileSize = 0;            // Zero for sample passes
+    std::size_t completedPasses = 0;     // Sample passes over the whole image that have finished
+    std::vector<bool> completedTiles;    // Tiles of which all samples have finished
+    double elapsedSeconds = 0.0;         // Render time so far, e.g. for the time budget
+    std::optional<AccumulationBuffer> accumulation;  // Finished samples, empty for videos
+
+    // Written to a temporary file first and then renamed, so that a crash while saving keeps the previous checkpoint intact
+    void Save(const std::string& filepath) const;
+
+    // Nothing if the file does not exist. Throws if the file is not a valid checkpoint, e.g. if it is truncated or its sizes do not match
+    // its resolution. Nothing is allocated before the sizes have been checked against the size of the file.
+    static std::optional<RenderCheckpoint> Load(const std::string& filepath);
+
+    // Checkpoint of the current run in the output directory, e.g. "image" or "video"
+    static std::string DefaultFilepath(const std::string& name);
+
+    // Folder of the current run in the output directory, where the shards of a distributed render save their samples for the merge
+    static std::string DefaultShardDirectory();
+
+private:
+    static constexpr char kMagic[8] = {'R', 'T', 'C', 'H', 'E', 'C', 'K', '2'};
+};
+
+}  // namespace Raytracer
@@ -0,0 +1,206 @@
+#include "Rendering/RenderStatistics.hpp"
+
+#include "Utilities/Configuration.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace Raytracer {
+
+namespace {
+
+std::mutex sMutex;
+std::vector<RenderStatistics::Counters*> sThreadCounters;  // of all running threads that have counted something
+RenderStatistics::Counters sRetiredCounters;               // of threads that have exited
+RenderStatistics::Timings sTimings;
+RenderStatistics::Sampling sSampling;
+
+// Registers the counters of a thread on construction, and keeps them when the thread exits
+struct ThreadCounters {
+    RenderStatistics::Counters counters;
+
+    ThreadCounters() {
+        std::lock_guard<std::mutex> lock(sMutex);
+        sThreadCounters.push_back(&counters);
+    }
+
+    ~ThreadCounters() {
+        std::lock_guard<std::mutex> lock(sMutex);
+        sRetiredCounters += counters;
+        std::erase(sThreadCounters, &counters);
+    }
+};
+
+}  // namespace
+
+double RenderStatistics::Counters::AveragePathDepth() const {
+    return (primaryRays > 0) ? double(bounceRays) / double(primaryRays) : 0.0;
+}
+
+std::uint64_t RenderStatistics::Counters::TotalIntersectionTests() const {
+    return std::accumulate(intersectionTests.begin(), intersectionTests.end(), std::uint64_t(0));
+}
+
+RenderStatistics::Counters& RenderStatistics::Counters::operator+=(const Counters& other) {
+    primaryRays += other.primaryRays;
+    bounceRays += other.bounceRays;
+    shadowRays += other.shadowRays;
+    russianRouletteTerminations += other.russianRouletteTerminations;
+    for (std::size_t i = 0; i < kNumberOfShapeTypes; i++) {
+        intersectionTests[i] += other.intersectionTests[i];
+    }
+    return *this;
+}
+
+double RenderStatistics::Sampling::AverageSamplesPerPixel() const {
+    return (pixels > 0) ? double(samples) / double(pixels) : 0.0;
+}
+
+double RenderStatistics::Timings::operator[](Stage stage) const {
+    return seconds[static_cast<std::size_t>(stage)];
+}
+
+RenderStatistics::Counters& RenderStatistics::Local() {
+    thread_local ThreadCounters threadCounters;
+    return threadCounters.counters;
+}
+
+void RenderStatistics::CountPrimaryRays(std::uint64_t count) {
+    Local().primaryRays += count;
+}
+
+void RenderStatistics::CountBounceRays(std::uint64_t count) {
+    Local().bounceRays += count;
+}
+
+void RenderStatistics::CountShadowRays(std::uint64_t count) {
+    Local().shadowRays += count;
+}
+
+void RenderStatistics::CountRussianRouletteTermination() {
+    Local().russianRouletteTerminations++;
+}
+
+void RenderStatistics::CountIntersectionTests(Geometry::Shape::Type type, std::uint64_t count) {
+    Local().intersectionTests[static_cast<std::size_t>(type)] += count;
+}
+
+void RenderStatistics::AddTime(Stage stage, double seconds) {
+    std::lock_guard<std::mutex> lock(sMutex);
+    sTimings.seconds[static_cast<std::size_t>(stage)] += seconds;
+}
+
+void RenderStatistics::AddSamples(std::uint64_t pixels, std::uint64_t samples, std::uint64_t maximumSamplesPerPixel) {
+    std::lock_guard<std::mutex> lock(sMutex);
+    sSampling.pixels += pixels;
+    sSampling.samples += samples;
+    sSampling.maximumSamplesPerPixel = std::max(sSampling.maximumSamplesPerPixel, maximumSamplesPerPixel);
+}
+
+RenderStatistics::Counters RenderStatistics::Collect() {
+    std::lock_guard<std::mutex> lock(sMutex);
+    Counters total = sRetiredCounters;
+    for (const Counters* counters : sThreadCounters) {
+        total += *counters;
+    }
+    return total;
+}
+
+RenderStatistics::Timings RenderStatistics::CollectTimings() {
+    std::lock_guard<std::mutex> lock(sMutex);
+    return sTimings;
+}
+
+RenderStatistics::Sampling RenderStatistics::CollectSampling() {
+    std::lock_guard<std::mutex> lock(sMutex);
+    return sSampling;
+}
+
+void RenderStatistics::Reset() {
+    std::lock_guard<std::mutex> lock(sMutex);
+    for (Counters* counters : sThreadCounters) {
+        *counters = Counters();
+    }
+    sRetiredCounters = Counters();
+    sTimings = Timings();
+    sSampling = Sampling();
+}
+
+std::string RenderStatistics::StageToString(Stage stage) {
+    switch (stage) {
+        case Stage::TRACE:
+            return "trace";
+        case Stage::DENOISE:
+            return "denoise";
+        case Stage::TONEMAP:
+            return "tonemap";
+        case Stage::ENCODE:
+            return "encode";
+    }
+    throw std::invalid_argument("Unknown render stage");
+}
+
+bool RenderStatistics::Save(std::string filepath) {
+    if (filepath.empty()) {
+        std::string directory = Configuration::GetInstance().GetOutputDirectory() + "/images";
+        std::filesystem::create_directories(directory);
+        filepath = directory + "/statistics_" + Configuration::GetInstance().GetRunID() + ".json";
+    }
+
+    std::ofstream file(filepath);
+    if (!file) {
+        std::cerr << "Error: Could not write render statistics to " << filepath << std::endl;
+        return false;
+    }
+
+    const Counters counters = Collect();
+    const Timings timings = CollectTimings();
+    const Sampling sampling = CollectSampling();
+    file << std::setprecision(9);
+    file << "{" << std::endl
+         << "  \"primary_rays\": " << counters.primaryRays << "," << std::endl
+         << "  \"bounce_rays\": " << counters.bounceRays << "," << std::endl
+         << "  \"shadow_rays\": " << counters.shadowRays << "," << std::endl
+         << "  \"average_path_depth\": " << counters.AveragePathDepth() << "," << std::endl
+         << "  \"russian_roulette_terminations\": " << counters.russianRouletteTerminations << "," << std::endl
+         << "  \"samples_per_pixel\": {\"average\": " << sampling.AverageSamplesPerPixel() << ", \"maximum\": " << sampling.maximumSamplesPerPixel << "}," << std::endl
+         << "  \"intersection_tests\": {" << std::endl;
+    for (std::size_t i = 0; i < kNumberOfShapeTypes; i++) {
+        file << "    \"" << Geometry::Shape::TypeToString(static_cast<Geometry::Shape::Type>(i)) << "\": " << counters.intersectionTests[i] << ((i + 1 < kNumberOfShapeTypes) ? "," : "") << std::endl;
+    }
+    file << "  }," << std::endl
+         << "  \"seconds\": {" << std::endl;
+    for (std::size_t i = 0; i < kNumberOfStages; i++) {
+        file << "    \"" << StageToString(static_cast<Stage>(i)) << "\": " << timings.seconds[i] << ((i + 1 < kNumberOfStages) ? "," : "") << std::endl;
+    }
+    file << "  }" << std::endl
+         << "}" << std::endl;
+    return true;
+}
+
+void RenderStatistics::PrintInfo() {
+    const Counters counters = Collect();
+    const Timings timings = CollectTimings();
+    const Sampling sampling = CollectSampling();
+    std::cout << "Render Statistics:" << std::endl
+              << "Primary Rays:\t" << counters.primaryRays << std::endl
+              << "Bounce Rays:\t" << counters.bounceRays << std::endl
+              << "Shadow Rays:\t" << counters.shadowRays << std::endl
+              << "Path Depth:\t" << counters.AveragePathDepth() << " (Russian Roulette Terminations: " << counters.russianRouletteTerminations << ")" << std::endl
+              << "Intersections:\t" << counters.TotalIntersectionTests() << std::endl
+              << "Samples/Pixel:\t" << sampling.AverageSamplesPerPixel() << " (maximum " << sampling.maximumSamplesPerPixel << ")" << std::endl
+              << "Time [s]:\t";
+    for (std::size_t i = 0; i < kNumberOfStages; i++) {
+        std::cout << StageToString(static_cast<Stage>(i)) << " " << timings.seconds[i] << ((i + 1 < kNumberOfStages) ? ", " : "");
+    }
+    std::cout << std::endl;
+}
+
+}  // namespace Raytracer
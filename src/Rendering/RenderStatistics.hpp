@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Geometry/Shape.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Raytracer {
+
+// Counters and timings of a render, e.g. to attribute a slowdown to specific scene content.
+// Every thread counts into its own thread-local counters, so the hot path never takes a lock or touches shared cache lines. Collect()
+// merges the counters of all threads and must therefore only be called while no thread is rendering, e.g. after the parallel regions.
+class RenderStatistics {
+public:
+    static constexpr std::size_t kNumberOfShapeTypes = static_cast<std::size_t>(Geometry::Shape::Type::TUBE) + 1;
+
+    struct Counters {
+        std::uint64_t primaryRays = 0;
+        std::uint64_t bounceRays = 0;
+        std::uint64_t shadowRays = 0;
+        std::uint64_t russianRouletteTerminations = 0;
+        std::array<std::uint64_t, kNumberOfShapeTypes> intersectionTests{};
+
+        // Bounce rays per primary ray
+        double AveragePathDepth() const;
+        std::uint64_t TotalIntersectionTests() const;
+
+        Counters& operator+=(const Counters& other);
+    };
+
+    enum class Stage {
+        TRACE,
+        DENOISE,
+        TONEMAP,
+        ENCODE,
+    };
+    static constexpr std::size_t kNumberOfStages = static_cast<std::size_t>(Stage::ENCODE) + 1;
+
+    struct Timings {
+        std::array<double, kNumberOfStages> seconds{};
+
+        double operator[](Stage stage) const;
+    };
+
+    // Samples that the rendered images actually got, e.g. with adaptive sampling or a time budget
+    struct Sampling {
+        std::uint64_t pixels = 0;
+        std::uint64_t samples = 0;
+        std::uint64_t maximumSamplesPerPixel = 0;
+
+        double AverageSamplesPerPixel() const;
+    };
+
+    // Counters of the calling thread. The first call of a thread registers its counters, which is the only point that takes a lock.
+    static Counters& Local();
+
+    static void CountPrimaryRays(std::uint64_t count = 1);
+    static void CountBounceRays(std::uint64_t count = 1);
+    static void CountShadowRays(std::uint64_t count = 1);
+    static void CountRussianRouletteTermination();
+    static void CountIntersectionTests(Geometry::Shape::Type type, std::uint64_t count = 1);
+
+    // Timings are only recorded by the thread that drives the render, so they add up to at most the wall time.
+    // Video frames that render in parallel record their tracing and post-processing together as TRACE.
+    static void AddTime(Stage stage, double seconds);
+    static void AddSamples(std::uint64_t pixels, std::uint64_t samples, std::uint64_t maximumSamplesPerPixel);
+
+    // Sum over all threads, including threads that have exited since the last Reset()
+    static Counters Collect();
+    static Timings CollectTimings();
+    static Sampling CollectSampling();
+    static void Reset();
+
+    static std::string StageToString(Stage stage);
+
+    // Writes the merged counters and timings as JSON, by default next to the rendered image in the output directory
+    static bool Save(std::string filepath = "");
+    static void PrintInfo();
+};
+
+}  // namespace Raytracer
@@ -1,16 +1,20 @@
 #include "Rendering/Renderer.hpp"
 
+#include "Rendering/RenderStatistics.hpp"
 #include "Scene/ObjectPrimitive.hpp"
 
+#include <array>
+
 namespace Raytracer {
 
 Renderer::Renderer(Type type, bool deterministic) :
     mType(type),
     mIsDeterministic(deterministic) {}
 
+// The G-buffer rays bypass Intersect(), so that they are not counted a second time as primary rays in the render statistics
 GBufferData Renderer::ComputeGBuffer(Ray& ray, const Scene& scene) {
     GBufferData gBuffer;
-    auto intersection = Intersect(ray, scene);
+    auto intersection = scene.Intersect(ray, kEpsilon);
     if (intersection.has_value()) {
         // Fill G-Buffer data
         gBuffer.hit = true;
@@ -21,6 +25,30 @@ GBufferData Renderer::ComputeGBuffer(Ray& ray, const Scene& scene) {
     return gBuffer;
 }
 
+void Renderer::ComputeGBuffer(std::span<const Ray> rays, const Scene& scene, std::span<GBufferData> gBuffer) {
+    std::array<std::optional<Object::Intersection>, Geometry::LinePacket::kMaximumSize> intersections;
+    for (std::size_t begin = 0; begin < rays.size(); begin += intersections.size()) {
+        const std::size_t count = std::min(intersections.size(), rays.size() - begin);
+        scene.Intersect(rays.subspan(begin, count), intersections, kEpsilon);
+        for (std::size_t i = 0; i < count; i++) {
+            GBufferData& data = gBuffer[begin + i];
+            data = GBufferData();
+            if (intersections[i].has_value()) {
+                data.hit = true;
+                data.depth = static_cast<float>(intersections[i]->t);
+                data.normal = intersections[i]->normal;
+                data.albedo = intersections[i]->object->GetMaterial().GetColor(intersections[i].value());
+            }
+        }
+    }
+}
+
+void Renderer::TraceRays(std::span<const Ray> rays, const Scene& scene, std::span<Sampler> samplers, std::span<Color> colors) {
+    for (std::size_t i = 0; i < rays.size(); i++) {
+        colors[i] = TraceRay(rays[i], scene, samplers[i]);
+    }
+}
+
 bool Renderer::IsDeterministic() const {
     return mIsDeterministic;
 }
@@ -41,30 +69,40 @@ std::string Renderer::GetTypeString() const {
             return "Path Tracer";
         case Type::PATH_TRACER_NEE:
             return "Path Tracer with Next Event Estimation";
+        case Type::PATH_TRACER_WAVEFRONT:
+            return "Wavefront Path Tracer with Next Event Estimation";
     }
 }
 
 std::optional<Object::Intersection> Renderer::Intersect(const Ray& ray, const Scene& scene) {
-    std::optional<Object::Intersection> closestHit;
-    for (const auto& object : scene.GetObjects()) {
-        if (!object || !object->IsVisible()) {
-            continue;
-        }
+    if (ray.GetDepth() == 0) {
+        RenderStatistics::CountPrimaryRays();
+    } else {
+        RenderStatistics::CountBounceRays();
+    }
+    return scene.Intersect(ray, kEpsilon);
+}
 
-        if (auto intersection = object->Intersect(ray)) {
-            if (intersection->t > kEpsilon && (!closestHit || intersection->t < closestHit->t)) {
-                closestHit.emplace(*intersection);
-            }
+void Renderer::Intersect(std::span<const Ray> rays, const Scene& scene, std::span<std::optional<Object::Intersection>> intersections) {
+    for (const Ray& ray : rays) {
+        if (ray.GetDepth() == 0) {
+            RenderStatistics::CountPrimaryRays();
+        } else {
+            RenderStatistics::CountBounceRays();
         }
     }
-    return closestHit;
+    scene.Intersect(rays, intersections, kEpsilon);
+}
+
+bool Renderer::Occluded(const Ray& ray, const Scene& scene, double maxDistance) {
+    return scene.Occluded(ray, maxDistance, kEpsilon);
 }
 
 // Taking throughput before the material interaction to avoid double-multiplying the surface albedo when direct light sampling is used after Material::Diffuse()
-void Renderer::CollectDirectLighting(Ray& ray, const Scene& scene, const Object::Intersection& intersection, const Color& throughputBefore, std::size_t numLightSamples) {
+void Renderer::CollectDirectLighting(Ray& ray, const Scene& scene, const Object::Intersection& intersection, const Color& throughputBefore, Sampler& sampler, std::size_t numLightSamples) {
     const auto& material = intersection.object->GetMaterial();
     const Vector3D& x = intersection.point;
-    Vector3D n = intersection.normal.Normalized();
+    Vector3D n = intersection.normal.NormalizedUnchecked();
 
     if (ray.IsEntering(n)) {
         n = -1.0 * n;
@@ -73,33 +111,46 @@ void Renderer::CollectDirectLighting(Ray& ray, const Scene& scene, const Object:
     bool anyLightHit = false;
     Color directRadiance(0.0, 0.0, 0.0);
     for (const auto& lightSource : scene.GetLightSources()) {
-        const double lightArea = lightSource->GetShape()->SurfaceArea();
-
-        const std::vector<Vector3D> lightPoints = mIsDeterministic ? lightSource->GetShape()->GetKeyPoints() : lightSource->GetShape()->SampleSurfacePoints(numLightSamples, mGenerator);
+        if (!lightSource->IsVisible()) {
+            continue;
+        }
+        const auto& lightShape = lightSource->GetShape();
+        const double lightArea = lightShape->SurfaceArea();
+        const std::size_t numLightPoints = mIsDeterministic ? lightShape->GetKeyPoints().size() : numLightSamples;
 
         Color colorSum(0.0, 0.0, 0.0);
 
-        for (const Vector3D& y : lightPoints) {
+        for (std::size_t i = 0; i < numLightPoints; i++) {
+            // Light points are generated one at a time to avoid allocating a buffer for every shading point
+            const Vector3D y = mIsDeterministic ? lightShape->GetKeyPoints()[i] : lightShape->SampleSurfacePoint(sampler);
             Vector3D toLight = y - x;
             const double dist2 = toLight.NormSquared();
             toLight.Normalize();
 
+            // Find where the shadow ray enters the light source, then only test the segment in front of it for blockers
             Ray shadowRay(x + toLight * kEpsilon, toLight);
-            auto shadowHit = Intersect(shadowRay, scene);
-            if (!shadowHit.has_value() || shadowHit->object != lightSource) {
+            RenderStatistics::CountShadowRays();
+            RenderStatistics::CountIntersectionTests(lightShape->GetType());
+            auto lightHit = lightShape->Intersect(shadowRay);
+            if (!lightHit.has_value() || lightHit->t <= kEpsilon || Occluded(shadowRay, scene, lightHit->t - kEpsilon)) {
                 continue;  // occluded or no intersection
             }
             anyLightHit = true;
-            const Vector3D nL = shadowHit->normal.Normalized();
+            const Vector3D nL = lightHit->normal.NormalizedUnchecked();
 
-            const double cosSurface = std::max(0.0, n.Dot(toLight));
+            const double cosSurface = std::max<double>(0.0, n.Dot(toLight));
             const double cosLight = std::abs(nL.Dot((-1.0) * toLight));
 
             if (cosSurface <= 0.0 || cosLight <= 0.0) {
                 continue;
             }
 
-            const Color Le = lightSource->GetMaterial().GetEmission() * lightSource->GetColor(*shadowHit);  // emitted radiance (RGB)
+            Object::Intersection lightIntersection;
+            lightIntersection.t = lightHit->t;
+            lightIntersection.point = lightHit->point;
+            lightIntersection.normal = lightHit->normal;
+            lightIntersection.object = lightSource.get();
+            const Color Le = lightSource->GetMaterial().GetEmission() * lightSource->GetColor(lightIntersection);  // emitted radiance (RGB)
 
             // Lambertian BRDF: include surface albedo (texture/base color)
             const Color f_r = material.GetColor(intersection) * (1.0 / M_PI);
@@ -110,7 +161,7 @@ void Renderer::CollectDirectLighting(Ray& ray, const Scene& scene, const Object:
             // Direct contribution
             colorSum += f_r * Le * G;
         }
-        directRadiance += colorSum / static_cast<double>(lightPoints.size());
+        directRadiance += colorSum / static_cast<double>(numLightPoints);
     }
 
     if (!anyLightHit) {
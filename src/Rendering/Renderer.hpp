@@ -4,9 +4,10 @@
 #include "Rendering/Ray.hpp"
 #include "Scene/Scene.hpp"
 #include "Utilities/Color.hpp"
+#include "Utilities/Sampler.hpp"
 
 #include <optional>
-#include <random>
+#include <span>
 #include <string>
 
 namespace Raytracer {
@@ -19,13 +20,19 @@ public:
         RAY_TRACER,
         PATH_TRACER,
         PATH_TRACER_NEE,
+        PATH_TRACER_WAVEFRONT,
         // Future renderers can be added here
     };
 
     explicit Renderer(Type type, bool deterministic);
 
     GBufferData ComputeGBuffer(Ray& ray, const Scene& scene);
-    virtual Color TraceRay(Ray ray, const Scene& scene) = 0;
+    virtual Color TraceRay(Ray ray, const Scene& scene, Sampler& sampler) = 0;
+
+    // Batched versions for coherent rays, e.g. the primary rays of neighbouring pixels, whose closest hits are found in SIMD packets.
+    // Renderers whose rays diverge after the first bounce keep the default TraceRays(), which traces the rays one by one.
+    void ComputeGBuffer(std::span<const Ray> rays, const Scene& scene, std::span<GBufferData> gBuffer);
+    virtual void TraceRays(std::span<const Ray> rays, const Scene& scene, std::span<Sampler> samplers, std::span<Color> colors);
 
     bool IsDeterministic() const;
 
@@ -38,13 +45,14 @@ protected:
     const size_t kMaximumDepth = 10;  // Maximum recursion depth for rays
     double kAmbientFactor = 0.0;
 
-    static constexpr double kEpsilon = 1e-6;
-    std::mt19937 mGenerator{std::random_device{}()};
+    static constexpr double kEpsilon = 1e-6 * kToleranceScale;
 
     virtual std::optional<Object::Intersection> Intersect(const Ray& ray, const Scene& scene);
+    void Intersect(std::span<const Ray> rays, const Scene& scene, std::span<std::optional<Object::Intersection>> intersections);
+    virtual bool Occluded(const Ray& ray, const Scene& scene, double maxDistance);
 
     // Overload that takes the throughput before the material interaction
-    void CollectDirectLighting(Ray& ray, const Scene& scene, const Object::Intersection& intersection, const Color& throughputBefore, std::size_t numLightSamples = 0);
+    void CollectDirectLighting(Ray& ray, const Scene& scene, const Object::Intersection& intersection, const Color& throughputBefore, Sampler& sampler, std::size_t numLightSamples = 0);
 };
 
 }  // namespace Raytracer
@@ -7,7 +7,7 @@ RendererDeterministic::RendererDeterministic() :
     kAmbientFactor = 3e-2;
 }
 
-Color RendererDeterministic::TraceRay(Ray ray, const Scene& scene) {
+Color RendererDeterministic::TraceRay(Ray ray, const Scene& scene, Sampler& sampler) {
     while (ray.GetDepth() < kMaximumDepth) {
         auto intersection = Intersect(ray, scene);
         if (!intersection.has_value()) {
@@ -25,16 +25,16 @@ Color RendererDeterministic::TraceRay(Ray ray, const Scene& scene) {
         switch (mostLikelyInteraction) {
             case Material::InteractionType::DIFFUSE: {
                 Color throughputBefore = ray.GetThroughput();
-                material.Diffuse(ray, intersection.value());
-                CollectDirectLighting(ray, scene, intersection.value(), throughputBefore);
+                material.Diffuse(ray, intersection.value(), sampler);
+                CollectDirectLighting(ray, scene, intersection.value(), throughputBefore, sampler);
                 return ray.GetRadiance();
             }
             case Material::InteractionType::REFLECTIVE: {
-                material.Reflect(ray, intersection.value(), applyRoughness);
+                material.Reflect(ray, intersection.value(), sampler, applyRoughness);
                 break;
             }
             case Material::InteractionType::REFRACTIVE: {
-                material.Refract(ray, intersection.value(), applyRoughness);
+                material.Refract(ray, intersection.value(), sampler, applyRoughness);
                 break;
             }
         }
@@ -1,12 +1,16 @@
 #include "Rendering/RendererPathTracer.hpp"
 
+#include "Rendering/RenderStatistics.hpp"
+
+#include <algorithm>
+
 namespace Raytracer {
 
 RendererPathTracer::RendererPathTracer() :
     Renderer(Type::PATH_TRACER, false) {
 }
 
-Color RendererPathTracer::TraceRay(Ray ray, const Scene& scene) {
+Color RendererPathTracer::TraceRay(Ray ray, const Scene& scene, Sampler& sampler) {
     while (ray.GetDepth() < kMaximumDepth) {
         auto intersection = Intersect(ray, scene);
         if (!intersection.has_value()) {
@@ -21,14 +25,15 @@ Color RendererPathTracer::TraceRay(Ray ray, const Scene& scene) {
             break;
         }
 
-        material.Interact(ray, intersection.value());
+        material.Interact(ray, intersection.value(), sampler);
 
         // Russian roulette after a few bounces
         if (ray.GetDepth() >= 3) {
             Color throughput = ray.GetThroughput();
             double p = std::max({throughput.R(), throughput.G(), throughput.B()});
             p = std::clamp(p, 0.05, 0.95);
-            if (mDistribution(mGenerator) > p) {
+            if (sampler.Uniform() > p) {
+                RenderStatistics::CountRussianRouletteTermination();
                 break;
             }
             ray.UpdateThroughput(1.0 / p);
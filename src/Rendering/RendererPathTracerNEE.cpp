@@ -1,12 +1,16 @@
 #include "Rendering/RendererPathTracerNEE.hpp"
 
+#include "Rendering/RenderStatistics.hpp"
+
+#include <algorithm>
+
 namespace Raytracer {
 
 RendererPathTracerNEE::RendererPathTracerNEE() :
     Renderer(Type::PATH_TRACER_NEE, false) {
 }
 
-Color RendererPathTracerNEE::TraceRay(Ray ray, const Scene& scene) {
+Color RendererPathTracerNEE::TraceRay(Ray ray, const Scene& scene, Sampler& sampler) {
     bool hadDiffuseInteraction = false;
 
     while (ray.GetDepth() < kMaximumDepth) {
@@ -27,9 +31,9 @@ Color RendererPathTracerNEE::TraceRay(Ray ray, const Scene& scene) {
             break;
         }
 
-        auto interactionType = material.Interact(ray, intersection.value());
+        auto interactionType = material.Interact(ray, intersection.value(), sampler);
         if (interactionType == Material::InteractionType::DIFFUSE) {
-            CollectDirectLighting(ray, scene, intersection.value(), throughputBefore, kNumLightSamples);
+            CollectDirectLighting(ray, scene, intersection.value(), throughputBefore, sampler, kNumLightSamples);
             hadDiffuseInteraction = true;
         }
 
@@ -38,7 +42,8 @@ Color RendererPathTracerNEE::TraceRay(Ray ray, const Scene& scene) {
             Color throughput = ray.GetThroughput();
             double luminance = throughput.Luminance();
             double p = std::clamp(luminance, 0.1, 0.95);
-            if (mDistribution(mGenerator) > p) {
+            if (sampler.Uniform() > p) {
+                RenderStatistics::CountRussianRouletteTermination();
                 break;
             }
             ray.UpdateThroughput(1.0 / p);
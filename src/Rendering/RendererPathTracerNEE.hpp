@@ -2,18 +2,15 @@
 
 #include "Rendering/Renderer.hpp"
 
-#include <random>
-
 namespace Raytracer {
 
 class RendererPathTracerNEE : public Renderer {
 public:
     RendererPathTracerNEE();
 
-    virtual Color TraceRay(Ray ray, const Scene& scene) override;
+    virtual Color TraceRay(Ray ray, const Scene& scene, Sampler& sampler) override;
 
 private:
-    std::uniform_real_distribution<double> mDistribution{0.0, 1.0};
     static constexpr size_t kNumLightSamples = 2;
 };
 
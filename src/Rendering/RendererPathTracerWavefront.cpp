@@ -0,0 +1,138 @@
+#include "Rendering/RendererPathTracerWavefront.hpp"
+
+#include "Rendering/RenderStatistics.hpp"
+#include "Scene/ObjectPrimitive.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace Raytracer {
+
+namespace {
+// One renderer is shared by all threads, so every thread keeps its own queues. They are reused between batches and only grow.
+thread_local RendererPathTracerWavefront::PathStates sPathStates;
+}  // namespace
+
+void RendererPathTracerWavefront::PathStates::Reset(std::span<const Ray> primaryRays, std::size_t maximumDepth) {
+    const std::size_t numberOfPaths = primaryRays.size();
+    rays.assign(primaryRays.begin(), primaryRays.end());
+    intersections.resize(numberOfPaths);
+    materials.resize(numberOfPaths);
+    throughputsBefore.resize(numberOfPaths);
+    hadDiffuseInteraction.assign(numberOfPaths, 0);
+
+    active.clear();
+    for (std::uint32_t path = 0; path < numberOfPaths; path++) {
+        if (rays[path].GetDepth() < maximumDepth) {
+            active.push_back(path);
+        }
+    }
+    shadowQueue.clear();
+}
+
+RendererPathTracerWavefront::RendererPathTracerWavefront() :
+    Renderer(Type::PATH_TRACER_WAVEFRONT, false) {
+}
+
+Color RendererPathTracerWavefront::TraceRay(Ray ray, const Scene& scene, Sampler& sampler) {
+    Color color;
+    TraceRays(std::span<const Ray>(&ray, 1), scene, std::span<Sampler>(&sampler, 1), std::span<Color>(&color, 1));
+    return color;
+}
+
+void RendererPathTracerWavefront::TraceRays(std::span<const Ray> rays, const Scene& scene, std::span<Sampler> samplers, std::span<Color> colors) {
+    PathStates& paths = sPathStates;
+    paths.Reset(rays, kMaximumDepth);
+
+    for (bool primaryRays = true; !paths.active.empty(); primaryRays = false) {
+        ExtendPaths(paths, scene, primaryRays);
+        InteractWithMaterials(paths, scene, samplers);
+        TraceShadowRays(paths, scene, samplers);
+        TerminatePaths(paths, samplers);
+    }
+
+    for (std::size_t path = 0; path < rays.size(); path++) {
+        colors[path] = paths.rays[path].GetRadiance();
+    }
+}
+
+// Finds the closest hit of every live path
+void RendererPathTracerWavefront::ExtendPaths(PathStates& paths, const Scene& scene, bool primaryRays) {
+    if (primaryRays && paths.active.size() == paths.rays.size()) {
+        // The primary rays of neighbouring pixels are coherent and traced in packets
+        Intersect(std::span<const Ray>(paths.rays), scene, paths.intersections);
+    } else {
+        for (std::uint32_t path : paths.active) {
+            paths.intersections[path] = Intersect(paths.rays[path], scene);
+        }
+    }
+}
+
+// Terminates paths that escape or hit a light source, and scatters the others at their material
+void RendererPathTracerWavefront::InteractWithMaterials(PathStates& paths, const Scene& scene, std::span<Sampler> samplers) {
+    // Group the paths by material, escaped paths first
+    for (std::uint32_t path : paths.active) {
+        const auto& intersection = paths.intersections[path];
+        paths.materials[path] = intersection.has_value() ? &intersection->object->GetMaterial() : nullptr;
+    }
+    std::sort(paths.active.begin(), paths.active.end(), [&paths](std::uint32_t a, std::uint32_t b) {
+        return std::less<const Material*>()(paths.materials[a], paths.materials[b]);
+    });
+
+    std::size_t numberOfActivePaths = 0;
+    for (std::uint32_t path : paths.active) {
+        Ray& ray = paths.rays[path];
+        const auto& intersection = paths.intersections[path];
+        if (!intersection.has_value()) {
+            ray.AddRadiance(ray.GetThroughput() * scene.GetBackgroundColor(ray));
+            continue;
+        }
+
+        const Material& material = *paths.materials[path];
+        if (material.EmitsLight()) {
+            // Add emission only if we've never had a diffuse bounce (no NEE sampling yet)
+            if (!paths.hadDiffuseInteraction[path]) {
+                ray.AddRadiance(ray.GetThroughput() * material.GetEmission());
+            }
+            continue;
+        }
+
+        paths.throughputsBefore[path] = ray.GetThroughput();
+        if (material.Interact(ray, intersection.value(), samplers[path]) == Material::InteractionType::DIFFUSE) {
+            paths.shadowQueue.push_back(path);
+            paths.hadDiffuseInteraction[path] = 1;
+        }
+        paths.active[numberOfActivePaths++] = path;
+    }
+    paths.active.resize(numberOfActivePaths);
+}
+
+// Next event estimation for the paths with a diffuse interaction in this bounce
+void RendererPathTracerWavefront::TraceShadowRays(PathStates& paths, const Scene& scene, std::span<Sampler> samplers) {
+    for (std::uint32_t path : paths.shadowQueue) {
+        CollectDirectLighting(paths.rays[path], scene, paths.intersections[path].value(), paths.throughputsBefore[path], samplers[path], kNumLightSamples);
+    }
+    paths.shadowQueue.clear();
+}
+
+// Russian roulette after a few bounces, and the maximum depth
+void RendererPathTracerWavefront::TerminatePaths(PathStates& paths, std::span<Sampler> samplers) {
+    std::size_t numberOfActivePaths = 0;
+    for (std::uint32_t path : paths.active) {
+        Ray& ray = paths.rays[path];
+        if (ray.GetDepth() >= 3) {
+            double p = std::clamp<double>(ray.GetThroughput().Luminance(), 0.1, 0.95);
+            if (samplers[path].Uniform() > p) {
+                RenderStatistics::CountRussianRouletteTermination();
+                continue;
+            }
+            ray.UpdateThroughput(1.0 / p);
+        }
+        if (ray.GetDepth() < kMaximumDepth) {
+            paths.active[numberOfActivePaths++] = path;
+        }
+    }
+    paths.active.resize(numberOfActivePaths);
+}
+
+}  // namespace Raytracer
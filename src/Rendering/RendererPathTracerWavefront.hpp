@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Rendering/Renderer.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Raytracer {
+
+// Path tracer with next event estimation that advances a whole batch of paths one bounce at a time.
+// Instead of following one path from start to finish, every bounce runs in separate stages (extension rays, material interactions, shadow rays), each of which processes all live paths in bulk.
+// Paths are sorted by material before shading, so that neighbouring paths run the same material code.
+// Every path uses its own sampler in the same order as RendererPathTracerNEE, so both renderers produce the same images.
+class RendererPathTracerWavefront : public Renderer {
+public:
+    RendererPathTracerWavefront();
+
+    // A single ray is traced as a wavefront of one path
+    virtual Color TraceRay(Ray ray, const Scene& scene, Sampler& sampler) override;
+    virtual void TraceRays(std::span<const Ray> rays, const Scene& scene, std::span<Sampler> samplers, std::span<Color> colors) override;
+
+    // States of the paths of a wavefront, one entry per path and component
+    struct PathStates {
+        std::vector<Ray> rays;  // Current segment, which also carries the radiance, throughput, and depth of the path
+        std::vector<std::optional<Object::Intersection>> intersections;
+        std::vector<const Material*> materials;  // Material at the intersection, the sort key of the material stage
+        std::vector<Color> throughputsBefore;  // Throughput before the last material interaction
+        std::vector<std::uint8_t> hadDiffuseInteraction;
+
+        std::vector<std::uint32_t> active;       // Paths that are still being traced
+        std::vector<std::uint32_t> shadowQueue;  // Paths that need direct lighting after a diffuse interaction
+
+        void Reset(std::span<const Ray> primaryRays, std::size_t maximumDepth);
+    };
+
+private:
+    static constexpr size_t kNumLightSamples = 2;
+
+    // Stages of one bounce
+    void ExtendPaths(PathStates& paths, const Scene& scene, bool primaryRays);
+    void InteractWithMaterials(PathStates& paths, const Scene& scene, std::span<Sampler> samplers);
+    void TraceShadowRays(PathStates& paths, const Scene& scene, std::span<Sampler> samplers);
+    void TerminatePaths(PathStates& paths, std::span<Sampler> samplers);
+};
+
+}  // namespace Raytracer
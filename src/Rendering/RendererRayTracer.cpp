@@ -6,7 +6,7 @@ RendererRayTracer::RendererRayTracer() :
     Renderer(Type::RAY_TRACER, false) {
 }
 
-Color RendererRayTracer::TraceRay(Ray ray, const Scene& scene) {
+Color RendererRayTracer::TraceRay(Ray ray, const Scene& scene, Sampler& sampler) {
     while (ray.GetDepth() < kMaximumDepth) {
         auto intersection = Intersect(ray, scene);
         if (!intersection.has_value()) {
@@ -22,10 +22,10 @@ Color RendererRayTracer::TraceRay(Ray ray, const Scene& scene) {
         }
 
         Color throughputBefore = ray.GetThroughput();
-        auto interactionType = material.Interact(ray, intersection.value());
+        auto interactionType = material.Interact(ray, intersection.value(), sampler);
 
         if (interactionType == Material::InteractionType::DIFFUSE) {
-            CollectDirectLighting(ray, scene, intersection.value(), throughputBefore, kNumLightSamples);
+            CollectDirectLighting(ray, scene, intersection.value(), throughputBefore, sampler, kNumLightSamples);
             break;
         }
     }
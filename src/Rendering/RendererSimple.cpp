@@ -1,11 +1,14 @@
 #include "Rendering/RendererSimple.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace Raytracer {
 
 RendererSimple::RendererSimple() :
     Renderer(Type::SIMPLE, true) {};
 
-Color RendererSimple::TraceRay(Ray ray, const Scene& scene) {
+Color RendererSimple::TraceRay(Ray ray, const Scene& scene, Sampler& sampler) {
     auto intersection = Intersect(ray, scene);
     if (intersection) {
         return intersection->object->GetMaterial().GetColor(intersection.value());
@@ -14,4 +17,20 @@ Color RendererSimple::TraceRay(Ray ray, const Scene& scene) {
     }
 }
 
+void RendererSimple::TraceRays(std::span<const Ray> rays, const Scene& scene, std::span<Sampler> samplers, std::span<Color> colors) {
+    // Only primary rays, so all rays are traced in packets
+    std::array<std::optional<Object::Intersection>, Geometry::LinePacket::kMaximumSize> intersections;
+    for (std::size_t begin = 0; begin < rays.size(); begin += intersections.size()) {
+        const std::size_t count = std::min(intersections.size(), rays.size() - begin);
+        Intersect(rays.subspan(begin, count), scene, intersections);
+        for (std::size_t i = 0; i < count; i++) {
+            if (intersections[i]) {
+                colors[begin + i] = intersections[i]->object->GetMaterial().GetColor(intersections[i].value());
+            } else {
+                colors[begin + i] = scene.GetBackgroundColor(rays[begin + i]);
+            }
+        }
+    }
+}
+
 }  // namespace Raytracer
@@ -11,7 +11,8 @@ class RendererSimple : public Renderer {
 public:
     RendererSimple();
 
-    virtual Color TraceRay(Ray ray, const Scene& scene) override;
+    virtual Color TraceRay(Ray ray, const Scene& scene, Sampler& sampler) override;
+    virtual void TraceRays(std::span<const Ray> rays, const Scene& scene, std::span<Sampler> samplers, std::span<Color> colors) override;
 
 private:
 };
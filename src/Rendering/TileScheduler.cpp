@@ -0,0 +1,127 @@
+#include "Rendering/TileScheduler.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace Raytracer {
+
+TileScheduler::TileScheduler(std::size_t width, std::size_t height, std::size_t tileSize, std::size_t numWorkers, std::size_t shard, std::size_t numShards) :
+    mWidth(width),
+    mHeight(height),
+    mTileSize(std::max<std::size_t>(1, tileSize)),
+    mNumWorkers(std::max<std::size_t>(1, numWorkers)) {
+    mTilesX = (mWidth + mTileSize - 1) / mTileSize;
+    std::size_t tilesY = (mHeight + mTileSize - 1) / mTileSize;
+    mNumTiles = mTilesX * tilesY;
+    if (mNumTiles > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("TileScheduler: Too many tiles, increase the tile size.");
+    }
+    if (numShards == 0 || shard >= numShards) {
+        throw std::invalid_argument("TileScheduler: Invalid shard " + std::to_string(shard) + " of " + std::to_string(numShards) + ".");
+    }
+    mFirstTile = shard * mNumTiles / numShards;
+    mEndTile = (shard + 1) * mNumTiles / numShards;
+
+    // Every worker starts with a contiguous block of the tiles of the shard
+    const std::size_t shardTiles = mEndTile - mFirstTile;
+    mRanges = std::make_unique<WorkRange[]>(mNumWorkers);
+    for (std::size_t worker = 0; worker < mNumWorkers; worker++) {
+        auto begin = static_cast<std::uint32_t>(mFirstTile + worker * shardTiles / mNumWorkers);
+        auto end = static_cast<std::uint32_t>(mFirstTile + (worker + 1) * shardTiles / mNumWorkers);
+        mRanges[worker].range.store(Pack(begin, end), std::memory_order_relaxed);
+    }
+}
+
+std::size_t TileScheduler::NumberOfTiles() const {
+    return mNumTiles;
+}
+
+std::size_t TileScheduler::NumberOfWorkers() const {
+    return mNumWorkers;
+}
+
+std::size_t TileScheduler::FirstTile() const {
+    return mFirstTile;
+}
+
+std::size_t TileScheduler::EndTile() const {
+    return mEndTile;
+}
+
+TileScheduler::Tile TileScheduler::GetTile(std::size_t index) const {
+    std::size_t xBegin = (index % mTilesX) * mTileSize;
+    std::size_t yBegin = (index / mTilesX) * mTileSize;
+    return {xBegin, yBegin, std::min(xBegin + mTileSize, mWidth), std::min(yBegin + mTileSize, mHeight), index};
+}
+
+std::optional<TileScheduler::Tile> TileScheduler::Next(std::size_t worker) {
+    if (worker >= mNumWorkers) {
+        throw std::out_of_range("TileScheduler::Next: Invalid worker index " + std::to_string(worker));
+    }
+    std::size_t index;
+    if (PopFront(worker, index) || Steal(worker, index)) {
+        return GetTile(index);
+    }
+    return std::nullopt;
+}
+
+std::uint64_t TileScheduler::Pack(std::uint32_t begin, std::uint32_t end) {
+    return (static_cast<std::uint64_t>(begin) << 32) | end;
+}
+
+std::uint32_t TileScheduler::Begin(std::uint64_t range) {
+    return static_cast<std::uint32_t>(range >> 32);
+}
+
+std::uint32_t TileScheduler::End(std::uint64_t range) {
+    return static_cast<std::uint32_t>(range);
+}
+
+bool TileScheduler::PopFront(std::size_t worker, std::size_t& index) {
+    std::uint64_t range = mRanges[worker].range.load(std::memory_order_acquire);
+    while (Begin(range) < End(range)) {
+        if (mRanges[worker].range.compare_exchange_weak(range, Pack(Begin(range) + 1, End(range)), std::memory_order_acq_rel)) {
+            index = Begin(range);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TileScheduler::Steal(std::size_t thief, std::size_t& index) {
+    while (true) {
+        // Pick the worker with the most remaining tiles
+        std::size_t victim = mNumWorkers;
+        std::uint64_t victimRange = 0;
+        std::uint32_t maximumRemaining = 0;
+        for (std::size_t worker = 0; worker < mNumWorkers; worker++) {
+            if (worker == thief) {
+                continue;
+            }
+            std::uint64_t range = mRanges[worker].range.load(std::memory_order_acquire);
+            if (Begin(range) < End(range) && End(range) - Begin(range) > maximumRemaining) {
+                victim = worker;
+                victimRange = range;
+                maximumRemaining = End(range) - Begin(range);
+            }
+        }
+        if (victim == mNumWorkers) {
+            return false;
+        }
+
+        // Take the back half, the victim keeps working on the front half
+        const std::uint32_t begin = Begin(victimRange);
+        const std::uint32_t end = End(victimRange);
+        const std::uint32_t middle = end - (end - begin + 1) / 2;
+        if (mRanges[victim].range.compare_exchange_strong(victimRange, Pack(begin, middle), std::memory_order_acq_rel)) {
+            // The thief's own range is empty, so nobody else modifies it concurrently
+            mRanges[thief].range.store(Pack(middle + 1, end), std::memory_order_release);
+            index = middle;
+            return true;
+        }
+    }
+}
+
+}  // namespace Raytracer
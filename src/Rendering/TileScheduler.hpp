@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace Raytracer {
+
+// Distributes the square tiles of an image over a fixed number of workers.
+// Every worker starts with a contiguous range of tiles. Once its own range is exhausted, it steals half of the largest remaining range of another worker.
+// All operations are lock-free, each range is a single atomic word that is only modified with compare-and-swap.
+// With several shards, e.g. processes on different machines, the workers only get the contiguous range of tiles of their shard.
+class TileScheduler {
+public:
+    struct Tile {
+        std::size_t xBegin;
+        std::size_t yBegin;
+        std::size_t xEnd;
+        std::size_t yEnd;
+        std::size_t index;  // Row-major position among all tiles
+
+        std::size_t NumberOfPixels() const {
+            return (xEnd - xBegin) * (yEnd - yBegin);
+        }
+    };
+
+    TileScheduler(std::size_t width, std::size_t height, std::size_t tileSize, std::size_t numWorkers, std::size_t shard = 0, std::size_t numShards = 1);
+
+    std::size_t NumberOfTiles() const;
+    std::size_t NumberOfWorkers() const;
+
+    // Range [FirstTile(), EndTile()) of the tiles of the shard, which the workers hand out
+    std::size_t FirstTile() const;
+    std::size_t EndTile() const;
+
+    Tile GetTile(std::size_t index) const;
+
+    // Next tile for the given worker, or nothing if all tiles have been handed out
+    std::optional<Tile> Next(std::size_t worker);
+
+private:
+    std::size_t mWidth;
+    std::size_t mHeight;
+    std::size_t mTileSize;
+    std::size_t mTilesX;
+    std::size_t mNumTiles;
+    std::size_t mNumWorkers;
+    std::size_t mFirstTile;
+    std::size_t mEndTile;
+
+    // Half-open range [begin, end) of tile indices, packed into one word. Padded to avoid false sharing between workers.
+    struct alignas(64) WorkRange {
+        std::atomic<std::uint64_t> range{0};
+    };
+    std::unique_ptr<WorkRange[]> mRanges;
+
+    static std::uint64_t Pack(std::uint32_t begin, std::uint32_t end);
+    static std::uint32_t Begin(std::uint64_t range);
+    static std::uint32_t End(std::uint64_t range);
+
+    bool PopFront(std::size_t worker, std::size_t& index);
+    bool Steal(std::size_t thief, std::size_t& index);
+};
+
+}  // namespace Raytracer
@@ -1,9 +1,19 @@
 #include "Scene/Object.hpp"
 
+#include "Scene/ObjectPrimitive.hpp"
+
 namespace Raytracer {
 
 Object::Object(Type type, const std::string& name) : mType(type), mName(name) {}
 
+std::optional<Object::Intersection> Object::Intersect(const Ray& ray) const {
+    auto hit = FindHit(ray);
+    if (!hit) {
+        return std::nullopt;
+    }
+    return hit->object->ComputeSurfaceInteraction(ray, *hit);
+}
+
 std::string Object::GetName() const {
     return mName;
 }
@@ -1,11 +1,15 @@
 #pragma once
 
+#include "Geometry/BoundingBox.hpp"
 #include "Geometry/Intersection.hpp"
+#include "Geometry/LinePacket.hpp"
 #include "Rendering/Ray.hpp"
 
 #include <memory>
+#include <array>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace Raytracer {
 
@@ -18,13 +22,45 @@ public:
         COMPOSITE
     };
 
+    // Hit record of the hot path: the primitive is referenced without ownership, so that intersection tests do not touch its reference count.
+    // The scene keeps the primitive alive for as long as the intersection is used.
     struct Intersection : public Geometry::Intersection {
-        std::shared_ptr<ObjectPrimitive> object;
+        const ObjectPrimitive* object = nullptr;
+    };
+
+    // Closest hit without surface data, which is completed to an Intersection only for the closest hit of the whole scene
+    struct Hit : public Geometry::Hit {
+        const ObjectPrimitive* object = nullptr;
+    };
+
+    // Closest hits of a packet of rays, together with the primitive that was hit in each lane
+    struct PacketHits : public Geometry::PacketHits {
+        std::array<const ObjectPrimitive*, Geometry::LinePacket::kMaximumSize> object;
+
+        Hit GetHit(std::size_t lane) const {
+            Hit hit;
+            static_cast<Geometry::Hit&>(hit) = Geometry::PacketHits::GetHit(lane);
+            hit.object = object[lane];
+            return hit;
+        }
+
+        void CopyLane(std::size_t lane, const PacketHits& other) {
+            Geometry::PacketHits::CopyLane(lane, other);
+            object[lane] = other.object[lane];
+        }
     };
 
     Object(Type type, const std::string& name);
 
-    virtual std::optional<Intersection> Intersect(const Ray& ray) const = 0;
+    virtual std::optional<Hit> FindHit(const Ray& ray) const = 0;
+
+    // FindHit() for a packet of rays
+    virtual void FindHits(const Geometry::LinePacket& packet, PacketHits& hits) const = 0;
+
+    std::optional<Intersection> Intersect(const Ray& ray) const;
+
+    // Any-hit query for shadow rays: true if the ray hits the object for some minDistance < t < maxDistance
+    virtual bool Occluded(const Ray& ray, double minDistance, double maxDistance) const = 0;
 
     std::string GetName() const;
 
@@ -33,10 +69,17 @@ public:
 
     virtual std::vector<std::shared_ptr<ObjectPrimitive>> GetLightSources() const = 0;
 
+    // All primitives the object consists of, e.g. for building acceleration structures
+    virtual std::vector<std::shared_ptr<ObjectPrimitive>> GetPrimitives() const = 0;
+    virtual Geometry::BoundingBox GetBoundingBox() const = 0;
+
     // Dynamic
     virtual bool IsDynamic() const;
     virtual void Evolve(double timeDelta) = 0;
 
+    // Independent copy with its own shapes, which can evolve without affecting the original
+    virtual std::shared_ptr<Object> Clone() const = 0;
+
     void SetVelocity(const Vector3D& velocity);
     void SetAcceleration(const Vector3D& acceleration);
     void SetAngularVelocity(const Vector3D& angularVelocity);
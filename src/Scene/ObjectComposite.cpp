@@ -20,15 +20,37 @@ void ObjectComposite::AddComponent(const std::shared_ptr<ObjectPrimitive>& compo
     }
 }
 
-std::optional<Object::Intersection> ObjectComposite::Intersect(const Ray& ray) const {
-    std::optional<Object::Intersection> closestIntersection;
+std::optional<Object::Hit> ObjectComposite::FindHit(const Ray& ray) const {
+    std::optional<Object::Hit> closestHit;
     for (const auto& component : mComponents) {
-        auto intersection = component->Intersect(ray);
-        if (intersection.has_value() && (!closestIntersection.has_value() || intersection->t < closestIntersection->t)) {
-            closestIntersection = intersection;
+        auto hit = component->FindHit(ray);
+        if (hit.has_value() && (!closestHit.has_value() || hit->t < closestHit->t)) {
+            closestHit = hit;
         }
     }
-    return closestIntersection;
+    return closestHit;
+}
+
+void ObjectComposite::FindHits(const Geometry::LinePacket& packet, PacketHits& hits) const {
+    hits.Clear();
+    PacketHits componentHits;
+    for (const auto& component : mComponents) {
+        component->FindHits(packet, componentHits);
+        for (std::size_t lane = 0; lane < packet.size; lane++) {
+            if (componentHits.t[lane] < hits.t[lane]) {
+                hits.CopyLane(lane, componentHits);
+            }
+        }
+    }
+}
+
+bool ObjectComposite::Occluded(const Ray& ray, double minDistance, double maxDistance) const {
+    for (const auto& component : mComponents) {
+        if (component->Occluded(ray, minDistance, maxDistance)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void ObjectComposite::SetVisible(bool visible) {
@@ -50,6 +72,18 @@ std::vector<std::shared_ptr<ObjectPrimitive>> ObjectComposite::GetLightSources()
     return mLightSources;
 }
 
+std::vector<std::shared_ptr<ObjectPrimitive>> ObjectComposite::GetPrimitives() const {
+    return mComponents;
+}
+
+Geometry::BoundingBox ObjectComposite::GetBoundingBox() const {
+    Geometry::BoundingBox box;
+    for (const auto& component : mComponents) {
+        box.Expand(component->GetBoundingBox());
+    }
+    return box;
+}
+
 bool ObjectComposite::IsDynamic() const {
     bool entireObjectIsDynamic = (mVelocity.Norm() > 0.0 || mAcceleration.Norm() > 0.0 ||
                                   mAngularVelocity.Norm() > 0.0 || mSpin.Norm() > 0.0);
@@ -87,6 +121,16 @@ void ObjectComposite::Evolve(double timeDelta) {
     }
 }
 
+std::shared_ptr<Object> ObjectComposite::Clone() const {
+    auto clone = std::make_shared<ObjectComposite>(*this);
+    clone->mComponents.clear();
+    clone->mLightSources.clear();
+    for (const auto& component : mComponents) {
+        clone->AddComponent(std::static_pointer_cast<ObjectPrimitive>(component->Clone()));
+    }
+    return clone;
+}
+
 void ObjectComposite::PrintInfo() const {
     PrintInfoBase();
     std::cout << "\tNumber of Components:\t" << mComponents.size() << std::endl;
@@ -15,15 +15,21 @@ public:
     std::size_t NumberOfComponents() const;
     void AddComponent(const std::shared_ptr<ObjectPrimitive>& component);
 
-    virtual std::optional<Intersection> Intersect(const Ray& ray) const override;
+    virtual std::optional<Hit> FindHit(const Ray& ray) const override;
+    virtual void FindHits(const Geometry::LinePacket& packet, PacketHits& hits) const override;
+    virtual bool Occluded(const Ray& ray, double minDistance, double maxDistance) const override;
 
     virtual void SetVisible(bool visible) override;
     virtual bool IsVisible() const override;
 
     virtual std::vector<std::shared_ptr<ObjectPrimitive>> GetLightSources() const override;
 
+    virtual std::vector<std::shared_ptr<ObjectPrimitive>> GetPrimitives() const override;
+    virtual Geometry::BoundingBox GetBoundingBox() const override;
+
     virtual bool IsDynamic() const override;
     virtual void Evolve(double timeDelta) override;
+    virtual std::shared_ptr<Object> Clone() const override;
 
     virtual void PrintInfo() const override;
 
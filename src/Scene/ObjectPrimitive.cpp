@@ -1,5 +1,7 @@
 #include "Scene/ObjectPrimitive.hpp"
 
+#include "Rendering/RenderStatistics.hpp"
+
 namespace Raytracer {
 
 ObjectPrimitive::ObjectPrimitive(const ::std::string& name, const Material& material, std::shared_ptr<Geometry::Shape> shape) :
@@ -7,24 +9,48 @@ ObjectPrimitive::ObjectPrimitive(const ::std::string& name, const Material& mate
     mMaterial(material),
     mShape(std::move(shape)) {}
 
-std::optional<Object::Intersection> ObjectPrimitive::Intersect(const Ray& ray) const {
+std::optional<Object::Hit> ObjectPrimitive::FindHit(const Ray& ray) const {
     if (!mShape) {
         return std::nullopt;
     }
 
-    auto geometryIntersection = mShape->Intersect(ray);
-    if (geometryIntersection.has_value()) {
-        Intersection intersection;
-        intersection.t = geometryIntersection->t;
-        intersection.point = geometryIntersection->point;
-        intersection.normal = geometryIntersection->normal;
-        intersection.object = std::const_pointer_cast<ObjectPrimitive>(shared_from_this());
-        return intersection;
+    RenderStatistics::CountIntersectionTests(mShape->GetType());
+    auto geometryHit = mShape->FindHit(ray);
+    if (geometryHit.has_value()) {
+        Hit hit;
+        static_cast<Geometry::Hit&>(hit) = *geometryHit;
+        hit.object = this;
+        return hit;
     }
 
     return std::nullopt;
 }
 
+void ObjectPrimitive::FindHits(const Geometry::LinePacket& packet, PacketHits& hits) const {
+    if (mShape) {
+        RenderStatistics::CountIntersectionTests(mShape->GetType(), packet.size);
+        mShape->FindHits(packet, hits);
+    } else {
+        hits.Clear();
+    }
+    hits.object.fill(this);
+}
+
+Object::Intersection ObjectPrimitive::ComputeSurfaceInteraction(const Ray& ray, const Hit& hit) const {
+    Intersection intersection;
+    static_cast<Geometry::Intersection&>(intersection) = mShape->ComputeSurfaceInteraction(ray, hit);
+    intersection.object = this;
+    return intersection;
+}
+
+bool ObjectPrimitive::Occluded(const Ray& ray, double minDistance, double maxDistance) const {
+    if (!mShape) {
+        return false;
+    }
+    RenderStatistics::CountIntersectionTests(mShape->GetType());
+    return mShape->Occluded(ray, minDistance, maxDistance);
+}
+
 void ObjectPrimitive::SetVisible(bool visible) {
     mVisible = visible;
 }
@@ -40,10 +66,22 @@ std::vector<std::shared_ptr<ObjectPrimitive>> ObjectPrimitive::GetLightSources()
     }
 }
 
+std::vector<std::shared_ptr<ObjectPrimitive>> ObjectPrimitive::GetPrimitives() const {
+    return {std::const_pointer_cast<ObjectPrimitive>(shared_from_this())};
+}
+
+Geometry::BoundingBox ObjectPrimitive::GetBoundingBox() const {
+    return mShape ? mShape->GetBoundingBox() : Geometry::BoundingBox();
+}
+
 Material& ObjectPrimitive::GetMaterial() {
     return mMaterial;
 }
 
+const Material& ObjectPrimitive::GetMaterial() const {
+    return mMaterial;
+}
+
 bool ObjectPrimitive::EmitsLight() const {
     return mMaterial.EmitsLight();
 }
@@ -52,7 +90,7 @@ Color ObjectPrimitive::GetColor(const Intersection& intersection) const {
     return mMaterial.GetColor(intersection);
 }
 
-std::shared_ptr<Geometry::Shape> ObjectPrimitive::GetShape() const {
+const std::shared_ptr<Geometry::Shape>& ObjectPrimitive::GetShape() const {
     return mShape;
 }
 
@@ -84,6 +122,14 @@ void ObjectPrimitive::Evolve(double timeDelta) {
     }
 }
 
+std::shared_ptr<Object> ObjectPrimitive::Clone() const {
+    auto clone = std::make_shared<ObjectPrimitive>(*this);
+    if (mShape) {
+        clone->mShape = mShape->Clone();
+    }
+    return clone;
+}
+
 void ObjectPrimitive::PrintInfo() const {
     PrintInfoBase();
 }
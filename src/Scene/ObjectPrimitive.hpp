@@ -13,21 +13,29 @@ class ObjectPrimitive : public Object, public std::enable_shared_from_this<Objec
 public:
     ObjectPrimitive(const ::std::string& name, const Material& material, std::shared_ptr<Geometry::Shape> shape);
 
-    virtual std::optional<Intersection> Intersect(const Ray& ray) const override;
+    virtual std::optional<Hit> FindHit(const Ray& ray) const override;
+    virtual void FindHits(const Geometry::LinePacket& packet, PacketHits& hits) const override;
+    Intersection ComputeSurfaceInteraction(const Ray& ray, const Hit& hit) const;
+    virtual bool Occluded(const Ray& ray, double minDistance, double maxDistance) const override;
 
     virtual void SetVisible(bool visible) override;
     virtual bool IsVisible() const override;
 
     virtual std::vector<std::shared_ptr<ObjectPrimitive>> GetLightSources() const override;
 
+    virtual std::vector<std::shared_ptr<ObjectPrimitive>> GetPrimitives() const override;
+    virtual Geometry::BoundingBox GetBoundingBox() const override;
+
     Material& GetMaterial();
+    const Material& GetMaterial() const;
     bool EmitsLight() const;
     Color GetColor(const Intersection& intersection) const;
 
-    std::shared_ptr<Geometry::Shape> GetShape() const;
+    const std::shared_ptr<Geometry::Shape>& GetShape() const;
     Vector3D GetNormal(const Intersection& intersection) const;
 
     virtual void Evolve(double timeDelta) override;
+    virtual std::shared_ptr<Object> Clone() const override;
 
     virtual void PrintInfo() const override;
 
@@ -40,9 +40,9 @@ ObjectComposite CreateGlobus(double referenceLength, const Vector3D& position, c
     double torusMinorRadius = 0.02 * referenceLength;
     double distanceToGlobe = 0.1 * referenceLength;
     double torusMajorRadius = referenceLength + distanceToGlobe + torusMinorRadius;
-    Vector3D center = position + onb.ToGlobal(Vector3D({0, 0, bottomDiskHeight + standCylinderHeight + 2.0 * torusMinorRadius + distanceToGlobe + referenceLength}));
+    Vector3D center = position + onb.ToGlobal(Vector3D({0, 0, static_cast<Real>(bottomDiskHeight + standCylinderHeight + 2.0 * torusMinorRadius + distanceToGlobe + referenceLength)}));
     Vector3D halfTorusOrientation = onb.ToGlobal({1.0, 0.0, 0.0});
-    Vector3D halfTorusReferenceDirection = onb.ToGlobal({0.0, -std::sin(globeTilt), std::cos(globeTilt)});
+    Vector3D halfTorusReferenceDirection = onb.ToGlobal({0.0, static_cast<Real>(-std::sin(globeTilt)), static_cast<Real>(std::cos(globeTilt))});
     auto halfTorusWithCaps = MakePrimitiveObject<Geometry::HalfTorusWithSphericalCaps>("globeHalfTorusWithCaps", copper, center, halfTorusOrientation, halfTorusReferenceDirection, torusMajorRadius, torusMinorRadius);
     globus.AddComponent(std::make_shared<ObjectPrimitive>(halfTorusWithCaps));
 
@@ -50,7 +50,7 @@ ObjectComposite CreateGlobus(double referenceLength, const Vector3D& position, c
     double tubeRadius = 0.01 * referenceLength;
     double tubeLength = 2.05 * torusMajorRadius;
     Vector3D tubePosition = center;
-    Vector3D tubeOrientation = onb.ToGlobal({0.0, -std::sin(globeTilt), std::cos(globeTilt)});
+    Vector3D tubeOrientation = onb.ToGlobal({0.0, static_cast<Real>(-std::sin(globeTilt)), static_cast<Real>(std::cos(globeTilt))});
     auto tube = MakePrimitiveObject<Geometry::Tube>("globeTube", silver, tubePosition, tubeOrientation, tubeRadius, tubeLength);
     globus.AddComponent(std::make_shared<ObjectPrimitive>(tube));
 
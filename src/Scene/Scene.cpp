@@ -4,6 +4,9 @@
 #include "Geometry/Shapes/Sphere.hpp"
 #include "Version.hpp"
 
+#include <array>
+#include <stdexcept>
+
 namespace Raytracer {
 
 Scene::Scene(const Color& backgroundColor) :
@@ -18,6 +21,7 @@ void Scene::AddObject(std::shared_ptr<Object> object) {
     if (object->IsDynamic()) {
         mDynamicObjects.push_back(object);
     }
+    mAccelerationStructureIsValid = false;
 }
 
 const std::vector<std::shared_ptr<Object>>& Scene::GetObjects() const {
@@ -28,6 +32,81 @@ const std::vector<std::shared_ptr<ObjectPrimitive>>& Scene::GetLightSources() co
     return mLightSources;
 }
 
+std::optional<Object::Intersection> Scene::Intersect(const Ray& ray, double minDistance) const {
+    if (mAccelerator == Accelerator::BVH && mAccelerationStructureIsValid) {
+        return IntersectBVH(ray, minDistance);
+    }
+    return IntersectLinear(ray, minDistance);
+}
+
+void Scene::Intersect(std::span<const Ray> rays, std::span<std::optional<Object::Intersection>> intersections, double minDistance) const {
+    if (intersections.size() < rays.size()) {
+        throw std::invalid_argument("Output span is smaller than the number of rays.");
+    }
+
+    const bool useBVH = (mAccelerator == Accelerator::BVH && mAccelerationStructureIsValid);
+    for (std::size_t begin = 0; begin < rays.size(); begin += Geometry::LinePacket::kMaximumSize) {
+        Geometry::LinePacket packet;
+        for (std::size_t i = begin; i < rays.size() && !packet.IsFull(); i++) {
+            packet.Add(rays[i]);
+        }
+
+        Object::PacketHits hits;
+        if (useBVH) {
+            FindHitsBVH(packet, minDistance, hits);
+        } else {
+            FindHitsLinear(packet, minDistance, hits);
+        }
+
+        // Only the closest hits are completed, as in the scalar Intersect()
+        for (std::size_t lane = 0; lane < packet.size; lane++) {
+            if (hits.HasHit(lane)) {
+                intersections[begin + lane] = hits.object[lane]->ComputeSurfaceInteraction(rays[begin + lane], hits.GetHit(lane));
+            } else {
+                intersections[begin + lane] = std::nullopt;
+            }
+        }
+    }
+}
+
+bool Scene::Occluded(const Ray& ray, double maxDistance, double minDistance) const {
+    if (mAccelerator == Accelerator::BVH && mAccelerationStructureIsValid) {
+        return OccludedBVH(ray, minDistance, maxDistance);
+    }
+    return OccludedLinear(ray, minDistance, maxDistance);
+}
+
+Scene::Accelerator Scene::GetAccelerator() const {
+    return mAccelerator;
+}
+
+void Scene::SetAccelerator(Accelerator accelerator) {
+    mAccelerator = accelerator;
+    mAccelerationStructureIsValid = false;
+}
+
+void Scene::BuildAccelerationStructure() {
+    mPrimitives.clear();
+    mBVH = Geometry::BVH();
+    mAccelerationStructureIsValid = false;
+    if (mAccelerator != Accelerator::BVH) {
+        return;
+    }
+
+    std::vector<Geometry::BoundingBox> primitiveBounds;
+    for (const auto& object : mObjects) {
+        if (!object || !object->IsVisible()) {
+            continue;
+        }
+        for (auto& primitive : object->GetPrimitives()) {
+            primitiveBounds.push_back(primitive->GetBoundingBox());
+            mPrimitives.push_back(std::move(primitive));
+        }
+    }
+    mBVH = Geometry::BVH(primitiveBounds);
+    mAccelerationStructureIsValid = true;
+}
+
 Color Scene::GetBackgroundColor(const Ray& ray) const {
     if (mBackgroundTexture) {
         Vector3D direction = ray.GetDirection().Normalized();
@@ -50,11 +129,17 @@ bool Scene::IsDynamic() const {
     return !mDynamicObjects.empty();
 }
 
-void Scene::Evolve(double timeStep) {
-    for (auto& object : mDynamicObjects) {
-        object->Evolve(timeStep);
+void Scene::Evolve(double timeStep, std::size_t numberOfSteps) {
+    for (std::size_t step = 0; step < numberOfSteps; step++) {
+        for (auto& object : mDynamicObjects) {
+            object->Evolve(timeStep);
+        }
+        mTime += timeStep;
+    }
+
+    if (IsDynamic() || !mAccelerationStructureIsValid) {
+        BuildAccelerationStructure();
     }
-    mTime += timeStep;
 }
 
 double Scene::GetTime() const {
@@ -67,6 +152,34 @@ void Scene::SetTime(double time) {
     mTime = time;
 }
 
+Scene Scene::Snapshot(double time) const {
+    if (!IsDynamic()) {
+        Scene snapshot = *this;
+        snapshot.mTime = time;
+        return snapshot;
+    }
+    Scene snapshot = CloneDynamicObjects();
+    snapshot.SetTime(time);
+    return snapshot;
+}
+
+Scene Scene::Snapshot(std::size_t numberOfSteps, double timeStep) const {
+    Scene snapshot = IsDynamic() ? CloneDynamicObjects() : *this;
+    snapshot.Evolve(timeStep, numberOfSteps);
+    return snapshot;
+}
+
+Scene Scene::CloneDynamicObjects() const {
+    Scene copy(mBackgroundColor);
+    copy.mBackgroundTexture = mBackgroundTexture;
+    copy.mAccelerator = mAccelerator;
+    copy.mTime = mTime;
+    for (const auto& object : mObjects) {
+        copy.AddObject(object->IsDynamic() ? object->Clone() : object);
+    }
+    return copy;
+}
+
 size_t Scene::NumberOfObjects() const {
     return mObjects.size();
 }
@@ -80,12 +193,123 @@ void Scene::PrintInfo() const {
               << "-------------------" << std::endl
               << "Background Color:\t" << mBackgroundColor << std::endl
               << "Objects in Scene:\t" << NumberOfObjects() << std::endl
-              << "Light Sources in Scene:\t" << NumberOfLightSources() << std::endl;
+              << "Light Sources in Scene:\t" << NumberOfLightSources() << std::endl
+              << "Accelerator:\t\t" << AcceleratorToString(mAccelerator) << std::endl;
     if (IsDynamic()) {
         std::cout << "Time:\t\t\t" << mTime << std::endl;
         std::cout << "Dynamic Objects in Scene:\t" << mDynamicObjects.size() << std::endl;
     }
     std::cout << std::endl;
+    if (mAccelerationStructureIsValid) {
+        mBVH.PrintInfo();
+    }
+}
+
+std::optional<Object::Intersection> Scene::IntersectLinear(const Ray& ray, double minDistance) const {
+    std::optional<Object::Hit> closestHit;
+    for (const auto& object : mObjects) {
+        if (!object || !object->IsVisible()) {
+            continue;
+        }
+
+        if (auto hit = object->FindHit(ray)) {
+            if (hit->t > minDistance && (!closestHit || hit->t < closestHit->t)) {
+                closestHit.emplace(*hit);
+            }
+        }
+    }
+    if (!closestHit) {
+        return std::nullopt;
+    }
+    return closestHit->object->ComputeSurfaceInteraction(ray, *closestHit);
+}
+
+std::optional<Object::Intersection> Scene::IntersectBVH(const Ray& ray, double minDistance) const {
+    std::optional<Object::Hit> closestHit;
+    std::size_t closestIndex = mPrimitives.size();
+    double tMax = std::numeric_limits<double>::infinity();
+    mBVH.Traverse(ray, minDistance, tMax, [&](std::size_t index) {
+        if (auto hit = mPrimitives[index]->FindHit(ray)) {
+            // Ties are resolved by scene order, as in the linear scan
+            if (hit->t > minDistance && (hit->t < tMax || (hit->t == tMax && index < closestIndex))) {
+                tMax = hit->t;
+                closestIndex = index;
+                closestHit.emplace(*hit);
+            }
+        }
+        return false;
+    });
+    if (!closestHit) {
+        return std::nullopt;
+    }
+    return closestHit->object->ComputeSurfaceInteraction(ray, *closestHit);
+}
+
+void Scene::FindHitsLinear(const Geometry::LinePacket& packet, double minDistance, Object::PacketHits& hits) const {
+    hits.Clear();
+    Object::PacketHits objectHits;
+    for (const auto& object : mObjects) {
+        if (!object || !object->IsVisible()) {
+            continue;
+        }
+
+        object->FindHits(packet, objectHits);
+        for (std::size_t lane = 0; lane < packet.size; lane++) {
+            if (objectHits.t[lane] > minDistance && objectHits.t[lane] < hits.t[lane]) {
+                hits.CopyLane(lane, objectHits);
+            }
+        }
+    }
+}
+
+void Scene::FindHitsBVH(const Geometry::LinePacket& packet, double minDistance, Object::PacketHits& hits) const {
+    hits.Clear();
+    std::array<std::size_t, Geometry::LinePacket::kMaximumSize> closestIndex;
+    closestIndex.fill(mPrimitives.size());
+
+    // The closest hits so far bound the traversal of each lane
+    Object::PacketHits primitiveHits;
+    mBVH.TraversePacket(packet, minDistance, hits.t, [&](std::size_t index) {
+        mPrimitives[index]->FindHits(packet, primitiveHits);
+        for (std::size_t lane = 0; lane < packet.size; lane++) {
+            const double t = primitiveHits.t[lane];
+            // Ties are resolved by scene order, as in the linear scan
+            if (t > minDistance && (t < hits.t[lane] || (t == hits.t[lane] && t != std::numeric_limits<double>::infinity() && index < closestIndex[lane]))) {
+                hits.CopyLane(lane, primitiveHits);
+                closestIndex[lane] = index;
+            }
+        }
+        return false;
+    });
+}
+
+bool Scene::OccludedLinear(const Ray& ray, double minDistance, double maxDistance) const {
+    for (const auto& object : mObjects) {
+        if (object && object->IsVisible() && object->Occluded(ray, minDistance, maxDistance)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Scene::OccludedBVH(const Ray& ray, double minDistance, double maxDistance) const {
+    bool occluded = false;
+    double tMax = maxDistance;
+    mBVH.Traverse(ray, minDistance, tMax, [&](std::size_t index) {
+        occluded = mPrimitives[index]->Occluded(ray, minDistance, maxDistance);
+        return occluded;
+    });
+    return occluded;
+}
+
+std::string Scene::AcceleratorToString(Accelerator accelerator) {
+    switch (accelerator) {
+        case Accelerator::LINEAR:
+            return "Linear";
+        case Accelerator::BVH:
+            return "BVH";
+    }
+    throw std::invalid_argument("Unknown accelerator");
 }
 
 }  // namespace Raytracer
@@ -1,17 +1,26 @@
 #pragma once
 
+#include "Geometry/BVH.hpp"
 #include "Rendering/Ray.hpp"
 #include "Scene/Object.hpp"
 #include "Scene/ObjectPrimitive.hpp"
 #include "Utilities/Texture.hpp"
 
 #include <memory>
+#include <optional>
+#include <span>
+#include <string>
 #include <vector>
 
 namespace Raytracer {
 
 class Scene {
 public:
+    enum class Accelerator {
+        LINEAR,  // Test every object
+        BVH,     // Bounding volume hierarchy over all visible primitives
+    };
+
     Scene(const Color& backgroundColor = BLACK);
 
     void AddObject(std::shared_ptr<Object> object);
@@ -19,15 +28,40 @@ public:
     const std::vector<std::shared_ptr<Object>>& GetObjects() const;
     const std::vector<std::shared_ptr<ObjectPrimitive>>& GetLightSources() const;
 
+    // Closest intersection with a visible object with t > minDistance
+    std::optional<Object::Intersection> Intersect(const Ray& ray, double minDistance = 0.0) const;
+
+    // Intersect() for a batch of rays, e.g. the coherent primary rays of neighbouring pixels, which are traced together in packets.
+    // The results are the same as for tracing the rays one by one.
+    void Intersect(std::span<const Ray> rays, std::span<std::optional<Object::Intersection>> intersections, double minDistance = 0.0) const;
+
+    // True if any visible object blocks the ray segment minDistance < t < maxDistance (stops at the first blocker)
+    bool Occluded(const Ray& ray, double maxDistance, double minDistance = 0.0) const;
+
+    Accelerator GetAccelerator() const;
+    void SetAccelerator(Accelerator accelerator);
+
+    // Needs to be called after adding or moving objects, otherwise Intersect() falls back to the linear scan.
+    // Evolve() and SetTime() rebuild the acceleration structure automatically.
+    void BuildAccelerationStructure();
+
     Color GetBackgroundColor(const Ray& ray) const;
     void SetColorTexture(std::string filename);
 
     bool IsDynamic() const;
-    void Evolve(double timeStep);
+    // Evolves the dynamic objects in the given number of equal steps, e.g. one per video frame, and rebuilds the acceleration structure once
+    void Evolve(double timeStep, std::size_t numberOfSteps = 1);
 
     double GetTime() const;
     void SetTime(double time);
 
+    // Copy of the scene at the given time, evolved from the current state in a single step. The dynamic objects are cloned, the static
+    // ones are shared, so the snapshot can be rendered while the scene or other snapshots change. Equal times give identical snapshots.
+    Scene Snapshot(double time) const;
+    // Copy of the scene after the given number of Evolve(timeStep) calls. Accelerating or rotating objects end up where frame-by-frame
+    // stepping puts them, which a single step of the whole duration does not reproduce.
+    Scene Snapshot(std::size_t numberOfSteps, double timeStep) const;
+
     size_t NumberOfObjects() const;
     size_t NumberOfLightSources() const;
 
@@ -38,6 +72,24 @@ private:
     std::vector<std::shared_ptr<ObjectPrimitive>> mLightSources;
     std::vector<std::shared_ptr<Object>> mDynamicObjects;
 
+    // Acceleration structure
+    Accelerator mAccelerator = Accelerator::BVH;
+    std::vector<std::shared_ptr<ObjectPrimitive>> mPrimitives;
+    Geometry::BVH mBVH;
+    bool mAccelerationStructureIsValid = false;
+
+    std::optional<Object::Intersection> IntersectLinear(const Ray& ray, double minDistance) const;
+    std::optional<Object::Intersection> IntersectBVH(const Ray& ray, double minDistance) const;
+    void FindHitsLinear(const Geometry::LinePacket& packet, double minDistance, Object::PacketHits& hits) const;
+    void FindHitsBVH(const Geometry::LinePacket& packet, double minDistance, Object::PacketHits& hits) const;
+    bool OccludedLinear(const Ray& ray, double minDistance, double maxDistance) const;
+    bool OccludedBVH(const Ray& ray, double minDistance, double maxDistance) const;
+
+    static std::string AcceleratorToString(Accelerator accelerator);
+
+    // Copy that shares the static objects and clones the dynamic ones
+    Scene CloneDynamicObjects() const;
+
     // Background
     Color mBackgroundColor;
     std::optional<Texture> mBackgroundTexture = std::nullopt;
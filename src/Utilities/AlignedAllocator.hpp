@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace Raytracer {
+
+constexpr std::size_t kCacheLineSize = 64;
+
+// Allocator for containers whose storage should start on a cache line (or any other power of two boundary)
+template <typename T, std::size_t Alignment = kCacheLineSize>
+class AlignedAllocator {
+public:
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two and at least alignof(T)");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* pointer, std::size_t) noexcept {
+        ::operator delete(pointer, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return true;
+    }
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+}  // namespace Raytracer
@@ -6,41 +6,41 @@
 
 namespace Raytracer {
 
-Color::Color(double red, double green, double blue) :
-    r(red),
-    g(green),
-    b(blue) {
+Color::Color(Real red, Real green, Real blue) {
+    data[0] = red;
+    data[1] = green;
+    data[2] = blue;
 }
 
-double Color::R() const {
-    return r;
+Real Color::R() const {
+    return data[0];
 }
 
-double Color::G() const {
-    return g;
+Real Color::G() const {
+    return data[1];
 }
 
-double Color::B() const {
-    return b;
+Real Color::B() const {
+    return data[2];
 }
 
-double Color::Luminance() const {
-    return 0.299 * r + 0.587 * g + 0.114 * b;
+Real Color::Luminance() const {
+    return 0.299 * data[0] + 0.587 * data[1] + 0.114 * data[2];
 }
 
-double Color::Length() const {
-    return std::sqrt(r * r + g * g + b * b);
+Real Color::Length() const {
+    return std::sqrt(data[0] * data[0] + data[1] * data[1] + data[2] * data[2]);
 }
 
-std::array<double, 3> Color::GetRGB() const {
-    return {r, g, b};
+std::array<Real, 3> Color::GetRGB() const {
+    return {data[0], data[1], data[2]};
 }
 
 std::array<int, 3> Color::GetRGB255() const {
     return {
-        static_cast<int>(std::lround(r * 255.0)),
-        static_cast<int>(std::lround(g * 255.0)),
-        static_cast<int>(std::lround(b * 255.0))};
+        static_cast<int>(std::lround(data[0] * 255.0)),
+        static_cast<int>(std::lround(data[1] * 255.0)),
+        static_cast<int>(std::lround(data[2] * 255.0))};
 }
 
 std::string Color::GetHexColor() const {
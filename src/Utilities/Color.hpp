@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Utilities/Real.hpp"
+#include "Utilities/Simd.hpp"
+
 #include <array>
 #include <iomanip>
 #include <sstream>
@@ -9,73 +12,93 @@ namespace Raytracer {
 class Color {
 public:
     Color() = default;
-    Color(double r, double g, double b);
+    Color(Real r, Real g, Real b);
 
-    double R() const;
-    double G() const;
-    double B() const;
+    Real R() const;
+    Real G() const;
+    Real B() const;
 
-    double Luminance() const;
-    double Length() const;
+    Real Luminance() const;
+    Real Length() const;
 
-    std::array<double, 3> GetRGB() const;
+    std::array<Real, 3> GetRGB() const;
     std::array<int, 3> GetRGB255() const;
 
     std::string GetHexColor() const;
 
     void PrintTerminalPixel() const;
 
-    // Operators
+    // Operators, element-wise on the SIMD storage
     bool operator==(const Color& other) const {
-        return (r == other.r) && (g == other.g) && (b == other.b);
+        return (data[0] == other.data[0]) && (data[1] == other.data[1]) && (data[2] == other.data[2]);
     }
 
-    Color operator*(double scalar) const {
-        return Color(r * scalar, g * scalar, b * scalar);
+    Color operator*(Real scalar) const {
+        Color result = *this;
+        result *= scalar;
+        return result;
     }
 
     Color operator*(const Color& other) const {
-        return Color(r * other.r, g * other.g, b * other.b);
+        Color result = *this;
+        result *= other;
+        return result;
     }
 
-    Color operator/(double scalar) const {
-        return Color(r / scalar, g / scalar, b / scalar);
+    Color operator/(Real scalar) const {
+        Color result = *this;
+        result /= scalar;
+        return result;
     }
 
     Color operator+(const Color& other) const {
-        return Color((r + other.r), (g + other.g), (b + other.b));
+        Color result = *this;
+        result += other;
+        return result;
     }
 
     Color operator-(const Color& other) const {
-        return Color((r - other.r), (g - other.g), (b - other.b));
+        Color result = *this;
+        result -= other;
+        return result;
     }
 
     Color& operator+=(const Color& other) {
-        r = r + other.r;
-        g = g + other.g;
-        b = b + other.b;
+        Simd::AddAssign<Real, 3>(data, other.data);
+        return *this;
+    }
+
+    Color& operator-=(const Color& other) {
+        Simd::SubtractAssign<Real, 3>(data, other.data);
         return *this;
     }
 
     Color& operator*=(const Color& other) {
-        r = r * other.r;
-        g = g * other.g;
-        b = b * other.b;
+        Simd::MultiplyAssign<Real, 3>(data, other.data);
+        return *this;
+    }
+
+    Color& operator*=(Real scalar) {
+        Simd::MultiplyAssign<Real, 3>(data, scalar);
+        return *this;
+    }
+
+    Color& operator/=(Real scalar) {
+        Simd::DivideAssign<Real, 3>(data, scalar);
         return *this;
     }
 
     friend std::ostream& operator<<(std::ostream& os, const Color& color) {
-        os << "RGB(" << color.r << ", " << color.g << ", " << color.b << ")";
+        os << "RGB(" << color.data[0] << ", " << color.data[1] << ", " << color.data[2] << ")";
         return os;
     }
 
 private:
-    double r = 0.0;
-    double g = 0.0;
-    double b = 0.0;
+    // The channels are stored like the components of Vector3D, see Utilities/Simd.hpp
+    Simd::Storage<Real, 3> data{};
 };
 
-inline Raytracer::Color operator*(double scalar, const Raytracer::Color& color) {
+inline Raytracer::Color operator*(Real scalar, const Raytracer::Color& color) {
     return color * scalar;
 }
 
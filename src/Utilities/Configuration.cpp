@@ -4,6 +4,7 @@
 #include "Scene/ObjectComposite.hpp"
 #include "Scene/ObjectPrimitive.hpp"
 #include "Scene/Objects.hpp"
+#include "Utilities/MeshLoader.hpp"
 #include "Version.hpp"
 
 #include <chrono>
@@ -20,7 +21,7 @@ Configuration& Configuration::GetInstance() {
     return instance;
 }
 
-void Configuration::ParseYamlFile(const std::string& path) {
+void Configuration::ParseYamlFile(const std::string& path, const std::string& runID) {
     try {
         mRoot = YAML::LoadFile(path);
     } catch (const YAML::Exception& e) {
@@ -37,11 +38,14 @@ void Configuration::ParseYamlFile(const std::string& path) {
         throw std::runtime_error("Missing required key: id");
     }
 
-    mRunID = CreateRunID();
+    mRunID = runID.empty() ? CreateRunID() : runID;
 
     CreateOutputDirectory();
 
-    CopyYamlFile(path);
+    // An earlier run keeps the copy of its configuration
+    if (runID.empty()) {
+        CopyYamlFile(path);
+    }
 }
 
 std::string Configuration::GetSceneID() const {
@@ -75,6 +79,7 @@ RenderConfig Configuration::GetRenderConfig() const {
     config.renderImage = node["image"] ? node["image"].as<bool>() : true;
     config.renderVideo = node["video"] ? node["video"].as<bool>() : false;
     config.videoDuration = node["video_duration"] ? node["video_duration"].as<double>() : 5.0;
+    config.streamVideo = node["stream_video"] ? node["stream_video"].as<bool>() : true;
     config.openOutputFiles = node["open_output_files"] ? node["open_output_files"].as<bool>() : true;
 
     return config;
@@ -103,6 +108,8 @@ Camera Configuration::ConstructCamera() const {
         rendererType = Renderer::Type::DETERMINISTIC;
     } else if (renderingEngineStr == "PATH_TRACER_NEE") {
         rendererType = Renderer::Type::PATH_TRACER_NEE;
+    } else if (renderingEngineStr == "PATH_TRACER_WAVEFRONT") {
+        rendererType = Renderer::Type::PATH_TRACER_WAVEFRONT;
     } else {
         throw std::invalid_argument("Unknown rendering type: " + renderingEngineStr);
     }
@@ -143,9 +150,33 @@ Camera Configuration::ConstructCamera() const {
     bool removeHotPixels = postProcessing["remove_hot_pixels"] ? postProcessing["remove_hot_pixels"].as<bool>() : false;
 
     bool useAntiAliasing = node["antialiasing"].as<bool>();
-    size_t samplesPerPixel = node["samples_per_pixel"].as<int>();
+    size_t samplesPerPixel = node["samples_per_pixel"] ? node["samples_per_pixel"].as<int>() : 1;
+    double timeBudgetSeconds = node["time_budget_seconds"] ? node["time_budget_seconds"].as<double>() : 0.0;
+    double checkpointIntervalSeconds = node["checkpoint_interval_seconds"] ? node["checkpoint_interval_seconds"].as<double>() : 0.0;
     double framesPerSecond = node["framesPerSecond"] ? node["framesPerSecond"].as<double>() : 30.0;
 
+    // Work scheduling
+    std::string schedulerStr = node["scheduler"] ? node["scheduler"].as<std::string>() : "TILES";
+    Camera::Scheduler scheduler;
+    if (schedulerStr == "TILES") {
+        scheduler = Camera::Scheduler::TILES;
+    } else if (schedulerStr == "SAMPLE_PASSES") {
+        scheduler = Camera::Scheduler::SAMPLE_PASSES;
+    } else {
+        throw std::invalid_argument("Unknown scheduler: " + schedulerStr);
+    }
+    std::size_t tileSize = node["tile_size"] ? node["tile_size"].as<std::size_t>() : 16;
+    bool parallelFrames = node["parallel_frames"] ? node["parallel_frames"].as<bool>() : false;
+
+    // Adaptive sampling
+    Camera::AdaptiveSampling adaptiveSampling;
+    if (auto adaptive = node["adaptive_sampling"]) {
+        adaptiveSampling.enabled = adaptive["enabled"] ? adaptive["enabled"].as<bool>() : false;
+        adaptiveSampling.minimumSamples = adaptive["min_samples_per_pixel"] ? adaptive["min_samples_per_pixel"].as<std::size_t>() : adaptiveSampling.minimumSamples;
+        adaptiveSampling.relativeErrorThreshold = adaptive["relative_error"] ? adaptive["relative_error"].as<double>() : adaptiveSampling.relativeErrorThreshold;
+        adaptiveSampling.saveSampleCountImage = adaptive["save_spp_image"] ? adaptive["save_spp_image"].as<bool>() : false;
+    }
+
     // Configure the camera
     Camera camera(position, direction, rendererType);
 
@@ -160,6 +191,14 @@ Camera Configuration::ConstructCamera() const {
     camera.SetSamplesPerPixel(samplesPerPixel);
     camera.SetUseAntiAliasing(useAntiAliasing);
     camera.SetFramesPerSecond(framesPerSecond);
+    camera.SetScheduler(scheduler, tileSize);
+    camera.SetParallelFrames(parallelFrames);
+    camera.SetAdaptiveSampling(adaptiveSampling);
+    camera.SetTimeBudget(timeBudgetSeconds);
+    camera.SetCheckpointInterval(checkpointIntervalSeconds);
+    if (node["seed"]) {
+        camera.SetSeed(node["seed"].as<std::uint64_t>());
+    }
 
     return camera;
 }
@@ -222,6 +261,8 @@ Scene Configuration::ConstructScene() const {
                 scene.AddObject(std::make_shared<ObjectPrimitive>(ParseHalfTorusWithSphericalCaps(obj)));
             } else if (type == "BoxAxisAligned") {
                 scene.AddObject(std::make_shared<ObjectPrimitive>(ParseBoxAxisAligned(obj)));
+            } else if (type == "Mesh") {
+                scene.AddObject(std::make_shared<ObjectPrimitive>(ParseMesh(obj)));
             } else {
                 // Check if it's a composite object type
                 static const std::vector<std::string> compositeTypes = {"Glass", "Globus"};
@@ -235,6 +276,16 @@ Scene Configuration::ConstructScene() const {
         }
     }
 
+    std::string acceleratorStr = node["accelerator"] ? node["accelerator"].as<std::string>() : "BVH";
+    if (acceleratorStr == "BVH") {
+        scene.SetAccelerator(Scene::Accelerator::BVH);
+    } else if (acceleratorStr == "LINEAR") {
+        scene.SetAccelerator(Scene::Accelerator::LINEAR);
+    } else {
+        throw std::invalid_argument("Unknown accelerator: " + acceleratorStr);
+    }
+
+    // Also builds the acceleration structure
     double time = node["time"] ? node["time"].as<double>() : 0.0;
     scene.SetTime(time);
 
@@ -256,9 +307,9 @@ void Configuration::PrintInfo() const {
 
 Vector3D Configuration::ParseVector3D(const YAML::Node& n) {
     return {
-        n[0].as<double>(),
-        n[1].as<double>(),
-        n[2].as<double>()};
+        n[0].as<Real>(),
+        n[1].as<Real>(),
+        n[2].as<Real>()};
 }
 
 Color Configuration::ParseColor(const YAML::Node& n) {
@@ -696,6 +747,30 @@ ObjectPrimitive Configuration::ParseBoxAxisAligned(const YAML::Node& obj) const
     return boxAA;
 }
 
+ObjectPrimitive Configuration::ParseMesh(const YAML::Node& obj) const {
+    ObjectProperties props = ParseObjectProperties(obj);
+    std::string filename = obj["file"].as<std::string>();
+    double scale = obj["scale"] ? obj["scale"].as<double>() : 1.0;
+
+    // Relative paths refer to the models directory
+    std::string filepath = std::filesystem::path(filename).is_absolute() ? filename : TOP_LEVEL_DIR "models/" + filename;
+    Geometry::Mesh::Buffers buffers = MeshLoader::Load(filepath, scale);
+
+    // Without an explicit orientation, the model's coordinates are used as they are
+    Vector3D referenceDirection = (obj["normal"] || obj["reference_direction"]) ? props.referenceDirection : Vector3D({1.0, 0.0, 0.0});
+
+    // Construct the mesh
+    ObjectPrimitive mesh = MakePrimitiveObject<Geometry::Mesh>(props.id, props.material, std::move(buffers), props.position, props.normal, referenceDirection);
+
+    mesh.SetVelocity(props.velocity);
+    mesh.SetAcceleration(props.acceleration);
+    mesh.SetAngularVelocity(props.angularVelocity);
+    mesh.SetSpin(props.spin);
+    mesh.SetVisible(props.visible);
+
+    return mesh;
+}
+
 ObjectComposite Configuration::ParseCompositeObject(const YAML::Node& obj, const std::string& type) const {
     ObjectProperties props = ParseObjectProperties(obj);
     double referenceLength = obj["reference_length"].as<double>();
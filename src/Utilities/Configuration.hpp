@@ -15,6 +15,7 @@ struct RenderConfig {
     bool renderImage = false;
     bool renderVideo = false;
     double videoDuration = 0.0;  // seconds
+    bool streamVideo = true;     // Pipe the frames into ffmpeg while rendering instead of saving them as PNG files first
     bool openOutputFiles = true;
 };
 
@@ -22,7 +23,8 @@ class Configuration {
 public:
     static Configuration& GetInstance();
 
-    void ParseYamlFile(const std::string& path);
+    // A run ID continues an earlier run, e.g. to resume it from its checkpoints. Otherwise, a new run ID is created.
+    void ParseYamlFile(const std::string& path, const std::string& runID = "");
 
     std::string GetSceneID() const;
     std::string GetRunID() const;
@@ -106,6 +108,7 @@ private:
     ObjectPrimitive ParseHalfTorus(const YAML::Node& obj) const;
     ObjectPrimitive ParseHalfTorusWithSphericalCaps(const YAML::Node& obj) const;
     ObjectPrimitive ParseBoxAxisAligned(const YAML::Node& obj) const;
+    ObjectPrimitive ParseMesh(const YAML::Node& obj) const;
 
     ObjectComposite ParseCompositeObject(const YAML::Node& obj, const std::string& type) const;
 
@@ -211,7 +211,7 @@ Image Denoiser::JointBilateralFilter(const Image& inputImage, GBuffer& gbuffer,
                     double depthDifference = std::abs(neighborPixel.depth - centerPixel.depth) / (centerPixel.depth + 1e-6);
                     double depthWeight = Gaussian(depthDifference, sigmaDepth);
                     // 3. Normal weight
-                    double normalDot = std::clamp(neighborPixel.normal.Dot(centerPixel.normal), -1.0, 1.0);
+                    double normalDot = std::clamp<double>(neighborPixel.normal.Dot(centerPixel.normal), -1.0, 1.0);
                     double normalDifference = std::acos(normalDot);  // in radians
                     double normalWeight = Gaussian(normalDifference, sigmaNormal);
                     // 4. Albedo weight
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Utilities/Image.hpp"
+
+namespace Raytracer {
+
+// Destination of the frames of a video, which receives every frame as soon as it is rendered, e.g. an encoder pipe, a PNG sequence, or
+// the frames in memory. Frames arrive in order.
+class FrameSink {
+public:
+    virtual ~FrameSink() = default;
+
+    virtual void AddFrame(const Image& frame) = 0;
+
+    // Completes the output after the last frame. Returns false if that failed.
+    virtual bool Close(bool openFile = false) = 0;
+
+    // Continue an interrupted video whose first frames were added to the sink in an earlier run, e.g. after a crash.
+    // Sinks that lose their frames when the process ends cannot continue.
+    virtual bool CanResumeAfter(std::size_t numberOfFrames) const { return false; }
+    virtual void ResumeAfter(std::size_t numberOfFrames) {}
+};
+
+}  // namespace Raytracer
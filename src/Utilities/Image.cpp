@@ -100,6 +100,30 @@ void Image::Clear(const Color& color) {
     std::fill(mPixels.begin(), mPixels.end(), color);
 }
 
+Image Image::Downsampled(std::size_t width) const {
+    if (width == 0 || width >= mWidth) {
+        return *this;
+    }
+    const std::size_t height = std::max<std::size_t>(1, (mHeight * width + mWidth / 2) / mWidth);
+    Image result(width, height);
+    for (std::size_t y = 0; y < height; y++) {
+        const std::size_t yBegin = y * mHeight / height;
+        const std::size_t yEnd = std::max(yBegin + 1, (y + 1) * mHeight / height);
+        for (std::size_t x = 0; x < width; x++) {
+            const std::size_t xBegin = x * mWidth / width;
+            const std::size_t xEnd = std::max(xBegin + 1, (x + 1) * mWidth / width);
+            Color sum(0.0, 0.0, 0.0);
+            for (std::size_t j = yBegin; j < yEnd; j++) {
+                for (std::size_t i = xBegin; i < xEnd; i++) {
+                    sum += mPixels[j * mWidth + i];
+                }
+            }
+            result.mPixels[y * width + x] = sum / Real((xEnd - xBegin) * (yEnd - yBegin));
+        }
+    }
+    return result;
+}
+
 void Image::PrintInfo() const {
     std::cout << "Image Information:" << std::endl
               << "Dimensions:\t" << mWidth << " x " << mHeight << std::endl
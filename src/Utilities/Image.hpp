@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Utilities/AlignedAllocator.hpp"
 #include "Utilities/Color.hpp"
 
 #include <cstddef>
@@ -27,6 +28,9 @@ public:
 
     void Clear(const Color& color = Color(0, 0, 0));
 
+    // Box filtered copy with the given width and the same aspect ratio, e.g. for previews
+    Image Downsampled(std::size_t width) const;
+
     // Color processing
     void ApplyGammaCorrection(double exposureValue = 1.5);
     void ApplyReinhardToneMapping();
@@ -37,7 +41,7 @@ public:
 private:
     std::size_t mWidth = 100;
     std::size_t mHeight = 100;
-    std::vector<Color> mPixels;
+    AlignedVector<Color> mPixels;
 
     void CheckBounds(std::size_t x, std::size_t y) const;
     size_t CountBlackPixels() const;
@@ -0,0 +1,103 @@
+#include "Utilities/ImageSequenceWriter.hpp"
+
+#include "Utilities/Configuration.hpp"
+#include "Version.hpp"
+
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <stdexcept>
+
+namespace Raytracer {
+
+ImageSequenceWriter::ImageSequenceWriter(double fps, std::string filepath, bool showTerminalOutput, bool deleteFrameFiles) :
+    mFPS(fps),
+    mFilepath(std::move(filepath)),
+    mShowTerminalOutput(showTerminalOutput),
+    mDeleteFrameFiles(deleteFrameFiles) {
+    if (mFilepath.empty()) {
+        std::string outputDirectory = Configuration::GetInstance().GetOutputDirectory();
+        std::filesystem::create_directories(outputDirectory + "/videos/");
+        mFilepath = outputDirectory + "/videos/video_" + Configuration::GetInstance().GetRunID() + ".mp4";
+    }
+
+    // Create a temp subfolder for the frames
+    mFramesDirectory = std::filesystem::path(mFilepath).parent_path() / ("video_tmp_" + Configuration::GetInstance().GetRunID());
+    std::filesystem::create_directories(mFramesDirectory);
+}
+
+void ImageSequenceWriter::AddFrame(const Image& frame) {
+    frame.Save(false, GetFramePath(mNumberOfFrames).string());
+    mNumberOfFrames++;
+}
+
+bool ImageSequenceWriter::Close(bool openFile) {
+    if (mNumberOfFrames == 0) {
+        std::cerr << "No frames to save." << std::endl;
+        return false;
+    }
+
+    // ffmpeg command
+    const std::string ffmpegExe = std::format("\"{}\"", FFMPEG_PATH);
+    const std::string verbosity = mShowTerminalOutput ? "" : "-v warning";
+    const std::string inputPattern = std::format("\"{}/frame_%04d.png\"", mFramesDirectory.string());
+    const std::string outputFile = std::format("\"{}\"", mFilepath);
+    std::string ffmpegCommand = std::format(
+        "{} -y {} -framerate {} -i {} -c:v libx264 -pix_fmt yuv420p {}",
+        ffmpegExe, verbosity, mFPS, inputPattern, outputFile);
+
+    const int status = std::system(ffmpegCommand.c_str());
+
+    // Clean up temp folder if requested
+    if (mDeleteFrameFiles) {
+        std::error_code ec;
+        std::filesystem::remove_all(mFramesDirectory, ec);
+    }
+
+    if (openFile) {
+        std::string command;
+#ifdef __APPLE__
+        command = "open " + mFilepath;
+#elif __linux__
+        command = "xdg-open " + mFilepath;
+#elif _WIN32
+        command = "start " + mFilepath;
+#endif
+        std::system(command.c_str());
+    }
+    return status == 0;
+}
+
+bool ImageSequenceWriter::CanResumeAfter(std::size_t numberOfFrames) const {
+    for (std::size_t i = 0; i < numberOfFrames; i++) {
+        if (!std::filesystem::exists(GetFramePath(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ImageSequenceWriter::ResumeAfter(std::size_t numberOfFrames) {
+    if (!CanResumeAfter(numberOfFrames)) {
+        throw std::runtime_error("ImageSequenceWriter::ResumeAfter: Frames of the interrupted run are missing in " + mFramesDirectory.string());
+    }
+    mNumberOfFrames = numberOfFrames;
+}
+
+std::size_t ImageSequenceWriter::GetNumberOfFrames() const {
+    return mNumberOfFrames;
+}
+
+const std::string& ImageSequenceWriter::GetFilepath() const {
+    return mFilepath;
+}
+
+const std::filesystem::path& ImageSequenceWriter::GetFramesDirectory() const {
+    return mFramesDirectory;
+}
+
+std::filesystem::path ImageSequenceWriter::GetFramePath(std::size_t index) const {
+    return mFramesDirectory / std::format("frame_{:04}.png", static_cast<int>(index + 1));
+}
+
+}  // namespace Raytracer
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Utilities/FrameSink.hpp"
+
+#include <filesystem>
+#include <string>
+
+namespace Raytracer {
+
+// Saves every frame as a PNG file as soon as it arrives, and encodes the PNG sequence into a video with ffmpeg when it is closed
+class ImageSequenceWriter : public FrameSink {
+public:
+    // An empty filepath writes to the videos folder of the output directory. The frames go into a temporary folder next to the video.
+    ImageSequenceWriter(double fps, std::string filepath = "", bool showTerminalOutput = false, bool deleteFrameFiles = true);
+
+    void AddFrame(const Image& frame) override;
+    bool Close(bool openFile = false) override;
+
+    // The frames of an interrupted run with the same run ID are still in the frames folder
+    bool CanResumeAfter(std::size_t numberOfFrames) const override;
+    void ResumeAfter(std::size_t numberOfFrames) override;
+
+    std::size_t GetNumberOfFrames() const;
+    const std::string& GetFilepath() const;
+    const std::filesystem::path& GetFramesDirectory() const;
+
+private:
+    double mFPS;
+    std::string mFilepath;
+    std::filesystem::path mFramesDirectory;
+    bool mShowTerminalOutput;
+    bool mDeleteFrameFiles;
+    std::size_t mNumberOfFrames = 0;
+
+    std::filesystem::path GetFramePath(std::size_t index) const;
+};
+
+}  // namespace Raytracer
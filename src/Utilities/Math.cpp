@@ -1,39 +1,138 @@
 #include "Utilities/Math.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
+#include <limits>
 
 namespace Raytracer {
 
-std::vector<double> Math::SolveQuadratic(double a, double b, double c) {
+namespace {
+
+// Value and derivative of a polynomial with coefficients from the highest degree to the constant (Horner's scheme)
+template <std::size_t N>
+void EvaluatePolynomial(const std::array<double, N>& coefficients, double x, double& value, double& derivative) {
+    value = coefficients[0];
+    derivative = 0.0;
+    for (std::size_t i = 1; i < N; i++) {
+        derivative = derivative * x + value;
+        value = value * x + coefficients[i];
+    }
+}
+
+template <std::size_t N>
+double EvaluatePolynomial(const std::array<double, N>& coefficients, double x) {
+    double value = coefficients[0];
+    for (std::size_t i = 1; i < N; i++) {
+        value = value * x + coefficients[i];
+    }
+    return value;
+}
+
+// Root of a polynomial in [lower, upper], where it changes sign, using Newton's method that falls back to bisection whenever a step leaves the bracket
+template <std::size_t N>
+double SolveBracketed(const std::array<double, N>& coefficients, double lower, double upper, double valueAtLower) {
+    constexpr int maxIterations = 100;
+    // Orient the bracket such that the polynomial is negative at 'negative' and positive at 'positive'
+    double negative = valueAtLower < 0.0 ? lower : upper;
+    double positive = valueAtLower < 0.0 ? upper : lower;
+    double x = 0.5 * (lower + upper);
+    for (int iteration = 0; iteration < maxIterations; iteration++) {
+        double value, derivative;
+        EvaluatePolynomial(coefficients, x, value, derivative);
+        if (value == 0.0) {
+            return x;
+        }
+        if (value < 0.0) {
+            negative = x;
+        } else {
+            positive = x;
+        }
+        double next = x - value / derivative;
+        if (!(next > std::min(negative, positive) && next < std::max(negative, positive))) {
+            next = 0.5 * (negative + positive);
+        }
+        if (std::abs(next - x) <= 4.0 * std::numeric_limits<double>::epsilon() * std::max(1.0, std::abs(x))) {
+            return next;
+        }
+        x = next;
+    }
+    return x;
+}
+
+// Roots between consecutive breakpoints (interval end points and critical points in ascending order)
+template <std::size_t N, std::size_t M>
+Math::Roots<N - 1> SolveBetweenBreakpoints(const std::array<double, N>& coefficients, const std::array<double, M>& breakpoints, std::size_t numBreakpoints) {
+    Math::Roots<N - 1> roots;
+    double left = breakpoints[0];
+    double valueLeft = EvaluatePolynomial(coefficients, left);
+    if (valueLeft == 0.0) {
+        roots.Add(left);
+    }
+    for (std::size_t i = 1; i < numBreakpoints && roots.count < N - 1; i++) {
+        const double right = breakpoints[i];
+        const double valueRight = EvaluatePolynomial(coefficients, right);
+        if (valueRight == 0.0) {
+            roots.Add(right);
+        } else if (valueLeft != 0.0 && (valueLeft < 0.0) != (valueRight < 0.0)) {
+            roots.Add(SolveBracketed(coefficients, left, right, valueLeft));
+        }
+        left = right;
+        valueLeft = valueRight;
+    }
+    return roots;
+}
+
+// Interval end points with the critical points in between
+template <std::size_t N, std::size_t M>
+std::size_t CollectBreakpoints(double lower, double upper, const Math::Roots<M>& criticalPoints, std::array<double, N>& breakpoints) {
+    std::size_t count = 0;
+    breakpoints[count++] = lower;
+    for (double point : criticalPoints) {
+        if (point > lower && point < upper) {
+            breakpoints[count++] = point;
+        }
+    }
+    breakpoints[count++] = upper;
+    return count;
+}
+
+}  // namespace
+
+Math::Roots<2> Math::SolveQuadratic(double a, double b, double c) {
     // Solve the quadratic equation at^2 + bt + c = 0 analytically.
+    Roots<2> roots;
     // Handle degenerate case: a == 0
     if (std::abs(a) < sEpsilon) {
         // Becomes linear: bt + c = 0
-        if (std::abs(b) < sEpsilon) {
-            return {};  // No solution or infinite solutions
+        if (std::abs(b) >= sEpsilon) {
+            roots.Add(-c / b);
         }
-        return {-c / b};
+        return roots;  // Otherwise no solution or infinite solutions
     }
 
     double discriminant = b * b - 4.0 * a * c;
     if (discriminant < 0.0) {
-        return {};
+        return roots;
     } else if (std::abs(discriminant) < sEpsilon) {
-        return {-b / (2.0 * a)};
+        roots.Add(-b / (2.0 * a));
     } else {
         double sqrtDisc = std::sqrt(discriminant);
-        return {(-b + sqrtDisc) / (2.0 * a), (-b - sqrtDisc) / (2.0 * a)};
+        roots.Add((-b + sqrtDisc) / (2.0 * a));
+        roots.Add((-b - sqrtDisc) / (2.0 * a));
     }
+    return roots;
 }
 
-std::vector<double> Math::SolveCubic(double a, double b, double c, double d) {
+Math::Roots<3> Math::SolveCubic(double a, double b, double c, double d) {
     // Solve the cubic equation at^3 + bt^2 + ct + d = 0 analytically.
+    Roots<3> roots;
 
     // Handle degenerate case: a == 0
     if (std::abs(a) < sEpsilon) {
         // Becomes quadratic: bt^2 + ct + d = 0
-        return SolveQuadratic(b, c, d);
+        roots.Add(SolveQuadratic(b, c, d));
+        return roots;
     }
 
     // Convert to depressed cubic: t^3 + pt + q = 0
@@ -44,26 +143,24 @@ std::vector<double> Math::SolveCubic(double a, double b, double c, double d) {
     // Cardano's discriminant
     double discriminant = q * q / 4.0 + p * p * p / 27.0;
 
-    std::vector<double> roots;
-
     if (discriminant > sEpsilon) {
         // One real root (casus irreducibilis doesn't apply)
         double sqrtDisc = std::sqrt(discriminant);
         double u = std::cbrt(-q / 2.0 + sqrtDisc);
         double v = std::cbrt(-q / 2.0 - sqrtDisc);
         double t = u + v;
-        roots.push_back(t - b / (3.0 * a));
+        roots.Add(t - b / (3.0 * a));
     } else if (std::abs(discriminant) <= sEpsilon) {
         // Discriminant = 0: repeated roots
         if (std::abs(p) < sEpsilon && std::abs(q) < sEpsilon) {
             // Triple root at x = -b/(3a)
-            roots.push_back(-b / (3.0 * a));
+            roots.Add(-b / (3.0 * a));
         } else {
             // One single root and one double root
             double t1 = 3.0 * q / p;
             double t2 = -3.0 * q / (2.0 * p);
-            roots.push_back(t1 - b / (3.0 * a));
-            roots.push_back(t2 - b / (3.0 * a));
+            roots.Add(t1 - b / (3.0 * a));
+            roots.Add(t2 - b / (3.0 * a));
         }
     } else {
         // Three distinct real roots (casus irreducibilis)
@@ -73,28 +170,29 @@ std::vector<double> Math::SolveCubic(double a, double b, double c, double d) {
 
         for (int k = 0; k < 3; ++k) {
             double t = 2.0 * std::cbrt(rho) * std::cos((theta + 2.0 * M_PI * k) / 3.0);
-            roots.push_back(t - b / (3.0 * a));
+            roots.Add(t - b / (3.0 * a));
         }
     }
     return roots;
 }
 
-std::vector<double> Math::SolveQuartic(double a, double b, double c, double d, double e) {
+Math::Roots<4> Math::SolveQuartic(double a, double b, double c, double d, double e) {
     // Solve the quartic equation at^4 + bt^3 + ct^2 + dt + e = 0 analytically.
+    Roots<4> roots;
 
     // Handle degenerate case: a == 0
     if (std::abs(a) < sEpsilon) {
         // Becomes cubic: bt^3 + ct^2 + dt + e = 0
-        return SolveCubic(b, c, d, e);
+        roots.Add(SolveCubic(b, c, d, e));
+        return roots;
     }
 
     // Special case: e == 0
     if (std::abs(e) < sEpsilon) {
         // Factor out t: t(at^3 + bt^2 + ct + d) = 0
-        std::vector<double> roots = {0.0};
+        roots.Add(0.0);
         // Solve the cubic equation at^3 + bt^2 + ct + d = 0
-        std::vector<double> cubicRoots = SolveCubic(a, b, c, d);
-        roots.insert(roots.end(), cubicRoots.begin(), cubicRoots.end());
+        roots.Add(SolveCubic(a, b, c, d));
         return roots;
     }
 
@@ -104,21 +202,21 @@ std::vector<double> Math::SolveQuartic(double a, double b, double c, double d, d
     double B = b * b * b / (8.0 * a * a * a) - b * c / (2.0 * a * a) + d / a;
     double C = -3.0 * b * b * b * b / (256.0 * a * a * a * a) + b * b * c / (16.0 * a * a * a) - b * d / (4.0 * a * a) + e / a;
 
-    std::vector<double> uRoots = SolveDepressedQuartic(A, B, C);
-    std::vector<double> roots;
-    for (double u : uRoots) {
-        roots.push_back(u - b / (4.0 * a));
+    for (double u : SolveDepressedQuartic(A, B, C)) {
+        roots.Add(u - b / (4.0 * a));
     }
     return roots;
 }
 
-std::vector<double> Math::SolveQuarticDurandKerner(double a, double b, double c, double d, double e) {
+Math::Roots<4> Math::SolveQuarticDurandKerner(double a, double b, double c, double d, double e) {
     // Solve the quartic equation at^4 + bt^3 + ct^2 + dt + e = 0 using the Durand-Kerner method.
+    Roots<4> realRoots;
 
     // Handle degenerate case: a == 0
     if (std::abs(a) < sEpsilon) {
         // Becomes cubic: bt^3 + ct^2 + dt + e = 0
-        return SolveCubic(b, c, d, e);
+        realRoots.Add(SolveCubic(b, c, d, e));
+        return realRoots;
     }
 
     // Normalize coefficients
@@ -128,7 +226,7 @@ std::vector<double> Math::SolveQuarticDurandKerner(double a, double b, double c,
     e /= a;
 
     // Initial guesses for the roots (using roots of unity scaled)
-    std::vector<std::complex<double>> roots = {
+    std::array<std::complex<double>, 4> roots = {
         std::complex<double>(1, 0),
         std::complex<double>(0, 1),
         std::complex<double>(-1, 0),
@@ -159,55 +257,126 @@ std::vector<double> Math::SolveQuarticDurandKerner(double a, double b, double c,
     }
 
     // Extract real parts of the roots
-    std::vector<double> realRoots;
     for (const auto& root : roots) {
         if (std::abs(root.imag()) < tolerance) {
-            realRoots.push_back(root.real());
+            realRoots.Add(root.real());
         }
     }
 
     return realRoots;
 }
 
-std::vector<double> Math::SolveBiquadratic(double a, double b, double c) {
+Math::Roots<2> Math::SolveQuadraticInInterval(const std::array<double, 3>& coefficients, double lower, double upper) {
+    const auto [a, b, c] = coefficients;
+    Roots<2> roots;
+    auto add = [&](double root) {
+        if (root >= lower && root <= upper) {
+            roots.Add(root);
+        }
+    };
+    if (a == 0.0) {
+        if (b != 0.0) {
+            add(-c / b);
+        }
+        return roots;
+    }
+    const double discriminant = b * b - 4.0 * a * c;
+    if (discriminant < 0.0) {
+        return roots;
+    }
+    // Numerically stable form that avoids cancellation
+    const double q = -0.5 * (b + std::copysign(std::sqrt(discriminant), b));
+    double root1 = q / a;
+    double root2 = q != 0.0 ? c / q : root1;
+    if (root1 > root2) {
+        std::swap(root1, root2);
+    }
+    add(root1);
+    if (root2 != root1) {
+        add(root2);
+    }
+    return roots;
+}
+
+Math::Roots<3> Math::SolveCubicInInterval(const std::array<double, 4>& coefficients, double lower, double upper) {
+    if (coefficients[0] == 0.0) {
+        Roots<2> quadraticRoots = SolveQuadraticInInterval({coefficients[1], coefficients[2], coefficients[3]}, lower, upper);
+        Roots<3> roots;
+        roots.Add(quadraticRoots);
+        return roots;
+    }
+    const Roots<2> criticalPoints = SolveQuadraticInInterval({3.0 * coefficients[0], 2.0 * coefficients[1], coefficients[2]}, lower, upper);
+    std::array<double, 4> breakpoints;
+    const std::size_t numBreakpoints = CollectBreakpoints(lower, upper, criticalPoints, breakpoints);
+    return SolveBetweenBreakpoints(coefficients, breakpoints, numBreakpoints);
+}
+
+Math::Roots<4> Math::SolveQuarticInInterval(const std::array<double, 5>& coefficients, double lower, double upper) {
+    if (coefficients[0] == 0.0) {
+        Roots<3> cubicRoots = SolveCubicInInterval({coefficients[1], coefficients[2], coefficients[3], coefficients[4]}, lower, upper);
+        Roots<4> roots;
+        roots.Add(cubicRoots);
+        return roots;
+    }
+    const Roots<3> criticalPoints = SolveCubicInInterval({4.0 * coefficients[0], 3.0 * coefficients[1], 2.0 * coefficients[2], coefficients[3]}, lower, upper);
+    std::array<double, 5> breakpoints;
+    const std::size_t numBreakpoints = CollectBreakpoints(lower, upper, criticalPoints, breakpoints);
+    return SolveBetweenBreakpoints(coefficients, breakpoints, numBreakpoints);
+}
+
+Math::Roots<4> Math::SolveQuarticBracketed(double a, double b, double c, double d, double e) {
+    // Cauchy's bound: all real roots lie within |t| <= 1 + max |coefficient / leading coefficient|
+    const std::array<double, 5> coefficients = {a, b, c, d, e};
+    std::size_t leading = 0;
+    while (leading < 4 && coefficients[leading] == 0.0) {
+        leading++;
+    }
+    double bound = 1.0;
+    for (std::size_t i = leading + 1; i < 5; i++) {
+        bound = std::max(bound, 1.0 + std::abs(coefficients[i] / coefficients[leading]));
+    }
+    return SolveQuarticInInterval(coefficients, -bound, bound);
+}
+
+Math::Roots<4> Math::SolveBiquadratic(double a, double b, double c) {
     // Solve the biquadratic equation at^4 + bt^2 + c = 0 analytically.
+    Roots<4> roots;
     double discriminant = b * b - 4.0 * a * c;
 
     if (discriminant < 0.0) {
-        return {};
+        return roots;
     } else if (std::abs(discriminant) < sEpsilon) {
         double z = -b / (2.0 * a);
-        if (z < 0.0) {
-            return {};
-        } else if (std::abs(z) < sEpsilon) {
-            return {0.0};
-        } else {
+        if (std::abs(z) < sEpsilon) {
+            roots.Add(0.0);
+        } else if (z > 0.0) {
             double sqrtZ = std::sqrt(z);
-            return {sqrtZ, -sqrtZ};
+            roots.Add(sqrtZ);
+            roots.Add(-sqrtZ);
         }
+        return roots;
     }
 
     double zPlus = (-b + std::sqrt(discriminant)) / (2.0 * a);
     double zMinus = (-b - std::sqrt(discriminant)) / (2.0 * a);
-    std::vector<double> roots;
     if (zPlus >= sEpsilon) {
         double sqrtZPlus = std::sqrt(zPlus);
-        roots.push_back(sqrtZPlus);
-        roots.push_back(-sqrtZPlus);
+        roots.Add(sqrtZPlus);
+        roots.Add(-sqrtZPlus);
     } else if (std::abs(zPlus) < sEpsilon) {
-        roots.push_back(0.0);
+        roots.Add(0.0);
     }
     if (zMinus >= sEpsilon) {
         double sqrtZMinus = std::sqrt(zMinus);
-        roots.push_back(sqrtZMinus);
-        roots.push_back(-sqrtZMinus);
+        roots.Add(sqrtZMinus);
+        roots.Add(-sqrtZMinus);
     } else if (std::abs(zMinus) < sEpsilon) {
-        roots.push_back(0.0);
+        roots.Add(0.0);
     }
     return roots;
 }
 
-std::vector<double> Math::SolveDepressedQuartic(double A, double B, double C) {
+Math::Roots<4> Math::SolveDepressedQuartic(double A, double B, double C) {
     if (std::abs(B) < sEpsilon) {
         // B == 0 -> biquadratic equation u^4 + Au^2 + C = 0
         return SolveBiquadratic(1.0, A, C);
@@ -219,7 +388,7 @@ std::vector<double> Math::SolveDepressedQuartic(double A, double B, double C) {
     double cubicC = -4.0 * C;
     double cubicD = 4.0 * A * C - B * B;
 
-    std::vector<double> yRoots = SolveCubic(cubicA, cubicB, cubicC, cubicD);
+    Roots<3> yRoots = SolveCubic(cubicA, cubicB, cubicC, cubicD);
     if (yRoots.empty()) {
         return {};
     }
@@ -238,19 +407,19 @@ std::vector<double> Math::SolveDepressedQuartic(double A, double B, double C) {
         double E = (4.0 * A * y - 8.0 * C - A * A) / (4.0 * D);
 
         // Solve u^2 + D*u + (y/2 + E/2) = 0 and u^2 - D*u + (y/2 - E/2) = 0
-        std::vector<double> roots;
+        Roots<4> roots;
         double disc1 = D * D - 4.0 * (y / 2.0 + E / 2.0);
         double disc2 = D * D - 4.0 * (y / 2.0 - E / 2.0);
 
         if (disc1 >= 0.0) {
             double sqrt_disc1 = std::sqrt(disc1);
-            roots.push_back((-D + sqrt_disc1) / 2.0);
-            roots.push_back((-D - sqrt_disc1) / 2.0);
+            roots.Add((-D + sqrt_disc1) / 2.0);
+            roots.Add((-D - sqrt_disc1) / 2.0);
         }
         if (disc2 >= 0.0) {
             double sqrt_disc2 = std::sqrt(disc2);
-            roots.push_back((D + sqrt_disc2) / 2.0);
-            roots.push_back((D - sqrt_disc2) / 2.0);
+            roots.Add((D + sqrt_disc2) / 2.0);
+            roots.Add((D - sqrt_disc2) / 2.0);
         }
         return roots;
     }
@@ -259,22 +428,22 @@ std::vector<double> Math::SolveDepressedQuartic(double A, double B, double C) {
     double D = std::sqrt(3.0 * A / 4.0 - R * R + 2.0 * y);
     double E = (4.0 * A * y - 8.0 * C - A * A) / (4.0 * R);
 
-    std::vector<double> roots;
+    Roots<4> roots;
 
     // Solve u^2 + R*u + (A/4 + y/2 + E/2) = 0
     double disc1 = R * R - 4.0 * (A / 4.0 + y / 2.0 + E / 2.0);
     if (disc1 >= 0.0) {
         double sqrt_disc1 = std::sqrt(disc1);
-        roots.push_back((-R + sqrt_disc1) / 2.0);
-        roots.push_back((-R - sqrt_disc1) / 2.0);
+        roots.Add((-R + sqrt_disc1) / 2.0);
+        roots.Add((-R - sqrt_disc1) / 2.0);
     }
 
     // Solve u^2 - R*u + (A/4 + y/2 - E/2) = 0
     double disc2 = R * R - 4.0 * (A / 4.0 + y / 2.0 - E / 2.0);
     if (disc2 >= 0.0) {
         double sqrt_disc2 = std::sqrt(disc2);
-        roots.push_back((R + sqrt_disc2) / 2.0);
-        roots.push_back((R - sqrt_disc2) / 2.0);
+        roots.Add((R + sqrt_disc2) / 2.0);
+        roots.Add((R - sqrt_disc2) / 2.0);
     }
 
     return roots;
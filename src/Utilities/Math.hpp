@@ -1,29 +1,82 @@
 #pragma once
 
-#include <vector>
+#include <array>
+#include <cstddef>
 
 namespace Raytracer {
 
 class Math {
 public:
+    // Real roots of a polynomial, stored without heap allocation.
+    // The interval solvers report them in ascending order.
+    template <std::size_t N>
+    struct Roots {
+        std::array<double, N> values{};
+        std::size_t count = 0;
+
+        // The capacity N is the degree of the polynomial, so it is never exceeded
+        void Add(double root) {
+            values[count++] = root;
+        }
+        template <std::size_t M>
+        void Add(const Roots<M>& roots) {
+            static_assert(M <= N);
+            for (double root : roots) {
+                Add(root);
+            }
+        }
+
+        double* begin() {
+            return values.data();
+        }
+        double* end() {
+            return values.data() + count;
+        }
+        const double* begin() const {
+            return values.data();
+        }
+        const double* end() const {
+            return values.data() + count;
+        }
+        std::size_t size() const {
+            return count;
+        }
+        bool empty() const {
+            return count == 0;
+        }
+        double operator[](std::size_t i) const {
+            return values[i];
+        }
+    };
+
     // Solve the quadratic equation at^2 + bt + c = 0
-    static std::vector<double> SolveQuadratic(double a, double b, double c);
+    static Roots<2> SolveQuadratic(double a, double b, double c);
 
     // Solve the cubic equation at^3 + bt^2 + ct + d = 0
-    static std::vector<double> SolveCubic(double a, double b, double c, double d);
+    static Roots<3> SolveCubic(double a, double b, double c, double d);
 
     // Solve the quartic equation at^4 + bt^3 + ct^2 + dt + e = 0
-    static std::vector<double> SolveQuartic(double a, double b, double c, double d, double e);
-    static std::vector<double> SolveQuarticDurandKerner(double a, double b, double c, double d, double e);
+    static Roots<4> SolveQuartic(double a, double b, double c, double d, double e);
+    static Roots<4> SolveQuarticDurandKerner(double a, double b, double c, double d, double e);
+
+    // Real roots in [lower, upper] of the polynomial with the given coefficients, ordered from the highest degree to the constant.
+    // The critical points (roots of the derivative) split the interval into monotonic pieces, and each sign change is bracketed and solved with safeguarded Newton iterations.
+    // Roots of even multiplicity, where the polynomial only touches zero, are not reported.
+    static Roots<2> SolveQuadraticInInterval(const std::array<double, 3>& coefficients, double lower, double upper);
+    static Roots<3> SolveCubicInInterval(const std::array<double, 4>& coefficients, double lower, double upper);
+    static Roots<4> SolveQuarticInInterval(const std::array<double, 5>& coefficients, double lower, double upper);
+
+    // All real roots of at^4 + bt^3 + ct^2 + dt + e = 0, bracketed within the Cauchy bound
+    static Roots<4> SolveQuarticBracketed(double a, double b, double c, double d, double e);
 
 private:
     static constexpr double sEpsilon = 1e-6;
 
     // Solve the biquadratic equation at^4 + bt^2 + c = 0
-    static std::vector<double> SolveBiquadratic(double a, double b, double c);
+    static Roots<4> SolveBiquadratic(double a, double b, double c);
 
     // Solve the depressed quartic u^4 + Au^2 + Bu + C = 0
-    static std::vector<double> SolveDepressedQuartic(double A, double B, double C);
+    static Roots<4> SolveDepressedQuartic(double A, double B, double C);
 };
 
 }  // namespace Raytracer
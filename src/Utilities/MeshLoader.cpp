@@ -0,0 +1,467 @@
+#include "Utilities/MeshLoader.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Raytracer {
+
+namespace {
+
+constexpr std::uint32_t kMissing = std::numeric_limits<std::uint32_t>::max();
+
+const char* SkipSpaces(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+        p++;
+    }
+    return p;
+}
+
+const char* SkipLine(const char* p, const char* end) {
+    while (p < end && *p != '\n') {
+        p++;
+    }
+    return p < end ? p + 1 : end;
+}
+
+bool ParseFloat(const char*& p, const char* end, float& value) {
+    p = SkipSpaces(p, end);
+    if (p < end && *p == '+') {
+        p++;
+    }
+    auto [next, error] = std::from_chars(p, end, value);
+    if (error != std::errc()) {
+        return false;
+    }
+    p = next;
+    return true;
+}
+
+bool ParseInteger(const char*& p, const char* end, std::int64_t& value) {
+    auto [next, error] = std::from_chars(p, end, value);
+    if (error != std::errc()) {
+        return false;
+    }
+    p = next;
+    return true;
+}
+
+// OBJ indices are 1-based, negative indices count backwards from the last element
+std::uint32_t ResolveObjIndex(std::int64_t index, std::size_t count, const std::string& filepath) {
+    std::int64_t resolved = index > 0 ? index - 1 : static_cast<std::int64_t>(count) + index;
+    if (index == 0 || resolved < 0 || resolved >= static_cast<std::int64_t>(count)) {
+        throw std::runtime_error("MeshLoader: Invalid vertex index " + std::to_string(index) + " in " + filepath);
+    }
+    return static_cast<std::uint32_t>(resolved);
+}
+
+// Indices of the position, texture coordinate, and normal of one polygon corner
+using ObjCorner = std::array<std::uint32_t, 3>;
+
+struct ObjCornerHash {
+    std::size_t operator()(const ObjCorner& corner) const {
+        std::uint64_t hash = corner[0];
+        hash = hash * 0x9E3779B97F4A7C15ull ^ corner[1];
+        hash = hash * 0x9E3779B97F4A7C15ull ^ corner[2];
+        return static_cast<std::size_t>(hash ^ (hash >> 29));
+    }
+};
+
+enum class PlyType {
+    INT8,
+    UINT8,
+    INT16,
+    UINT16,
+    INT32,
+    UINT32,
+    FLOAT32,
+    FLOAT64,
+};
+
+struct PlyProperty {
+    std::string name;
+    PlyType type;
+    bool isList = false;
+    PlyType countType = PlyType::UINT8;
+};
+
+struct PlyElement {
+    std::string name;
+    std::size_t count;
+    std::vector<PlyProperty> properties;
+};
+
+PlyType ParsePlyType(const std::string& name) {
+    if (name == "char" || name == "int8") {
+        return PlyType::INT8;
+    } else if (name == "uchar" || name == "uint8") {
+        return PlyType::UINT8;
+    } else if (name == "short" || name == "int16") {
+        return PlyType::INT16;
+    } else if (name == "ushort" || name == "uint16") {
+        return PlyType::UINT16;
+    } else if (name == "int" || name == "int32") {
+        return PlyType::INT32;
+    } else if (name == "uint" || name == "uint32") {
+        return PlyType::UINT32;
+    } else if (name == "float" || name == "float32") {
+        return PlyType::FLOAT32;
+    } else if (name == "double" || name == "float64") {
+        return PlyType::FLOAT64;
+    }
+    throw std::invalid_argument("MeshLoader: Unknown PLY property type: " + name);
+}
+
+std::size_t SizeOf(PlyType type) {
+    switch (type) {
+        case PlyType::INT8:
+        case PlyType::UINT8:
+            return 1;
+        case PlyType::INT16:
+        case PlyType::UINT16:
+            return 2;
+        case PlyType::INT32:
+        case PlyType::UINT32:
+        case PlyType::FLOAT32:
+            return 4;
+        case PlyType::FLOAT64:
+            return 8;
+    }
+    return 0;
+}
+
+template <typename T>
+T FromBytes(const char* bytes) {
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+}
+
+double ReadPlyValue(const char*& p, const char* end, PlyType type, bool swapBytes) {
+    const std::size_t size = SizeOf(type);
+    if (static_cast<std::size_t>(end - p) < size) {
+        throw std::runtime_error("MeshLoader: Unexpected end of PLY file.");
+    }
+    char bytes[8];
+    std::memcpy(bytes, p, size);
+    p += size;
+    if (swapBytes) {
+        std::reverse(bytes, bytes + size);
+    }
+    switch (type) {
+        case PlyType::INT8:
+            return FromBytes<std::int8_t>(bytes);
+        case PlyType::UINT8:
+            return FromBytes<std::uint8_t>(bytes);
+        case PlyType::INT16:
+            return FromBytes<std::int16_t>(bytes);
+        case PlyType::UINT16:
+            return FromBytes<std::uint16_t>(bytes);
+        case PlyType::INT32:
+            return FromBytes<std::int32_t>(bytes);
+        case PlyType::UINT32:
+            return FromBytes<std::uint32_t>(bytes);
+        case PlyType::FLOAT32:
+            return FromBytes<float>(bytes);
+        case PlyType::FLOAT64:
+            return FromBytes<double>(bytes);
+    }
+    return 0.0;
+}
+
+}  // namespace
+
+Geometry::Mesh::Buffers MeshLoader::Load(const std::string& filepath, double scale) {
+    std::string extension = std::filesystem::path(filepath).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) {
+        return std::tolower(c);
+    });
+    if (extension == ".obj") {
+        return LoadOBJ(filepath, scale);
+    } else if (extension == ".ply") {
+        return LoadPLY(filepath, scale);
+    }
+    throw std::invalid_argument("MeshLoader: Unknown mesh file format: " + filepath);
+}
+
+Geometry::Mesh::Buffers MeshLoader::LoadOBJ(const std::string& filepath, double scale) {
+    const std::string content = ReadFile(filepath);
+    const char* p = content.data();
+    const char* end = p + content.size();
+
+    std::vector<float> positionX, positionY, positionZ;
+    std::vector<float> normalX, normalY, normalZ;
+    std::vector<float> textureU, textureV;
+    std::vector<ObjCorner> corners;  // Three per triangle
+    std::vector<ObjCorner> polygon;
+    bool allCornersHaveNormals = true;
+    bool allCornersHaveTextureCoordinates = true;
+
+    auto parseError = [&](const char* what) {
+        const std::size_t line = std::count(content.data(), p, '\n') + 1;
+        return std::runtime_error("MeshLoader: Invalid " + std::string(what) + " in " + filepath + ":" + std::to_string(line));
+    };
+
+    while (p < end) {
+        p = SkipSpaces(p, end);
+        if (p + 1 < end && p[0] == 'v' && (p[1] == ' ' || p[1] == '\t')) {
+            p += 1;
+            float x, y, z;
+            if (!ParseFloat(p, end, x) || !ParseFloat(p, end, y) || !ParseFloat(p, end, z)) {
+                throw parseError("vertex");
+            }
+            positionX.push_back(static_cast<float>(x * scale));
+            positionY.push_back(static_cast<float>(y * scale));
+            positionZ.push_back(static_cast<float>(z * scale));
+        } else if (p + 2 < end && p[0] == 'v' && p[1] == 'n' && (p[2] == ' ' || p[2] == '\t')) {
+            p += 2;
+            float x, y, z;
+            if (!ParseFloat(p, end, x) || !ParseFloat(p, end, y) || !ParseFloat(p, end, z)) {
+                throw parseError("normal");
+            }
+            normalX.push_back(x);
+            normalY.push_back(y);
+            normalZ.push_back(z);
+        } else if (p + 2 < end && p[0] == 'v' && p[1] == 't' && (p[2] == ' ' || p[2] == '\t')) {
+            p += 2;
+            float u, v = 0.0f;
+            if (!ParseFloat(p, end, u)) {
+                throw parseError("texture coordinate");
+            }
+            ParseFloat(p, end, v);
+            textureU.push_back(u);
+            textureV.push_back(v);
+        } else if (p + 1 < end && p[0] == 'f' && (p[1] == ' ' || p[1] == '\t')) {
+            p += 1;
+            polygon.clear();
+            while (true) {
+                p = SkipSpaces(p, end);
+                if (p == end || *p == '\n' || *p == '#') {
+                    break;
+                }
+                // Corners are given as v, v/vt, v//vn, or v/vt/vn
+                std::int64_t index;
+                if (!ParseInteger(p, end, index)) {
+                    throw parseError("face");
+                }
+                ObjCorner corner = {ResolveObjIndex(index, positionX.size(), filepath), kMissing, kMissing};
+                if (p < end && *p == '/') {
+                    p++;
+                    if (p < end && *p != '/') {
+                        if (!ParseInteger(p, end, index)) {
+                            throw parseError("face");
+                        }
+                        corner[1] = ResolveObjIndex(index, textureU.size(), filepath);
+                    }
+                    if (p < end && *p == '/') {
+                        p++;
+                        if (!ParseInteger(p, end, index)) {
+                            throw parseError("face");
+                        }
+                        corner[2] = ResolveObjIndex(index, normalX.size(), filepath);
+                    }
+                }
+                allCornersHaveTextureCoordinates &= corner[1] != kMissing;
+                allCornersHaveNormals &= corner[2] != kMissing;
+                polygon.push_back(corner);
+            }
+            if (polygon.size() < 3) {
+                throw parseError("face");
+            }
+            for (std::size_t i = 1; i + 1 < polygon.size(); i++) {
+                corners.insert(corners.end(), {polygon[0], polygon[i], polygon[i + 1]});
+            }
+        }
+        p = SkipLine(p, end);
+    }
+
+    Geometry::Mesh::Buffers buffers;
+    buffers.indices.reserve(corners.size());
+    if (!allCornersHaveNormals && !allCornersHaveTextureCoordinates) {
+        // Only positions are shared, so the OBJ indices can be used directly
+        buffers.x = std::move(positionX);
+        buffers.y = std::move(positionY);
+        buffers.z = std::move(positionZ);
+        for (const ObjCorner& corner : corners) {
+            buffers.indices.push_back(corner[0]);
+        }
+        return buffers;
+    }
+
+    // Every distinct combination of position, texture coordinate, and normal becomes one vertex
+    if (!allCornersHaveTextureCoordinates) {
+        textureU.clear();
+    }
+    if (!allCornersHaveNormals) {
+        normalX.clear();
+    }
+    std::unordered_map<ObjCorner, std::uint32_t, ObjCornerHash> vertexIndices;
+    vertexIndices.reserve(positionX.size());
+    for (ObjCorner corner : corners) {
+        if (textureU.empty()) {
+            corner[1] = kMissing;
+        }
+        if (normalX.empty()) {
+            corner[2] = kMissing;
+        }
+        auto [it, inserted] = vertexIndices.try_emplace(corner, static_cast<std::uint32_t>(buffers.NumberOfVertices()));
+        if (inserted) {
+            buffers.x.push_back(positionX[corner[0]]);
+            buffers.y.push_back(positionY[corner[0]]);
+            buffers.z.push_back(positionZ[corner[0]]);
+            if (corner[1] != kMissing) {
+                buffers.u.push_back(textureU[corner[1]]);
+                buffers.v.push_back(textureV[corner[1]]);
+            }
+            if (corner[2] != kMissing) {
+                buffers.normalX.push_back(normalX[corner[2]]);
+                buffers.normalY.push_back(normalY[corner[2]]);
+                buffers.normalZ.push_back(normalZ[corner[2]]);
+            }
+        }
+        buffers.indices.push_back(it->second);
+    }
+    return buffers;
+}
+
+Geometry::Mesh::Buffers MeshLoader::LoadPLY(const std::string& filepath, double scale) {
+    const std::string content = ReadFile(filepath);
+
+    // 1. Parse the ASCII header
+    const std::size_t headerEnd = content.find("end_header");
+    if (content.compare(0, 3, "ply") != 0 || headerEnd == std::string::npos) {
+        throw std::runtime_error("MeshLoader: Invalid PLY header in " + filepath);
+    }
+    std::istringstream header(content.substr(0, headerEnd));
+    std::vector<PlyElement> elements;
+    std::string format;
+    std::string line;
+    while (std::getline(header, line)) {
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (keyword == "format") {
+            tokens >> format;
+        } else if (keyword == "element") {
+            PlyElement element;
+            tokens >> element.name >> element.count;
+            elements.push_back(element);
+        } else if (keyword == "property") {
+            if (elements.empty()) {
+                throw std::runtime_error("MeshLoader: PLY property without element in " + filepath);
+            }
+            PlyProperty property;
+            std::string type;
+            tokens >> type;
+            if (type == "list") {
+                std::string countType, itemType;
+                tokens >> countType >> itemType;
+                property.isList = true;
+                property.countType = ParsePlyType(countType);
+                property.type = ParsePlyType(itemType);
+            } else {
+                property.type = ParsePlyType(type);
+            }
+            tokens >> property.name;
+            elements.back().properties.push_back(property);
+        }
+    }
+    if (format != "binary_little_endian" && format != "binary_big_endian") {
+        throw std::runtime_error("MeshLoader: Only binary PLY files are supported, but " + filepath + " has format " + format);
+    }
+    const bool swapBytes = (format == "binary_little_endian") != (std::endian::native == std::endian::little);
+
+    // 2. Read the binary body element by element
+    const char* p = content.data() + content.find('\n', headerEnd) + 1;
+    const char* end = content.data() + content.size();
+    Geometry::Mesh::Buffers buffers;
+    for (const PlyElement& element : elements) {
+        if (element.name == "vertex") {
+            // Destination buffer and scale factor of every property, unknown properties are skipped
+            std::vector<std::pair<std::vector<float>*, double>> targets;
+            for (const PlyProperty& property : element.properties) {
+                const std::string& name = property.name;
+                std::vector<float>* target = nullptr;
+                double factor = 1.0;
+                if (name == "x" || name == "y" || name == "z") {
+                    target = name == "x" ? &buffers.x : (name == "y" ? &buffers.y : &buffers.z);
+                    factor = scale;
+                } else if (name == "nx" || name == "ny" || name == "nz") {
+                    target = name == "nx" ? &buffers.normalX : (name == "ny" ? &buffers.normalY : &buffers.normalZ);
+                } else if (name == "u" || name == "s" || name == "texture_u" || name == "texture_s") {
+                    target = &buffers.u;
+                } else if (name == "v" || name == "t" || name == "texture_v" || name == "texture_t") {
+                    target = &buffers.v;
+                }
+                if (target) {
+                    target->reserve(element.count);
+                }
+                targets.emplace_back(target, factor);
+            }
+            for (std::size_t i = 0; i < element.count; i++) {
+                for (std::size_t j = 0; j < element.properties.size(); j++) {
+                    const PlyProperty& property = element.properties[j];
+                    const std::size_t numValues = property.isList ? static_cast<std::size_t>(ReadPlyValue(p, end, property.countType, swapBytes)) : 1;
+                    for (std::size_t k = 0; k < numValues; k++) {
+                        double value = ReadPlyValue(p, end, property.type, swapBytes);
+                        if (targets[j].first && !property.isList) {
+                            targets[j].first->push_back(static_cast<float>(value * targets[j].second));
+                        }
+                    }
+                }
+            }
+        } else {
+            std::vector<std::uint32_t> polygon;
+            for (std::size_t i = 0; i < element.count; i++) {
+                for (const PlyProperty& property : element.properties) {
+                    const std::size_t numValues = property.isList ? static_cast<std::size_t>(ReadPlyValue(p, end, property.countType, swapBytes)) : 1;
+                    const bool isFace = element.name == "face" && property.isList && (property.name == "vertex_indices" || property.name == "vertex_index");
+                    polygon.clear();
+                    for (std::size_t k = 0; k < numValues; k++) {
+                        double value = ReadPlyValue(p, end, property.type, swapBytes);
+                        if (isFace) {
+                            polygon.push_back(static_cast<std::uint32_t>(value));
+                        }
+                    }
+                    for (std::size_t k = 1; k + 1 < polygon.size(); k++) {
+                        buffers.AddTriangle(polygon[0], polygon[k], polygon[k + 1]);
+                    }
+                }
+            }
+        }
+    }
+
+    // Drop incomplete optional attributes
+    if (buffers.normalX.size() != buffers.x.size() || buffers.normalY.size() != buffers.x.size() || buffers.normalZ.size() != buffers.x.size()) {
+        buffers.normalX.clear();
+        buffers.normalY.clear();
+        buffers.normalZ.clear();
+    }
+    if (buffers.u.size() != buffers.x.size() || buffers.v.size() != buffers.x.size()) {
+        buffers.u.clear();
+        buffers.v.clear();
+    }
+    return buffers;
+}
+
+std::string MeshLoader::ReadFile(const std::string& filepath) {
+    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("MeshLoader: Could not open file " + filepath);
+    }
+    std::string content(static_cast<std::size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    file.read(content.data(), content.size());
+    return content;
+}
+
+}  // namespace Raytracer
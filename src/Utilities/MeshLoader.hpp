@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Geometry/Shapes/Mesh.hpp"
+
+#include <string>
+
+namespace Raytracer {
+
+// Loads triangle meshes from Wavefront OBJ and binary PLY files straight into the shared vertex buffers of a Geometry::Mesh.
+// Polygons are triangulated as fans. Vertices are scaled by the given factor.
+class MeshLoader {
+public:
+    // Chooses the format by the file extension (.obj or .ply)
+    static Geometry::Mesh::Buffers Load(const std::string& filepath, double scale = 1.0);
+
+    // Supports positions, normals, and texture coordinates. OBJ indexes them separately, so vertices that combine them differently are duplicated.
+    static Geometry::Mesh::Buffers LoadOBJ(const std::string& filepath, double scale = 1.0);
+
+    // Supports little and big endian binary PLY files with positions (x, y, z), optional normals (nx, ny, nz), and texture coordinates (u, v or s, t)
+    static Geometry::Mesh::Buffers LoadPLY(const std::string& filepath, double scale = 1.0);
+
+private:
+    static std::string ReadFile(const std::string& filepath);
+};
+
+}  // namespace Raytracer
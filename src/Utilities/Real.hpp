@@ -0,0 +1,21 @@
+#pragma once
+
+#include <type_traits>
+
+namespace Raytracer {
+
+// Scalar type of vectors and colors, selected at build time with the CMake option SINGLE_PRECISION.
+// Single precision halves the memory of meshes, framebuffers and G-buffers, and doubles the SIMD width.
+#ifdef RAYTRACER_SINGLE_PRECISION
+using Real = float;
+#else
+using Real = double;
+#endif
+
+inline constexpr bool kSinglePrecision = std::is_same_v<Real, float>;
+
+// Geometric tolerances, e.g. ray offsets against self-intersection or orthogonality checks, are tuned for double precision.
+// In single precision they are widened by this factor to stay above the larger rounding errors of positions and directions.
+inline constexpr double kToleranceScale = kSinglePrecision ? 100.0 : 1.0;
+
+}  // namespace Raytracer
@@ -0,0 +1,46 @@
+#include "Utilities/Sampler.hpp"
+
+#include <random>
+
+namespace Raytracer {
+
+namespace {
+
+constexpr std::uint64_t kGoldenRatio = 0x9E3779B97F4A7C15ull;
+
+// SplitMix64 finalizer, a bijective mixing function with good avalanche behavior
+std::uint64_t Mix(std::uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+}  // namespace
+
+Sampler::Sampler(std::uint64_t seed) {
+    Seed(seed);
+}
+
+Sampler::Sampler(std::uint64_t globalSeed, std::size_t frame, std::size_t x, std::size_t y, std::size_t sampleIndex) {
+    // Hash all inputs into one seed, so that neighboring pixels and samples get uncorrelated streams
+    std::uint64_t hash = Mix(globalSeed);
+    for (std::uint64_t value : {static_cast<std::uint64_t>(frame), static_cast<std::uint64_t>(x), static_cast<std::uint64_t>(y), static_cast<std::uint64_t>(sampleIndex)}) {
+        hash = Mix(hash ^ (value + kGoldenRatio + (hash << 6) + (hash >> 2)));
+    }
+    Seed(hash);
+}
+
+std::uint64_t Sampler::RandomSeed() {
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) ^ static_cast<std::uint64_t>(device());
+}
+
+void Sampler::Seed(std::uint64_t seed) {
+    // The state is filled with a SplitMix64 sequence, which is never all zero
+    for (auto& state : mState) {
+        seed += kGoldenRatio;
+        state = Mix(seed);
+    }
+}
+
+}  // namespace Raytracer
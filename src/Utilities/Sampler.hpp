@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Raytracer {
+
+// Fast pseudo random number generator (xoshiro256**) meant to be owned by a single thread.
+// Each pixel sample gets its own stream derived from (global seed, frame, pixel, sample index), so renders with a fixed seed
+// are reproducible independent of the number of threads and the order in which the pixels are rendered.
+// Satisfies the UniformRandomBitGenerator requirements and can be used with the <random> distributions.
+class Sampler {
+public:
+    using result_type = std::uint64_t;
+
+    explicit Sampler(std::uint64_t seed = 0);
+    Sampler(std::uint64_t globalSeed, std::size_t frame, std::size_t x, std::size_t y, std::size_t sampleIndex);
+
+    // Uniform random number in [0, 1)
+    double Uniform() {
+        return static_cast<double>(Next() >> 11) * 0x1.0p-53;
+    }
+
+    // Uniform random number in [min, max)
+    double Uniform(double min, double max) {
+        return min + (max - min) * Uniform();
+    }
+
+    result_type operator()() {
+        return Next();
+    }
+
+    static constexpr result_type min() {
+        return 0;
+    }
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    // Non-deterministic seed for renders that do not need to be reproducible
+    static std::uint64_t RandomSeed();
+
+private:
+    std::uint64_t mState[4];
+
+    void Seed(std::uint64_t seed);
+
+    result_type Next() {
+        const std::uint64_t result = RotateLeft(mState[1] * 5, 7) * 9;
+        const std::uint64_t t = mState[1] << 17;
+        mState[2] ^= mState[0];
+        mState[3] ^= mState[1];
+        mState[1] ^= mState[2];
+        mState[0] ^= mState[3];
+        mState[2] ^= t;
+        mState[3] = RotateLeft(mState[3], 45);
+        return result;
+    }
+
+    static std::uint64_t RotateLeft(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+};
+
+}  // namespace Raytracer
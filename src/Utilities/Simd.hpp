@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+
+// Register-sized storage for the small fixed-size types (vectors and colors). With GCC it is a vector extension type, whose element-wise
+// arithmetic and shuffles compile to SSE, AVX or NEON instructions of the target. Otherwise it is a plain array. Clang is excluded, since
+// it neither binds references to vector elements nor takes their address, which operator[] and begin() of Vector rely on.
+namespace Raytracer::Simd {
+
+#if defined(__GNUC__) && !defined(__clang__)
+inline constexpr bool kVectorExtensions = true;
+#else
+inline constexpr bool kVectorExtensions = false;
+#endif
+
+// Width of the widest vector registers of the target. Storage that does not fit into one register is split by the compiler into several
+// operations with shuffles in between, which is slower than scalar code, e.g. four doubles without AVX.
+#if defined(__AVX__)
+inline constexpr std::size_t kRegisterBytes = 32;
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+inline constexpr std::size_t kRegisterBytes = 16;
+#else
+inline constexpr std::size_t kRegisterBytes = 0;
+#endif
+
+// Three components are padded to four lanes, so that they fill a whole register without a scalar remainder
+constexpr std::size_t PaddedLanes(std::size_t components) {
+    return (components == 3) ? 4 : components;
+}
+
+// Vector extensions only exist for power of two sizes
+template <typename T, std::size_t Components>
+inline constexpr bool kVectorized = kVectorExtensions && std::has_single_bit(PaddedLanes(Components) * sizeof(T)) && PaddedLanes(Components) * sizeof(T) >= 8 && PaddedLanes(Components) * sizeof(T) <= kRegisterBytes;
+
+// Scalar storage is not padded, so that e.g. meshes do not grow without any gain
+template <typename T, std::size_t Components>
+inline constexpr std::size_t kLanes = kVectorized<T, Components> ? PaddedLanes(Components) : Components;
+
+namespace Detail {
+template <typename T, std::size_t Lanes, bool Vectorized>
+struct Storage {
+    using Type = std::array<T, Lanes>;
+};
+
+#if defined(__GNUC__) && !defined(__clang__)
+// The alignment is capped at 16 bytes, so that a padded double vector does not force 32 byte alignment on every struct that holds one
+template <typename T, std::size_t Lanes>
+struct Storage<T, Lanes, true> {
+    using Type [[gnu::vector_size(Lanes * sizeof(T)), gnu::aligned(Lanes * sizeof(T) < 16 ? Lanes * sizeof(T) : 16)]] = T;
+};
+#endif
+}  // namespace Detail
+
+template <typename T, std::size_t Components>
+using Storage = typename Detail::Storage<T, kLanes<T, Components>, kVectorized<T, Components>>::Type;
+
+// Element-wise operations on the storage. The padding lanes stay zero.
+template <typename T, std::size_t Components>
+void AddAssign(Storage<T, Components>& lhs, const Storage<T, Components>& rhs) {
+    if constexpr (kVectorized<T, Components>) {
+        lhs += rhs;
+    } else {
+        for (std::size_t i = 0; i < Components; ++i) {
+            lhs[i] += rhs[i];
+        }
+    }
+}
+
+template <typename T, std::size_t Components>
+void SubtractAssign(Storage<T, Components>& lhs, const Storage<T, Components>& rhs) {
+    if constexpr (kVectorized<T, Components>) {
+        lhs -= rhs;
+    } else {
+        for (std::size_t i = 0; i < Components; ++i) {
+            lhs[i] -= rhs[i];
+        }
+    }
+}
+
+template <typename T, std::size_t Components>
+void MultiplyAssign(Storage<T, Components>& lhs, const Storage<T, Components>& rhs) {
+    if constexpr (kVectorized<T, Components>) {
+        lhs *= rhs;
+    } else {
+        for (std::size_t i = 0; i < Components; ++i) {
+            lhs[i] *= rhs[i];
+        }
+    }
+}
+
+template <typename T, std::size_t Components>
+void MultiplyAssign(Storage<T, Components>& lhs, T scalar) {
+    if constexpr (kVectorized<T, Components>) {
+        lhs *= scalar;
+    } else {
+        for (std::size_t i = 0; i < Components; ++i) {
+            lhs[i] *= scalar;
+        }
+    }
+}
+
+template <typename T, std::size_t Components>
+void DivideAssign(Storage<T, Components>& lhs, T scalar) {
+    if constexpr (kVectorized<T, Components>) {
+        lhs /= scalar;
+        for (std::size_t i = Components; i < kLanes<T, Components>; ++i) {
+            lhs[i] = T{};  // 0 / 0 would leave a NaN in the padding
+        }
+    } else {
+        for (std::size_t i = 0; i < Components; ++i) {
+            lhs[i] /= scalar;
+        }
+    }
+}
+
+// Sum of the element-wise products, added in component order so that the result is the same as with scalar code
+template <typename T, std::size_t Components>
+T Dot(const Storage<T, Components>& lhs, const Storage<T, Components>& rhs) {
+    T result{};
+    if constexpr (kVectorized<T, Components>) {
+        const Storage<T, Components> products = lhs * rhs;
+        for (std::size_t i = 0; i < Components; ++i) {
+            result += products[i];
+        }
+    } else {
+        for (std::size_t i = 0; i < Components; ++i) {
+            result += lhs[i] * rhs[i];
+        }
+    }
+    return result;
+}
+
+}  // namespace Raytracer::Simd
@@ -1,11 +1,10 @@
 #include "Utilities/Video.hpp"
 
-#include "Utilities/Configuration.hpp"
-#include "Version.hpp"
+#include "Utilities/ImageSequenceWriter.hpp"
 
-#include <filesystem>
-#include <format>
+#include <chrono>
 #include <iostream>
+#include <stdexcept>
 #include <thread>
 
 namespace Raytracer {
@@ -21,6 +20,12 @@ Video::Video(const std::vector<Image>& images, double fps) :
     }
 }
 
+Video::Video(double fps, std::size_t maximumWidth, std::size_t maximumFrames) :
+    mFPS(fps),
+    mMaximumWidth(maximumWidth),
+    mMaximumFrames(maximumFrames) {
+}
+
 double Video::GetDuration() const {
     return mFrames.size() / mFPS;
 }
@@ -33,67 +38,52 @@ double Video::GetFrameRate() const {
 }
 
 void Video::AddFrame(const Image& image) {
-    if (mFrames.empty()) {
-        mWidth = image.GetWidth();
-        mHeight = image.GetHeight();
-    } else if (image.GetWidth() != mWidth || image.GetHeight() != mHeight) {
-        throw std::invalid_argument("Frame dimensions do not match video dimensions.");
+    if (mNumberOfAddedFrames++ % mFrameStride != 0) {
+        return;
     }
-    mFrames.push_back(image);
-}
-
-void Video::Save(bool openFile, bool showTerminalOutput, bool deleteFrameFiles, std::string filepath) {
+    Image frame = (mMaximumWidth > 0) ? image.Downsampled(mMaximumWidth) : image;
     if (mFrames.empty()) {
-        std::cerr << "No frames to save." << std::endl;
-        return;
+        mWidth = frame.GetWidth();
+        mHeight = frame.GetHeight();
+    } else if (frame.GetWidth() != mWidth || frame.GetHeight() != mHeight) {
+        throw std::invalid_argument("Frame dimensions do not match video dimensions.");
     }
+    mFrames.push_back(std::move(frame));
 
-    if (filepath.empty()) {
-        std::string outputDirectory = Configuration::GetInstance().GetOutputDirectory();
-        std::filesystem::create_directories(outputDirectory + "/videos/");
-        filepath = outputDirectory + "/videos/video_" + Configuration::GetInstance().GetRunID() + ".mp4";
+    if (mMaximumFrames > 0 && mFrames.size() > mMaximumFrames) {
+        // Keep every second frame
+        for (std::size_t i = 0; 2 * i < mFrames.size(); i++) {
+            mFrames[i] = std::move(mFrames[2 * i]);
+        }
+        mFrames.resize((mFrames.size() + 1) / 2);
+        mFrameStride *= 2;
+        mFPS /= 2.0;
     }
+}
 
-    std::filesystem::path outputFilepath = filepath;
-    std::filesystem::path outputDirectory = outputFilepath.parent_path();
+bool Video::Close(bool openFile) {
+    return true;
+}
 
-    // Create a temp subfolder for the frames
-    std::filesystem::path tempFramesDir = outputDirectory / ("video_tmp_" + Configuration::GetInstance().GetRunID());
-    std::filesystem::create_directories(tempFramesDir);
+bool Video::CanResumeAfter(std::size_t numberOfFrames) const {
+    return mMaximumWidth > 0 || mMaximumFrames > 0;
+}
 
-    for (std::size_t i = 0; i < mFrames.size(); i++) {
-        const std::string frameFilename = std::format("frame_{:04}.png", static_cast<int>(i + 1));
-        mFrames[i].Save(false, (tempFramesDir / frameFilename).string());
-    }
+std::size_t Video::GetNumberOfFrames() const {
+    return mFrames.size();
+}
 
-    // ffmpeg command
-    const std::string ffmpegExe = std::format("\"{}\"", FFMPEG_PATH);
-    const std::string verbosity = showTerminalOutput ? "" : "-v warning";
-    const std::string inputPattern = std::format("\"{}/frame_%04d.png\"", tempFramesDir.string());
-    const std::string outputFile = std::format("\"{}\"", filepath);
-    std::string ffmpegCommand = std::format(
-        "{} -y {} -framerate {} -i {} -c:v libx264 -pix_fmt yuv420p {}",
-        ffmpegExe, verbosity, mFPS, inputPattern, outputFile);
-
-    std::system(ffmpegCommand.c_str());
-
-    // Clean up temp folder if requested
-    if (deleteFrameFiles) {
-        std::error_code ec;
-        std::filesystem::remove_all(tempFramesDir, ec);
+void Video::Save(bool openFile, bool showTerminalOutput, bool deleteFrameFiles, std::string filepath) {
+    if (mFrames.empty()) {
+        std::cerr << "No frames to save." << std::endl;
+        return;
     }
 
-    if (openFile) {
-        std::string command;
-#ifdef __APPLE__
-        command = "open " + filepath;
-#elif __linux__
-        command = "xdg-open " + filepath;
-#elif _WIN32
-        command = "start " + filepath;
-#endif
-        std::system(command.c_str());
+    ImageSequenceWriter writer(mFPS, filepath, showTerminalOutput, deleteFrameFiles);
+    for (const auto& frame : mFrames) {
+        writer.AddFrame(frame);
     }
+    writer.Close(openFile);
 }
 
 void Video::PlayInTerminal(std::size_t width, bool loop, double terminalCharAspectRatio) const {
@@ -1,22 +1,36 @@
 #pragma once
 
-#include "Image.hpp"
+#include "Utilities/FrameSink.hpp"
+#include "Utilities/Image.hpp"
 
 #include <string>
+#include <vector>
 
 namespace Raytracer {
 
-class Video {
+// Frames in memory, e.g. for tests or to play a video in the terminal
+class Video : public FrameSink {
 public:
     Video(double fps = 30.0);
     Video(const std::vector<Image>& images, double fps = 30.0);
 
+    // Preview with bounded memory: frames are downsampled to the maximum width, and once there are more than the maximum number of
+    // frames, every second frame is dropped and the frame rate is halved. Zero means no limit.
+    Video(double fps, std::size_t maximumWidth, std::size_t maximumFrames);
+
     double GetDuration() const;  // in seconds
 
     void SetFrameRate(double fps);
     double GetFrameRate() const;
 
-    void AddFrame(const Image& image);
+    void AddFrame(const Image& image) override;
+    bool Close(bool openFile = false) override;
+
+    // A preview only shows the frames rendered after resuming, while a full video would lack the earlier frames
+    bool CanResumeAfter(std::size_t numberOfFrames) const override;
+
+    std::size_t GetNumberOfFrames() const;
+
     void Save(bool openFile = false, bool showTerminalOutput = false, bool deleteFrameFiles = true, std::string filepath = "");
 
     void PlayInTerminal(std::size_t width, bool loop = false, double terminalCharAspectRatio = 18.0 / 7.0) const;
@@ -28,6 +42,11 @@ private:
     size_t mHeight = 0;
     double mFPS = 30.0;
     std::vector<Image> mFrames;
+
+    std::size_t mMaximumWidth = 0;
+    std::size_t mMaximumFrames = 0;
+    std::size_t mFrameStride = 1;  // Only every n-th added frame is kept
+    std::size_t mNumberOfAddedFrames = 0;
 };
 
 }  // namespace Raytracer
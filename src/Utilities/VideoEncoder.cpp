@@ -0,0 +1,140 @@
+#include "Utilities/VideoEncoder.hpp"
+
+#include "Utilities/Configuration.hpp"
+#include "Version.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <csignal>
+#include <ctime>
+#include <pthread.h>
+#endif
+
+namespace Raytracer {
+
+namespace {
+
+// Writes and flushes the buffer. If ffmpeg has exited, e.g. because it is missing or rejects the video settings, the write would raise
+// SIGPIPE and kill the process. The signal is blocked on this thread during the write and discarded, so the failure is returned instead.
+bool WriteToPipe(std::FILE* pipe, const std::vector<std::uint8_t>& buffer) {
+#ifdef _WIN32
+    return std::fwrite(buffer.data(), 1, buffer.size(), pipe) == buffer.size() && std::fflush(pipe) == 0;
+#else
+    sigset_t pipeSignal;
+    sigemptyset(&pipeSignal);
+    sigaddset(&pipeSignal, SIGPIPE);
+    sigset_t pending;
+    sigpending(&pending);
+    const bool wasPending = sigismember(&pending, SIGPIPE) == 1;
+    sigset_t previousMask;
+    pthread_sigmask(SIG_BLOCK, &pipeSignal, &previousMask);
+
+    const bool written = std::fwrite(buffer.data(), 1, buffer.size(), pipe) == buffer.size() && std::fflush(pipe) == 0;
+    if (!written && !wasPending) {
+        const timespec noWait{0, 0};
+        sigtimedwait(&pipeSignal, nullptr, &noWait);
+    }
+    pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+    return written;
+#endif
+}
+
+}  // namespace
+
+VideoEncoder::VideoEncoder(std::size_t width, std::size_t height, double fps, std::string filepath, bool showTerminalOutput) :
+    mWidth(width),
+    mHeight(height),
+    mFilepath(std::move(filepath)) {
+    if (mWidth == 0 || mHeight == 0) {
+        throw std::invalid_argument("Video dimensions must be positive.");
+    }
+
+    if (mFilepath.empty()) {
+        std::string outputDirectory = Configuration::GetInstance().GetOutputDirectory();
+        std::filesystem::create_directories(outputDirectory + "/videos/");
+        mFilepath = outputDirectory + "/videos/video_" + Configuration::GetInstance().GetRunID() + ".mp4";
+    } else if (std::filesystem::path(mFilepath).has_parent_path()) {
+        std::filesystem::create_directories(std::filesystem::path(mFilepath).parent_path());
+    }
+
+    const std::string command = CreateCommand(mWidth, mHeight, fps, mFilepath, showTerminalOutput);
+    mPipe = popen(command.c_str(), "w");
+    if (mPipe == nullptr) {
+        throw std::runtime_error("Could not start ffmpeg: " + command);
+    }
+    mBuffer.resize(mWidth * mHeight * 3);
+}
+
+VideoEncoder::~VideoEncoder() {
+    if (mPipe != nullptr) {
+        pclose(mPipe);
+    }
+}
+
+void VideoEncoder::AddFrame(const Image& image) {
+    if (image.GetWidth() != mWidth || image.GetHeight() != mHeight) {
+        throw std::invalid_argument("Frame dimensions do not match video dimensions.");
+    }
+    if (mPipe == nullptr) {
+        throw std::runtime_error("Cannot add a frame to a closed video encoder.");
+    }
+
+    std::size_t idx = 0;
+    for (std::size_t y = 0; y < mHeight; y++) {
+        for (std::size_t x = 0; x < mWidth; x++) {
+            for (int channel : image.GetPixel(x, y).GetRGB255()) {
+                mBuffer[idx++] = static_cast<std::uint8_t>(std::clamp(channel, 0, 255));
+            }
+        }
+    }
+
+    if (!WriteToPipe(mPipe, mBuffer)) {
+        throw std::runtime_error("Could not write frame to ffmpeg, e.g. because it is missing or failed to start.");
+    }
+    mNumberOfFrames++;
+}
+
+bool VideoEncoder::Close(bool openFile) {
+    if (mPipe == nullptr) {
+        return false;
+    }
+    const int status = pclose(mPipe);
+    mPipe = nullptr;
+
+    if (openFile && status == 0) {
+        std::string command;
+#ifdef __APPLE__
+        command = "open " + mFilepath;
+#elif __linux__
+        command = "xdg-open " + mFilepath;
+#elif _WIN32
+        command = "start " + mFilepath;
+#endif
+        std::system(command.c_str());
+    }
+    return status == 0;
+}
+
+std::size_t VideoEncoder::GetNumberOfFrames() const {
+    return mNumberOfFrames;
+}
+
+const std::string& VideoEncoder::GetFilepath() const {
+    return mFilepath;
+}
+
+std::string VideoEncoder::CreateCommand(std::size_t width, std::size_t height, double fps, const std::string& filepath, bool showTerminalOutput) {
+    const std::string ffmpegExe = std::format("\"{}\"", FFMPEG_PATH);
+    const std::string verbosity = showTerminalOutput ? "" : "-v warning";
+    const std::string outputFile = std::format("\"{}\"", filepath);
+    return std::format(
+        "{} -y {} -f rawvideo -pix_fmt rgb24 -s {}x{} -framerate {} -i - -c:v libx264 -pix_fmt yuv420p {}",
+        ffmpegExe, verbosity, width, height, fps, outputFile);
+}
+
+}  // namespace Raytracer
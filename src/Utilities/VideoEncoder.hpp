@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Utilities/FrameSink.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace Raytracer {
+
+// Streams frames into an ffmpeg process as they are rendered. The frames go through a pipe as raw RGB24, so they are neither compressed
+// to PNG nor written to disk, and ffmpeg encodes them while the next frame renders.
+class VideoEncoder : public FrameSink {
+public:
+    // An empty filepath writes to the videos folder of the output directory
+    VideoEncoder(std::size_t width, std::size_t height, double fps, std::string filepath = "", bool showTerminalOutput = false);
+    ~VideoEncoder() override;
+
+    VideoEncoder(const VideoEncoder&) = delete;
+    VideoEncoder& operator=(const VideoEncoder&) = delete;
+
+    void AddFrame(const Image& image) override;
+
+    // Waits for ffmpeg to finish the file. Returns false if ffmpeg failed.
+    bool Close(bool openFile = false) override;
+
+    std::size_t GetNumberOfFrames() const;
+    const std::string& GetFilepath() const;
+
+    static std::string CreateCommand(std::size_t width, std::size_t height, double fps, const std::string& filepath, bool showTerminalOutput = false);
+
+private:
+    std::size_t mWidth;
+    std::size_t mHeight;
+    std::string mFilepath;
+    std::FILE* mPipe = nullptr;
+    std::size_t mNumberOfFrames = 0;
+    std::vector<std::uint8_t> mBuffer;  // RGB24 of one frame
+};
+
+}  // namespace Raytracer
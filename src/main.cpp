@@ -3,20 +3,43 @@
 #include <cmath>
 #include <cstdlib>
 #include <cstring>  // for strlen
+#include <filesystem>
 #include <iostream>
 #include <memory>
+#include <string>
 
 #include "Geometry/Vector.hpp"
 #include "Rendering/Camera.hpp"
+#include "Rendering/RenderCheckpoint.hpp"
+#include "Rendering/RenderStatistics.hpp"
 #include "Rendering/Ray.hpp"
 #include "Scene/Scene.hpp"
 #include "Utilities/Color.hpp"
 #include "Utilities/Configuration.hpp"
 #include "Utilities/Image.hpp"
+#include "Utilities/ImageSequenceWriter.hpp"
+#include "Utilities/Video.hpp"
+#include "Utilities/VideoEncoder.hpp"
 #include "Version.hpp"
 
 using namespace Raytracer;
 
+// Parses "i/N" into the shard index i and the number of shards N. Returns false if the shard does not exist, or if there is only one shard,
+// which would be a render without a merge.
+bool ParseShard(const std::string& text, std::size_t& index, std::size_t& count) {
+    const std::size_t slash = text.find('/');
+    if (slash == std::string::npos) {
+        return false;
+    }
+    try {
+        index = std::stoul(text.substr(0, slash));
+        count = std::stoul(text.substr(slash + 1));
+    } catch (const std::exception&) {
+        return false;
+    }
+    return count > 1 && index < count;
+}
+
 int main(int argc, char** argv) {
     //Initial terminal output
     auto time_start = std::chrono::system_clock::now();
@@ -29,14 +52,26 @@ int main(int argc, char** argv) {
     std::cout << PROJECT_NAME << "-" << PROJECT_VERSION << "\tgit:" << GIT_BRANCH << "/" << GIT_COMMIT_HASH << std::endl
               << std::endl;
     ////////////////////////////////////////////////////////////////////////
-    if (argc < 2) {
-        std::cerr << "Usage: " << argv[0] << " <config.yaml>\n";
+    // Resuming continues an interrupted run from its checkpoints, with the same configuration and the same run ID.
+    // The shards of a distributed run share its run ID, so that the merge finds their samples in the output directory.
+    const bool merge = argc == 4 && std::strcmp(argv[1], "merge") == 0;
+    const bool resume = argc == 4 && std::strcmp(argv[2], "--resume") == 0;
+    std::size_t shardIndex = 0;
+    std::size_t shardCount = 1;
+    const bool shard = argc == 5 && std::strcmp(argv[2], "--shard") == 0 && ParseShard(argv[3], shardIndex, shardCount);
+    if (argc == 5 && std::strcmp(argv[2], "--shard") == 0 && !shard) {
+        std::cerr << "Error: Invalid shard " << argv[3] << ", expected i/N with at least N = 2 shards and 0 <= i < N." << std::endl;
+    }
+    if (argc != 2 && !merge && !resume && !shard) {
+        std::cerr << "Usage: " << argv[0] << " <config.yaml> [--resume <run-id> | --shard <i>/<N> <run-id>]\n"
+                  << "       " << argv[0] << " merge <config.yaml> <run-id>\n";
         return 1;
-    } else {
-        std::cout << "Using configuration file: " << argv[1] << std::endl;
     }
+    const std::string configFilepath = merge ? argv[2] : argv[1];
+    const std::string givenRunID = (argc == 2) ? "" : argv[argc - 1];
+    std::cout << "Using configuration file: " << configFilepath << std::endl;
     try {
-        Configuration::GetInstance().ParseYamlFile(argv[1]);
+        Configuration::GetInstance().ParseYamlFile(configFilepath, givenRunID);
     } catch (const std::exception& e) {
         std::cerr << "Error parsing configuration file: " << e.what() << std::endl;
         return 1;
@@ -50,29 +85,81 @@ int main(int argc, char** argv) {
 
     Camera camera = Configuration::GetInstance().ConstructCamera();
     Scene scene = Configuration::GetInstance().ConstructScene();
+    // A shard that is started again continues where it was interrupted
+    camera.SetResume(resume || shard);
+    if (shard) {
+        camera.SetShard(shardIndex, shardCount);
+    }
 
     Configuration::GetInstance().PrintInfo();
     camera.PrintInfo();
     scene.PrintInfo();
 
-    if (renderConfig.renderImage) {
-        std::cout << "\nRendering image..." << std::endl;
+    const std::string outputDirectory = Configuration::GetInstance().GetOutputDirectory();
+    const std::string runID = Configuration::GetInstance().GetRunID();
+    if (renderConfig.renderImage && shard) {
+        std::cout << "\nRendering shard " << shardIndex << "/" << shardCount << " of the image..." << std::endl;
+        bool printProgressBar = true;
+        camera.RenderImage(scene, printProgressBar);
+    } else if (renderConfig.renderImage && resume && std::filesystem::exists(outputDirectory + "/images/image_" + runID + ".png")) {
+        std::cout << "\nImage of run " << runID << " is already finished." << std::endl;
+    } else if (renderConfig.renderImage) {
+        std::cout << (merge ? "\nMerging the shards of the image..." : "\nRendering image...") << std::endl;
         bool printProgressBar = true;
         bool renderImageConvergingVideo = false;
-        Image image = camera.RenderImage(scene, printProgressBar, renderImageConvergingVideo);
+        RenderStatistics::Reset();
+        Image image = merge ? camera.MergeImageShards(scene) : camera.RenderImage(scene, printProgressBar, renderImageConvergingVideo);
         image.PrintInfo();
+        auto encodeStartTime = std::chrono::system_clock::now();
         image.Save(renderConfig.openOutputFiles);
+        // The image is complete, so the run does not need to be resumed anymore
+        std::filesystem::remove(RenderCheckpoint::DefaultFilepath("image"));
+        RenderStatistics::AddTime(RenderStatistics::Stage::ENCODE, std::chrono::duration<double>(std::chrono::system_clock::now() - encodeStartTime).count());
+        RenderStatistics::PrintInfo();
+        RenderStatistics::Save();
         image.PrintToTerminal(60);
     }
 
-    if (renderConfig.renderVideo) {
-        std::cout << "\nRendering video..." << std::endl;
+    // An interrupted video can leave an incomplete file behind, but then its checkpoint is still there
+    bool videoEncoded = true;
+    if (renderConfig.renderVideo && shard) {
+        std::cout << "\nRendering shard " << shardIndex << "/" << shardCount << " of the video..." << std::endl;
+        bool printProgressBar = true;
+        camera.RenderVideo(scene, renderConfig.videoDuration, {}, printProgressBar);
+    } else if (renderConfig.renderVideo && resume && std::filesystem::exists(outputDirectory + "/videos/video_" + runID + ".mp4") && !std::filesystem::exists(RenderCheckpoint::DefaultFilepath("video"))) {
+        std::cout << "\nVideo of run " << runID << " is already finished." << std::endl;
+    } else if (renderConfig.renderVideo) {
+        std::cout << (merge ? "\nMerging the shards of the video..." : "\nRendering video...") << std::endl;
         bool printProgressBar = true;
         // camera.InitializeOrbitTrajectory(2 * M_PI / renderConfig.videoDuration);
-        Video video = camera.RenderVideo(scene, renderConfig.videoDuration, printProgressBar);
-        video.PrintInfo();
-        video.Save(renderConfig.openOutputFiles);
-        video.PlayInTerminal(60);
+        RenderStatistics::Reset();
+        // Frames go to disk as they are rendered, only a small preview stays in memory for the terminal
+        std::unique_ptr<FrameSink> output = nullptr;
+        if (renderConfig.streamVideo) {
+            const auto resolution = camera.GetResolution();
+            output = std::make_unique<VideoEncoder>(resolution.width, resolution.height, camera.GetFramesPerSecond());
+        } else {
+            output = std::make_unique<ImageSequenceWriter>(camera.GetFramesPerSecond());
+        }
+        const std::size_t terminalWidth = 60;
+        const std::size_t maximumPreviewFrames = 256;
+        Video preview(camera.GetFramesPerSecond(), terminalWidth, maximumPreviewFrames);
+        if (merge) {
+            camera.MergeVideoShards(scene, renderConfig.videoDuration, {output.get(), &preview}, printProgressBar);
+        } else {
+            camera.RenderVideo(scene, renderConfig.videoDuration, {output.get(), &preview}, printProgressBar);
+        }
+        auto encodeStartTime = std::chrono::system_clock::now();
+        if (output->Close(renderConfig.openOutputFiles)) {
+            std::filesystem::remove(RenderCheckpoint::DefaultFilepath("video"));
+        } else {
+            std::cerr << "Error: ffmpeg failed to encode the video." << std::endl;
+            videoEncoded = false;
+        }
+        RenderStatistics::AddTime(RenderStatistics::Stage::ENCODE, std::chrono::duration<double>(std::chrono::system_clock::now() - encodeStartTime).count());
+        RenderStatistics::PrintInfo();
+        RenderStatistics::Save(outputDirectory + "/videos/statistics_" + runID + ".json");
+        preview.PlayInTerminal(terminalWidth);
     }
 
     ////////////////////////////////////////////////////////////////////////
@@ -86,5 +173,6 @@ int main(int argc, char** argv) {
         std::cout << "]" << std::endl;
     }
 
-    return 0;
+    // A failed encode must not look like success to scripts and shard drivers
+    return videoEncoded ? 0 : 1;
 }
@@ -2,6 +2,8 @@
 
 #include "Geometry/Shapes/Box.hpp"
 
+#include <random>
+
 using namespace Raytracer;
 
 TEST(TestBox, Test1) {
@@ -9,3 +11,27 @@ TEST(TestBox, Test1) {
     // ACT
     // ASSERT
 }
+
+TEST(TestBox, SlabTestAgreesWithFaces) {
+    // ARRANGE
+    Geometry::Box box(Vector3D({0.3, -1.2, 2.5}), Vector3D({1.0, 2.0, 3.0}).Normalized(), Vector3D({3.0, 0.0, -1.0}).Normalized(), 1.0, 2.0, 3.0);
+    std::mt19937 prng(11);
+    std::uniform_real_distribution<Real> distribution(-1.0, 1.0);
+    for (int i = 0; i < 2000; i++) {
+        Vector3D origin = box.GetPosition() + 5.0 * Vector3D({distribution(prng), distribution(prng), distribution(prng)});
+        Vector3D target = box.GetPosition() + 1.5 * Vector3D({distribution(prng), distribution(prng), distribution(prng)});
+        Geometry::Line line(origin, (target - origin).Normalized(), 0.0);
+
+        // ACT
+        auto slabHit = box.FindHit(line);
+        auto faceHit = box.CompositeShape::FindHit(line);
+
+        // ASSERT
+        ASSERT_EQ(slabHit.has_value(), faceHit.has_value());
+        if (slabHit.has_value()) {
+            EXPECT_NEAR(slabHit->t, faceHit->t, kSinglePrecision ? 1e-5 : 1e-9);
+            auto intersection = box.ComputeSurfaceInteraction(line, *slabHit);
+            EXPECT_NEAR((intersection.normal - box.ComputeSurfaceInteraction(line, *faceHit).normal).Norm(), 0.0, 1e-9);
+        }
+    }
+}
@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+
+#include "Geometry/Shapes/Mesh.hpp"
+#include "Geometry/Shapes/Triangle.hpp"
+
+#include <cmath>
+#include <random>
+
+using namespace Raytracer;
+using namespace Raytracer::Geometry;
+
+namespace {
+
+// Unit square in the xy plane, made of two triangles with texture coordinates
+Mesh::Buffers CreateSquare() {
+    Mesh::Buffers buffers;
+    buffers.AddVertex(Vector3D({0.0, 0.0, 0.0}));
+    buffers.AddVertex(Vector3D({1.0, 0.0, 0.0}));
+    buffers.AddVertex(Vector3D({1.0, 1.0, 0.0}));
+    buffers.AddVertex(Vector3D({0.0, 1.0, 0.0}));
+    buffers.u = {0.0f, 1.0f, 1.0f, 0.0f};
+    buffers.v = {0.0f, 0.0f, 1.0f, 1.0f};
+    buffers.AddTriangle(0, 1, 2);
+    buffers.AddTriangle(0, 2, 3);
+    return buffers;
+}
+
+}  // namespace
+
+TEST(TestMesh, Intersect) {
+    // ARRANGE
+    Mesh mesh(CreateSquare());
+    Line hit(Vector3D({0.25, 0.75, 2.0}), Vector3D({0.0, 0.0, -1.0}), 0.0);
+    Line miss(Vector3D({1.5, 0.5, 2.0}), Vector3D({0.0, 0.0, -1.0}), 0.0);
+
+    // ACT
+    auto intersection = mesh.Intersect(hit);
+
+    // ASSERT
+    ASSERT_TRUE(intersection.has_value());
+    EXPECT_NEAR(intersection->t, 2.0, 1e-12);
+    EXPECT_NEAR(intersection->point[0], 0.25, 1e-12);
+    EXPECT_NEAR(intersection->point[1], 0.75, 1e-12);
+    EXPECT_NEAR(std::fabs(intersection->normal[2]), 1.0, 1e-12);
+    EXPECT_FALSE(mesh.Intersect(miss).has_value());
+    EXPECT_EQ(mesh.NumberOfVertices(), 4);
+    EXPECT_EQ(mesh.NumberOfTriangles(), 2);
+}
+
+TEST(TestMesh, AgreesWithTriangle) {
+    // ARRANGE
+    Vector3D v1({-1.0, 0.5, 2.0});
+    Vector3D v2({2.0, -1.0, 1.0});
+    Vector3D v3({0.5, 2.0, -1.0});
+    Triangle triangle(v1, v2, v3);
+    Mesh::Buffers buffers;
+    buffers.AddVertex(v1);
+    buffers.AddVertex(v2);
+    buffers.AddVertex(v3);
+    buffers.AddTriangle(0, 1, 2);
+    Mesh mesh(std::move(buffers));
+
+    std::mt19937 prng(7);
+    std::uniform_real_distribution<Real> distribution(-3.0, 3.0);
+    for (int i = 0; i < 1000; i++) {
+        Vector3D origin({distribution(prng), distribution(prng), static_cast<Real>(distribution(prng) + 6.0)});
+        Vector3D target({static_cast<Real>(0.3 * distribution(prng)), static_cast<Real>(0.3 * distribution(prng)), static_cast<Real>(0.3 * distribution(prng))});
+        Line line(origin, (target - origin).Normalized(), 0.0);
+
+        // ACT
+        auto expected = triangle.Intersect(line);
+        auto result = mesh.Intersect(line);
+
+        // ASSERT
+        ASSERT_EQ(expected.has_value(), result.has_value());
+        if (expected) {
+            EXPECT_NEAR(expected->t, result->t, 1e-5);
+            EXPECT_NEAR(std::fabs(expected->normal.Dot(result->normal)), 1.0, 1e-6);
+        }
+        EXPECT_EQ(mesh.Occluded(line, 0.0, 100.0), expected.has_value());
+    }
+}
+
+TEST(TestMesh, MovedMesh) {
+    // ARRANGE
+    Mesh mesh(CreateSquare(), Vector3D({5.0, 0.0, 0.0}), Vector3D({1.0, 0.0, 0.0}), Vector3D({0.0, 1.0, 0.0}));
+    Line line(Vector3D({10.0, 0.5, 0.5}), Vector3D({-1.0, 0.0, 0.0}), 0.0);
+
+    // ACT
+    auto intersection = mesh.Intersect(line);
+    mesh.SetPosition(Vector3D({3.0, 0.0, 0.0}));
+    auto movedIntersection = mesh.Intersect(line);
+
+    // ASSERT
+    ASSERT_TRUE(intersection.has_value());
+    EXPECT_NEAR(intersection->t, 5.0, 1e-12);
+    ASSERT_TRUE(movedIntersection.has_value());
+    EXPECT_NEAR(movedIntersection->t, 7.0, 1e-12);
+    EXPECT_NEAR(mesh.GetBoundingBox().GetMinimum()[0], 3.0, 1e-12);
+    EXPECT_FALSE(mesh.Occluded(line, 0.0, 6.0));
+    EXPECT_TRUE(mesh.Occluded(line, 0.0, 8.0));
+}
+
+TEST(TestMesh, SurfaceAreaAndSampling) {
+    // ARRANGE
+    Mesh mesh(CreateSquare());
+    Sampler sampler(3);
+
+    // ACT
+    auto points = mesh.SampleSurfacePoints(100, sampler);
+
+    // ASSERT
+    EXPECT_NEAR(mesh.SurfaceArea(), 1.0, 1e-12);
+    ASSERT_EQ(points.size(), 100);
+    for (const auto& point : points) {
+        EXPECT_TRUE(mesh.GetBoundingBox().Contains(point));
+    }
+    EXPECT_EQ(mesh.GetKeyPoints().size(), 4);
+}
+
+TEST(TestMesh, SurfaceParameters) {
+    // ARRANGE
+    Mesh mesh(CreateSquare());
+
+    // ACT
+    auto parameters = mesh.GetSurfaceParameters(Vector3D({0.25, 0.75, 0.0}));
+
+    // ASSERT
+    EXPECT_NEAR(parameters.first, -0.25, 1e-6);
+    EXPECT_NEAR(parameters.second, 0.25, 1e-6);
+}
+
+TEST(TestMesh, InvalidBuffers) {
+    // ARRANGE
+    Mesh::Buffers outOfRange = CreateSquare();
+    outOfRange.AddTriangle(0, 1, 4);
+    Mesh::Buffers missingNormals = CreateSquare();
+    missingNormals.normalX = {0.0f};
+
+    // ACT & ASSERT
+    EXPECT_THROW(Mesh{outOfRange}, std::invalid_argument);
+    EXPECT_THROW(Mesh{missingNormals}, std::invalid_argument);
+    EXPECT_THROW(Mesh{Mesh::Buffers()}, std::invalid_argument);
+}
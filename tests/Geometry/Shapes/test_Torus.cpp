@@ -2,6 +2,9 @@
 
 #include "Geometry/Shapes/Torus.hpp"
 
+#include <cmath>
+#include <random>
+
 using namespace Raytracer;
 
 TEST(TestTorus, Test1)
@@ -10,3 +13,42 @@ TEST(TestTorus, Test1)
     // ACT
     // ASSERT
 }
+
+TEST(TestTorus, IntersectionLiesOnSurface) {
+    // ARRANGE
+    const double R = 2.0, r = 0.5;
+    Geometry::Torus torus(Vector3D({1.0, -1.0, 0.5}), Vector3D({0.3, 0.2, 1.0}).Normalized(), R, r);
+    std::mt19937 prng(3);
+    std::uniform_real_distribution<Real> distribution(-3.0, 3.0);
+    std::size_t hits = 0;
+    auto distanceFromMajorCircle = [&](const Vector3D& point) {
+        Vector3D local = point - torus.GetPosition();
+        double height = local.Dot(torus.GetOrientation());
+        double radial = std::sqrt(std::max(0.0, local.Dot(local) - height * height));
+        return std::hypot(radial - R, height);
+    };
+
+    // Single precision cannot resolve the distance from the surface as finely, e.g. along grazing lines
+    const double tolerance = kSinglePrecision ? 1e-4 : 1e-8;
+    const double margin = kSinglePrecision ? 1e-4 : 0.0;
+    for (int i = 0; i < 2000; i++) {
+        Vector3D origin({static_cast<Real>(distribution(prng) + 8.0), distribution(prng), distribution(prng)});
+        Vector3D target({distribution(prng), distribution(prng), static_cast<Real>(0.3 * distribution(prng))});
+        Geometry::Line line(origin, (target - origin).Normalized(), 0.0);
+
+        // ACT
+        auto intersection = torus.Intersect(line);
+
+        // ASSERT
+        if (intersection) {
+            hits++;
+            // Distance of the point from the major circle equals the minor radius
+            EXPECT_NEAR(distanceFromMajorCircle(intersection->point), r, tolerance);
+            // No closer intersection: all points before the hit are outside the torus
+            for (int step = 0; step < 100; step++) {
+                EXPECT_GT(distanceFromMajorCircle(line(intersection->t * step / 100.0)), r - margin);
+            }
+        }
+    }
+    EXPECT_GT(hits, 100);
+}
@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+
+#include "Geometry/AffineTransform.hpp"
+
+#include <array>
+#include <vector>
+
+using namespace Raytracer;
+using namespace Raytracer::Geometry;
+
+TEST(TestAffineTransform, AgreesWithOrthonormalBasis) {
+    // ARRANGE
+    OrthonormalBasis basis(Vector3D({1.0, 2.0, 3.0}), Vector3D({3.0, 0.0, -1.0}));
+    Vector3D position({0.3, -1.2, 2.5});
+    AffineTransform transform(basis, position);
+    Vector3D point({4.0, -2.0, 0.5});
+
+    // ACT
+    Vector3D localPoint = transform.ToLocalPoint(point);
+    Vector3D localDirection = transform.ToLocalDirection(point);
+
+    // ASSERT
+    // Exact in double precision, where the matrix of the transform holds the basis vectors
+    const double tolerance = kSinglePrecision ? 1e-5 : 0.0;
+    EXPECT_FALSE(transform.IsAxisAligned());
+    EXPECT_NEAR((localPoint - basis.ToLocal(point - position)).Norm(), 0.0, tolerance);
+    EXPECT_NEAR((localDirection - basis.ToLocal(point)).Norm(), 0.0, tolerance);
+    EXPECT_NEAR((transform.ToGlobalDirection(localDirection) - basis.ToGlobal(localDirection)).Norm(), 0.0, tolerance);
+    EXPECT_NEAR((transform.ToGlobalPoint(localPoint) - point).Norm(), 0.0, kSinglePrecision ? 1e-5 : 1e-12);
+}
+
+TEST(TestAffineTransform, AxisAlignedTransformOnlyTranslates) {
+    // ARRANGE
+    AffineTransform transform(OrthonormalBasis(), Vector3D({1.0, 2.0, 3.0}));
+    Vector3D point({4.0, -2.0, 0.5});
+
+    // ACT & ASSERT
+    EXPECT_TRUE(transform.IsAxisAligned());
+    EXPECT_EQ(transform.ToLocalPoint(point), Vector3D({3.0, -4.0, -2.5}));
+    EXPECT_EQ(transform.ToLocalDirection(point), point);
+    EXPECT_EQ(transform.ToGlobalPoint(Vector3D({3.0, -4.0, -2.5})), point);
+}
+
+TEST(TestAffineTransform, BatchedTransformAgreesWithSingleLines) {
+    // ARRANGE
+    AffineTransform transform(OrthonormalBasis(Vector3D({0.0, 1.0, 1.0}), Vector3D({1.0, 0.0, 0.0})), Vector3D({0.3, -1.2, 2.5}));
+    std::vector<Line> lines;
+    for (int i = 0; i < 8; i++) {
+        lines.emplace_back(Vector3D({static_cast<Real>(1.0 * i), static_cast<Real>(-0.5 * i), 2.0}), Vector3D({static_cast<Real>(0.1 * i), 1.0, -0.3}).Normalized(), 0.0);
+    }
+    std::vector<Vector3D> origins(lines.size());
+    std::vector<Vector3D> directions(lines.size());
+
+    // ACT
+    transform.ToLocal(lines, origins, directions);
+
+    // ASSERT
+    for (std::size_t i = 0; i < lines.size(); i++) {
+        EXPECT_EQ(origins[i], transform.ToLocalPoint(lines[i].GetOrigin()));
+        EXPECT_EQ(directions[i], transform.ToLocalDirection(lines[i].GetDirection()));
+    }
+    std::vector<Vector3D> tooShort(lines.size() - 1);
+    EXPECT_THROW(transform.ToLocal(lines, tooShort, directions), std::invalid_argument);
+}
+
+TEST(TestAffineTransform, PacketTransformAgreesWithSingleLines) {
+    // ARRANGE
+    AffineTransform transform(OrthonormalBasis(Vector3D({0.0, 1.0, 1.0}), Vector3D({1.0, 0.0, 0.0})), Vector3D({0.3, -1.2, 2.5}));
+    std::vector<Line> lines;
+    for (int i = 0; i < 11; i++) {
+        lines.emplace_back(Vector3D({static_cast<Real>(1.0 * i), static_cast<Real>(-0.5 * i), 2.0}), Vector3D({static_cast<Real>(0.1 * i), 1.0, -0.3}).Normalized(), 0.0);
+    }
+    LinePacket packet;
+    for (const auto& line : lines) {
+        packet.Add(line);
+    }
+    std::array<LinePacket::Lanes, 3> origins;
+    std::array<LinePacket::Lanes, 3> directions;
+
+    // ACT
+    transform.ToLocal(packet, origins, directions);
+
+    // ASSERT
+    for (std::size_t i = 0; i < lines.size(); i++) {
+        const Vector3D origin = transform.ToLocalPoint(lines[i].GetOrigin());
+        const Vector3D direction = transform.ToLocalDirection(lines[i].GetDirection());
+        for (std::size_t axis = 0; axis < 3; axis++) {
+            EXPECT_NEAR(origins[axis][i], origin[axis], kSinglePrecision ? 1e-5 : 1e-12);
+            EXPECT_NEAR(directions[axis][i], direction[axis], kSinglePrecision ? 1e-5 : 1e-12);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+
+#include "Geometry/BVH.hpp"
+#include "Geometry/Shapes/Sphere.hpp"
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Raytracer;
+using namespace Raytracer::Geometry;
+
+TEST(TestBVH, Empty) {
+    // ARRANGE
+    BVH bvh;
+    double tMax = 1.0;
+    std::size_t visited = 0;
+    // ACT
+    bvh.Traverse(Line(), 0.0, tMax, [&](std::size_t) {
+        visited++;
+        return false;
+    });
+    // ASSERT
+    EXPECT_TRUE(bvh.IsEmpty());
+    EXPECT_EQ(visited, 0);
+}
+
+TEST(TestBVH, EmptyBoundsAreLeftOut) {
+    // ARRANGE
+    std::vector<BoundingBox> bounds = {BoundingBox(), Sphere(Vector3D({0.0, 0.0, 0.0}), 1.0).GetBoundingBox(), BoundingBox(), Sphere(Vector3D({3.0, 0.0, 0.0}), 1.0).GetBoundingBox()};
+    double tMax = std::numeric_limits<double>::infinity();
+    std::vector<std::size_t> visited;
+    // ACT
+    BVH bvh(bounds, 1);
+    BVH emptyBVH({BoundingBox(), BoundingBox()});
+    bvh.Traverse(Line(Vector3D({-5.0, 0.0, 0.0}), Vector3D({1.0, 0.0, 0.0})), 0.0, tMax, [&](std::size_t index) {
+        visited.push_back(index);
+        return false;
+    });
+    // ASSERT
+    EXPECT_EQ(bvh.NumberOfPrimitives(), 2);
+    EXPECT_EQ(visited, std::vector<std::size_t>({1, 3}));
+    EXPECT_TRUE(emptyBVH.IsEmpty());
+}
+
+TEST(TestBVH, ClosestHitMatchesLinearScan) {
+    // ARRANGE
+    std::mt19937 prng(42);
+    std::uniform_real_distribution<Real> position(-10.0, 10.0);
+    std::uniform_real_distribution<Real> radius(0.1, 1.0);
+    std::vector<std::shared_ptr<Sphere>> spheres;
+    std::vector<BoundingBox> bounds;
+    for (std::size_t i = 0; i < 500; i++) {
+        spheres.push_back(std::make_shared<Sphere>(Vector3D({position(prng), position(prng), position(prng)}), radius(prng)));
+        bounds.push_back(spheres.back()->GetBoundingBox());
+    }
+    BVH bvh(bounds);
+
+    for (std::size_t i = 0; i < 200; i++) {
+        Line line(Vector3D({position(prng), position(prng), position(prng)}), Vector3D({position(prng), position(prng), position(prng)}), 0.0);
+
+        // ACT
+        double tLinear = std::numeric_limits<double>::infinity();
+        for (const auto& sphere : spheres) {
+            if (auto intersection = sphere->Intersect(line)) {
+                tLinear = std::min(tLinear, intersection->t);
+            }
+        }
+        double tBVH = std::numeric_limits<double>::infinity();
+        bvh.Traverse(line, 0.0, tBVH, [&](std::size_t index) {
+            if (auto intersection = spheres[index]->Intersect(line)) {
+                tBVH = std::min(tBVH, intersection->t);
+            }
+            return false;
+        });
+
+        // ASSERT
+        EXPECT_EQ(tBVH, tLinear);
+    }
+    EXPECT_EQ(bvh.NumberOfPrimitives(), spheres.size());
+}
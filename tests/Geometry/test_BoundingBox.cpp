@@ -0,0 +1,81 @@
+#include "gtest/gtest.h"
+
+#include "Geometry/BoundingBox.hpp"
+
+#include <limits>
+
+using namespace Raytracer;
+using namespace Raytracer::Geometry;
+
+constexpr Real kInfinity = std::numeric_limits<Real>::infinity();
+
+TEST(TestBoundingBox, DefaultConstructedIsEmpty) {
+    // ARRANGE
+    BoundingBox box;
+    // ACT & ASSERT
+    EXPECT_TRUE(box.IsEmpty());
+    EXPECT_DOUBLE_EQ(box.SurfaceArea(), 0.0);
+}
+
+TEST(TestBoundingBox, Expand) {
+    // ARRANGE
+    BoundingBox box;
+    // ACT
+    box.Expand(Vector3D({1.0, -2.0, 3.0}));
+    box.Expand(BoundingBox(Vector3D({0.0, 0.0, 0.0}), Vector3D({2.0, 1.0, 1.0})));
+    // ASSERT
+    EXPECT_FALSE(box.IsEmpty());
+    EXPECT_EQ(box.GetMinimum(), Vector3D({0.0, -2.0, 0.0}));
+    EXPECT_EQ(box.GetMaximum(), Vector3D({2.0, 1.0, 3.0}));
+    EXPECT_EQ(box.LongestAxis(), 1);
+    EXPECT_DOUBLE_EQ(box.SurfaceArea(), 2.0 * (2.0 * 3.0 + 3.0 * 3.0 + 3.0 * 2.0));
+}
+
+TEST(TestBoundingBox, FromDisk) {
+    // ARRANGE
+    Vector3D center({1.0, 2.0, 3.0});
+    // ACT
+    BoundingBox box = BoundingBox::FromDisk(center, Vector3D({0.0, 0.0, 1.0}), 2.0);
+    // ASSERT
+    EXPECT_EQ(box.GetMinimum(), Vector3D({-1.0, 0.0, 3.0}));
+    EXPECT_EQ(box.GetMaximum(), Vector3D({3.0, 4.0, 3.0}));
+}
+
+TEST(TestBoundingBox, Intersect) {
+    // ARRANGE
+    BoundingBox box(Vector3D({-1.0, -1.0, -1.0}), Vector3D({1.0, 1.0, 1.0}));
+    Vector3D origin({-5.0, 0.0, 0.0});
+    Vector3D inverseDirection({1.0, kInfinity, kInfinity});
+    // ACT & ASSERT
+    EXPECT_TRUE(box.Intersect(origin, inverseDirection, 0.0, 10.0));
+    EXPECT_FALSE(box.Intersect(origin, inverseDirection, 0.0, 3.0));
+    EXPECT_FALSE(box.Intersect(Vector3D({-5.0, 2.0, 0.0}), inverseDirection, 0.0, 10.0));
+}
+
+TEST(TestBoundingBox, IntersectFlatBox) {
+    // ARRANGE
+    BoundingBox box(Vector3D({-1.0, -1.0, 0.0}), Vector3D({1.0, 1.0, 0.0}));
+    Vector3D inverseDirection({kInfinity, kInfinity, -1.0});
+    // ACT & ASSERT
+    EXPECT_TRUE(box.Intersect(Vector3D({0.5, 0.5, 2.0}), inverseDirection, 0.0, 10.0));
+    EXPECT_FALSE(box.Intersect(Vector3D({1.5, 0.5, 2.0}), inverseDirection, 0.0, 10.0));
+}
+
+TEST(TestBoundingBox, IntersectGrazingRays) {
+    // ARRANGE
+    // Every ray enters the slab in y exactly where it leaves the slab in x, i.e. it grazes the edge between two faces
+    BoundingBox box(Vector3D({0.0, 0.0, 0.0}), Vector3D({1.0, 1.0, 1.0}));
+    std::size_t misses = 0;
+    // ACT
+    for (int i = 1; i < 60; i++) {
+        for (int j = 1; j < 60; j++) {
+            Vector3D origin({static_cast<Real>(-1.0 - 0.037 * i), static_cast<Real>(-0.3 - 0.021 * j), static_cast<Real>(0.1 * i / 60.0)});
+            Vector3D edgePoint({1.0, 0.0, static_cast<Real>(0.3 + 0.4 * j / 60.0)});
+            Vector3D direction = edgePoint - origin;
+            Vector3D inverseDirection({1 / direction[0], 1 / direction[1], 1 / direction[2]});
+            misses += box.Intersect(origin, inverseDirection, 0.0, 10.0) ? 0 : 1;
+        }
+    }
+    // ASSERT
+    EXPECT_EQ(misses, 0);
+}
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 
 #include "Geometry/CompositeShape.hpp"
+#include "Geometry/Shapes/Box.hpp"
 
 using namespace Raytracer;
 
@@ -9,3 +10,15 @@ TEST(TestCompositeShape, Test1) {
     // ACT
     // ASSERT
 }
+
+TEST(TestCompositeShape, CloneCopiesComponents) {
+    // ARRANGE
+    Geometry::Box box(Vector3D({0.0, 0.0, 0.0}), Vector3D({0.0, 0.0, 1.0}), Vector3D({0.0, 1.0, 0.0}), 1.0, 1.0, 1.0);
+    Geometry::Line line(Vector3D({-5.0, 0.0, 0.0}), Vector3D({1.0, 0.0, 0.0}));
+    // ACT
+    auto clone = box.Clone();
+    clone->SetPosition(Vector3D({2.0, 0.0, 0.0}));
+    // ASSERT
+    EXPECT_NEAR(box.Intersect(line)->t, 4.5, 1e-6);
+    EXPECT_NEAR(clone->Intersect(line)->t, 6.5, 1e-6);
+}
@@ -3,9 +3,20 @@
 #include "Geometry/Line.hpp"
 
 using namespace Raytracer;
+using namespace Raytracer::Geometry;
 
-TEST(TestRay, Test1) {
+TEST(TestLine, IntersectsBoundingBox) {
     // ARRANGE
-    // ACT
-    // ASSERT
+    BoundingBox box(Vector3D({-1.0, -1.0, -1.0}), Vector3D({1.0, 1.0, 1.0}));
+    Line hit(Vector3D({-5.0, 0.5, 0.5}), Vector3D({1.0, 0.0, 0.0}), 0.0);
+    Line miss(Vector3D({-5.0, 0.5, 0.5}), Vector3D({1.0, 1.0, 0.0}), 0.0);
+    Line behind(Vector3D({5.0, 0.5, 0.5}), Vector3D({1.0, 0.0, 0.0}), 0.0);
+    Line infinite(Vector3D({5.0, 0.5, 0.5}), Vector3D({1.0, 0.0, 0.0}));
+
+    // ACT & ASSERT
+    EXPECT_TRUE(hit.IntersectsBoundingBox(box));
+    EXPECT_FALSE(hit.IntersectsBoundingBox(box, 3.0));
+    EXPECT_FALSE(miss.IntersectsBoundingBox(box));
+    EXPECT_FALSE(behind.IntersectsBoundingBox(box));
+    EXPECT_TRUE(infinite.IntersectsBoundingBox(box));
 }
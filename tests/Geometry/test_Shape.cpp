@@ -1,11 +1,239 @@
 #include "gtest/gtest.h"
 
 #include "Geometry/Shape.hpp"
+#include "Geometry/Shapes.hpp"
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
 
 using namespace Raytracer;
+using namespace Raytracer::Geometry;
+
+namespace {
+
+// Sphere whose first bounding box computation fails
+class FailingSphere : public Sphere {
+public:
+    using Sphere::Sphere;
+
+protected:
+    BoundingBox ComputeBoundingBox() const override {
+        if (mCalls++ == 0) {
+            throw std::runtime_error("FailingSphere::ComputeBoundingBox");
+        }
+        return Sphere::ComputeBoundingBox();
+    }
+
+private:
+    mutable int mCalls = 0;
+};
+
+std::vector<std::shared_ptr<Shape>> CreateShapes() {
+    Vector3D position({0.3, -1.2, 2.5});
+    Vector3D orientation = Vector3D({1.0, 2.0, 3.0}).Normalized();
+    Vector3D reference = Vector3D({3.0, 0.0, -1.0}).Normalized();
+    return {
+        std::make_shared<Box>(position, orientation, reference, 1.0, 2.0, 3.0),
+        std::make_shared<BoxAxisAligned>(position, 1.0, 2.0, 3.0),
+        std::make_shared<Cone>(position, orientation, 1.0, 2.0),
+        std::make_shared<Cylinder>(position, orientation, 1.0, 2.0),
+        std::make_shared<CylindricalShell>(position, orientation, 0.5, 1.0, 2.0),
+        std::make_shared<Disk>(position, orientation, 1.5),
+        std::make_shared<HalfTorus>(position, orientation, reference, 2.0, 0.5),
+        std::make_shared<HalfTorusWithSphericalCaps>(position, orientation, reference, 2.0, 0.5),
+        std::make_shared<Octahedron>(position, orientation, reference, 1.5),
+        std::make_shared<Rectangle>(position, orientation, reference, 2.0, 1.0),
+        std::make_shared<Ring>(position, orientation, 0.5, 1.5),
+        std::make_shared<Sphere>(position, 1.5),
+        std::make_shared<SphericalCap>(position, 1.5, orientation),
+        std::make_shared<Tetrahedron>(position, orientation, reference, 1.5),
+        std::make_shared<Torus>(position, orientation, 2.0, 0.5),
+        std::make_shared<Triangle>(Vector3D({0.0, 0.0, 0.0}), Vector3D({1.0, 2.0, 0.5}), Vector3D({-1.0, 1.0, 3.0})),
+        std::make_shared<Tube>(position, orientation, 1.0, 2.0),
+    };
+}
+
+}  // namespace
+
+TEST(TestShape, BoundingBoxContainsSurface) {
+    // ARRANGE
+    Sampler sampler(1);
+    const double tolerance = 1e-9;
+    for (const auto& shape : CreateShapes()) {
+        // ACT
+        BoundingBox box = shape->GetBoundingBox();
+        BoundingBox sampledBox = BoundingBox::FromPoints(shape->SampleSurfacePoints(20000, sampler));
+
+        // ASSERT
+        for (std::size_t i = 0; i < 3; i++) {
+            EXPECT_LE(box.GetMinimum()[i], sampledBox.GetMinimum()[i] + tolerance);
+            EXPECT_GE(box.GetMaximum()[i], sampledBox.GetMaximum()[i] - tolerance);
+        }
+    }
+}
+
+TEST(TestShape, BoundingBoxIsTight) {
+    // ARRANGE
+    Sampler sampler(2);
+    for (const auto& shape : CreateShapes()) {
+        // ACT
+        BoundingBox box = shape->GetBoundingBox();
+        BoundingBox sampledBox = BoundingBox::FromPoints(shape->SampleSurfacePoints(20000, sampler));
+
+        // ASSERT
+        const double tolerance = 0.05 * box.GetExtent().Norm();
+        for (std::size_t i = 0; i < 3; i++) {
+            EXPECT_NEAR(box.GetMinimum()[i], sampledBox.GetMinimum()[i], tolerance);
+            EXPECT_NEAR(box.GetMaximum()[i], sampledBox.GetMaximum()[i], tolerance);
+        }
+    }
+}
+
+TEST(TestShape, BoundingBoxFollowsTransformations) {
+    for (const auto& shape : CreateShapes()) {
+        // ARRANGE
+        Vector3D translation({1.0, 2.0, -3.0});
+        BoundingBox box = shape->GetBoundingBox();
+
+        // ACT
+        shape->SetPosition(shape->GetPosition() + translation);
+        BoundingBox translatedBox = shape->GetBoundingBox();
+        shape->Spin(0.7, Vector3D({0.0, 1.0, 0.0}));
+        shape->Spin(-0.7, Vector3D({0.0, 1.0, 0.0}));
+        BoundingBox spunBox = shape->GetBoundingBox();
+
+        // ASSERT
+        const double tolerance = kSinglePrecision ? 1e-5 : 1e-9;
+        for (std::size_t i = 0; i < 3; i++) {
+            EXPECT_NEAR(translatedBox.GetMinimum()[i], box.GetMinimum()[i] + translation[i], tolerance);
+            EXPECT_NEAR(translatedBox.GetMaximum()[i], box.GetMaximum()[i] + translation[i], tolerance);
+            EXPECT_NEAR(spunBox.GetMinimum()[i], translatedBox.GetMinimum()[i], tolerance);
+            EXPECT_NEAR(spunBox.GetMaximum()[i], translatedBox.GetMaximum()[i], tolerance);
+        }
+    }
+}
 
-TEST(TestShape, Test1) {
+TEST(TestShape, OccludedAgreesWithIntersect) {
     // ARRANGE
-    // ACT
-    // ASSERT
+    Sampler sampler(3);
+    std::uniform_real_distribution<Real> distribution(-1.0, 1.0);
+    const double margin = 1e-6;
+    for (const auto& shape : CreateShapes()) {
+        const Vector3D center = shape->GetBoundingBox().GetCenter();
+        const double radius = shape->GetBoundingBox().GetExtent().Norm();
+        for (int i = 0; i < 2000; i++) {
+            Vector3D origin = center + 2.0 * radius * Vector3D({distribution(sampler), distribution(sampler), distribution(sampler)});
+            Vector3D target = center + 0.5 * radius * Vector3D({distribution(sampler), distribution(sampler), distribution(sampler)});
+            Line line(origin, (target - origin).Normalized(), 0.0);
+
+            // ACT
+            auto intersection = shape->Intersect(line);
+
+            // ASSERT
+            if (intersection.has_value()) {
+                EXPECT_TRUE(shape->Occluded(line, 0.0, intersection->t + margin));
+                EXPECT_FALSE(shape->Occluded(line, 0.0, intersection->t - margin));
+            } else {
+                EXPECT_FALSE(shape->Occluded(line, 0.0, std::numeric_limits<double>::infinity()));
+            }
+        }
+    }
+}
+
+TEST(TestShape, SurfaceInteractionCompletesTheClosestHit) {
+    // ARRANGE
+    Sampler sampler(5);
+    std::uniform_real_distribution<Real> distribution(-1.0, 1.0);
+    const double tolerance = 1e-6;
+    for (const auto& shape : CreateShapes()) {
+        const Vector3D center = shape->GetBoundingBox().GetCenter();
+        const double radius = shape->GetBoundingBox().GetExtent().Norm();
+        for (int i = 0; i < 500; i++) {
+            Vector3D origin = center + 2.0 * radius * Vector3D({distribution(sampler), distribution(sampler), distribution(sampler)});
+            Vector3D target = center + 0.5 * radius * Vector3D({distribution(sampler), distribution(sampler), distribution(sampler)});
+            Line line(origin, (target - origin).Normalized(), 0.0);
+
+            // ACT
+            auto hit = shape->FindHit(line);
+            if (!hit.has_value()) {
+                continue;
+            }
+            auto intersection = shape->ComputeSurfaceInteraction(line, *hit);
+
+            // ASSERT
+            EXPECT_DOUBLE_EQ(intersection.t, hit->t);
+            EXPECT_NEAR((intersection.point - line(hit->t)).Norm(), 0.0, tolerance * (1.0 + hit->t));
+            EXPECT_NEAR(intersection.normal.Norm(), 1.0, tolerance);
+        }
+    }
+}
+
+TEST(TestShape, TransformFollowsMotion) {
+    // ARRANGE
+    for (const auto& shape : CreateShapes()) {
+        // ACT
+        shape->SetPosition(shape->GetPosition() + Vector3D({1.0, -2.0, 0.5}));
+        shape->Spin(0.7, Vector3D({0.0, 1.0, 1.0}));
+        shape->Rotate(-0.4, Line(Vector3D({1.0, 0.0, 0.0}), Vector3D({0.0, 0.0, 1.0})));
+
+        // ASSERT
+        const AffineTransform& transform = shape->GetTransform();
+        EXPECT_NEAR(transform.ToLocalPoint(shape->GetPosition()).Norm(), 0.0, 1e-12);
+        EXPECT_NEAR((transform.ToGlobalDirection(Vector3D({0.0, 0.0, 1.0})) - shape->GetOrientation()).Norm(), 0.0, 1e-12);
+    }
+}
+
+TEST(TestShape, PacketHitsAgreeWithScalarHits) {
+    // ARRANGE
+    Sampler sampler(7);
+    std::uniform_real_distribution<Real> distribution(-1.0, 1.0);
+    const double tolerance = kSinglePrecision ? 1e-4 : 1e-9;
+    for (const auto& shape : CreateShapes()) {
+        const Vector3D center = shape->GetBoundingBox().GetCenter();
+        const double radius = shape->GetBoundingBox().GetExtent().Norm();
+        // The last packet is only partially filled
+        std::vector<Line> lines;
+        for (int i = 0; i < 200; i++) {
+            Vector3D origin = center + 2.0 * radius * Vector3D({distribution(sampler), distribution(sampler), distribution(sampler)});
+            Vector3D target = center + 0.5 * radius * Vector3D({distribution(sampler), distribution(sampler), distribution(sampler)});
+            lines.emplace_back(origin, (target - origin).Normalized(), 0.0);
+        }
+        for (std::size_t begin = 0; begin < lines.size(); begin += LinePacket::kMaximumSize) {
+            LinePacket packet;
+            for (std::size_t i = begin; i < lines.size() && !packet.IsFull(); i++) {
+                packet.Add(lines[i]);
+            }
+            PacketHits hits;
+
+            // ACT
+            shape->FindHits(packet, hits);
+
+            // ASSERT
+            for (std::size_t lane = 0; lane < packet.size; lane++) {
+                auto hit = shape->FindHit(lines[begin + lane]);
+                ASSERT_EQ(hits.HasHit(lane), hit.has_value());
+                if (hit.has_value()) {
+                    EXPECT_NEAR(hits.t[lane], hit->t, tolerance * (1.0 + hit->t));
+                    EXPECT_EQ(hits.component[lane], hit->component);
+                    EXPECT_EQ(hits.primitive[lane], hit->primitive);
+                    EXPECT_NEAR(hits.u[lane], hit->u, tolerance);
+                    EXPECT_NEAR(hits.v[lane], hit->v, tolerance);
+                }
+            }
+        }
+    }
+}
+
+TEST(TestShape, FailedCacheComputationIsRetried) {
+    // ARRANGE
+    FailingSphere sphere(Vector3D({1.0, 0.0, 0.0}), 0.5);
+
+    // ACT & ASSERT
+    EXPECT_THROW(sphere.GetBoundingBox(), std::runtime_error);
+    BoundingBox box = sphere.GetBoundingBox();
+    EXPECT_TRUE(box.Contains(Vector3D({1.4, 0.0, 0.0})));
+    EXPECT_FALSE(box.Contains(Vector3D({0.4, 0.0, 0.0})));
 }
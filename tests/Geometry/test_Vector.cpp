@@ -2,10 +2,71 @@
 
 #include "Geometry/Vector.hpp"
 
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
 using namespace Raytracer;
 
-TEST(TestVector, Test1) {
+TEST(TestVector, Arithmetic) {
+    // ARRANGE
+    Vector3D a({1.0, 2.0, 3.0});
+    Vector3D b({-4.0, 0.5, 2.0});
+    // ACT
+    // ASSERT
+    EXPECT_EQ(a + b, Vector3D({-3.0, 2.5, 5.0}));
+    EXPECT_EQ(a - b, Vector3D({5.0, 1.5, 1.0}));
+    EXPECT_EQ(2.0 * a, Vector3D({2.0, 4.0, 6.0}));
+    EXPECT_EQ(a / 2.0, Vector3D({0.5, 1.0, 1.5}));
+}
+
+TEST(TestVector, DotMatchesScalarSum) {
+    // ARRANGE
+    Vector3D a({0.1, 0.2, 0.3});
+    Vector3D b({0.7, -0.11, 0.13});
+    // ACT
+    Real dot = a.Dot(b);
+    // ASSERT
+    Real expected = Real(0.1) * Real(0.7);
+    expected += Real(0.2) * Real(-0.11);
+    expected += Real(0.3) * Real(0.13);
+    EXPECT_EQ(dot, expected);
+    EXPECT_NEAR(a.FusedDot(b), expected, 4 * std::numeric_limits<Real>::epsilon());
+}
+
+TEST(TestVector, Cross) {
+    // ARRANGE
+    Vector3D ex({1.0, 0.0, 0.0});
+    Vector3D ey({0.0, 1.0, 0.0});
+    Vector3D a({1.0, 2.0, 3.0});
+    Vector3D b({4.0, 5.0, 6.0});
+    // ACT
+    // ASSERT
+    EXPECT_EQ(ex.Cross(ey), Vector3D({0.0, 0.0, 1.0}));
+    EXPECT_EQ(a.Cross(b), Vector3D({-3.0, 6.0, -3.0}));
+}
+
+TEST(TestVector, NormalizeUnchecked) {
+    // ARRANGE
+    Vector3D v({3.0, 0.0, 4.0});
+    Vector3D zero;
+    // ACT
+    Vector3D w = v;
+    w.NormalizeUnchecked();
+    // ASSERT
+    EXPECT_EQ(v.NormalizedUnchecked(), v.Normalized());
+    EXPECT_EQ(w, v.Normalized());
+    EXPECT_THROW(zero.Normalize(), std::runtime_error);
+    EXPECT_TRUE(std::isnan(zero.NormalizedUnchecked()[0]));
+}
+
+TEST(TestVector, TwoDimensional) {
     // ARRANGE
+    Vector2D a({3.0, 4.0});
+    Vector2D b({1.0, -1.0});
     // ACT
     // ASSERT
+    EXPECT_EQ(a + b, Vector2D({4.0, 3.0}));
+    EXPECT_EQ(a.Dot(b), Real(-1.0));
+    EXPECT_EQ(a.Norm(), Real(5.0));
 }
@@ -0,0 +1,210 @@
+#include "gtest/gtest.h"
+
+#include "Rendering/AccumulationBuffer.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+using namespace Raytracer;
+
+TEST(TestAccumulationBuffer, MeanOfSamples) {
+    // ARRANGE
+    AccumulationBuffer buffer(6, 4);
+
+    // ACT
+    buffer.AddSample(5, 3, Color(1.0, 0.5, 0.25));
+    buffer.AddSample(5, 3, Color(0.0, 0.5, 0.75));
+    buffer.AddSamples(0, 0, Color(3.0, 6.0, 9.0), 3);
+
+    // ASSERT
+    EXPECT_EQ(buffer.GetSampleCount(5, 3), 2);
+    EXPECT_EQ(buffer.GetMean(5, 3), Color(0.5, 0.5, 0.5));
+    EXPECT_EQ(buffer.GetSampleCount(0, 0), 3);
+    EXPECT_EQ(buffer.GetMean(0, 0), Color(1.0, 2.0, 3.0));
+    EXPECT_EQ(buffer.GetSampleCount(1, 1), 0);
+    EXPECT_EQ(buffer.GetMean(1, 1), Color(0.0, 0.0, 0.0));
+}
+
+TEST(TestAccumulationBuffer, ResolveIntoImage) {
+    // ARRANGE
+    AccumulationBuffer buffer(6, 4);
+    Image image(6, 4, Color(1.0, 1.0, 1.0));
+    Image wrongSize(4, 6);
+    buffer.AddSamples(2, 1, Color(0.5, 1.0, 1.5), 2);
+
+    // ACT
+    buffer.Resolve(image);
+
+    // ASSERT
+    EXPECT_EQ(image.GetPixel(2, 1), Color(0.25, 0.5, 0.75));
+    EXPECT_EQ(image.GetPixel(0, 0), Color(0.0, 0.0, 0.0));
+    EXPECT_THROW(buffer.Resolve(wrongSize), std::invalid_argument);
+}
+
+TEST(TestAccumulationBuffer, Clear) {
+    // ARRANGE
+    AccumulationBuffer buffer(4, 4);
+    buffer.AddSample(1, 2, Color(1.0, 1.0, 1.0));
+
+    // ACT
+    buffer.Clear();
+
+    // ASSERT
+    EXPECT_EQ(buffer.GetSampleCount(1, 2), 0);
+}
+
+TEST(TestAccumulationBuffer, RelativeError) {
+    // ARRANGE
+    AccumulationBuffer buffer(4, 4, true);
+    AccumulationBuffer untracked(4, 4);
+    const std::vector<double> luminances = {0.2, 0.4, 0.6, 0.8};
+
+    // ACT
+    for (double luminance : luminances) {
+        buffer.AddSample(1, 1, Color(luminance, luminance, luminance));
+        buffer.AddSample(2, 2, Color(0.5, 0.5, 0.5));
+        untracked.AddSample(1, 1, Color(luminance, luminance, luminance));
+    }
+    buffer.AddSample(3, 3, Color(1.0, 1.0, 1.0));
+
+    // ASSERT
+    // Sample variance 1/15, mean 0.5, so the standard error is sqrt(1/60)
+    EXPECT_TRUE(buffer.TracksVariance());
+    EXPECT_NEAR(buffer.GetRelativeError(1, 1), std::sqrt(1.0 / 60.0) / 0.5, 1e-6);
+    EXPECT_NEAR(buffer.GetRelativeError(2, 2), 0.0, 1e-6);
+    EXPECT_TRUE(std::isinf(buffer.GetRelativeError(3, 3)));
+    EXPECT_FALSE(untracked.TracksVariance());
+    EXPECT_TRUE(std::isinf(untracked.GetRelativeError(1, 1)));
+}
+
+TEST(TestAccumulationBuffer, SampleCountImage) {
+    // ARRANGE
+    AccumulationBuffer buffer(4, 2);
+    buffer.AddSamples(0, 0, Color(1.0, 1.0, 1.0), 4);
+    buffer.AddSamples(3, 1, Color(1.0, 1.0, 1.0), 1);
+
+    // ACT
+    Image image = buffer.CreateSampleCountImage();
+
+    // ASSERT
+    EXPECT_EQ(image.GetPixel(0, 0), Color(1.0, 1.0, 1.0));
+    EXPECT_EQ(image.GetPixel(3, 1), Color(0.25, 0.25, 0.25));
+    EXPECT_EQ(image.GetPixel(1, 0), Color(0.0, 0.0, 0.0));
+}
+
+TEST(TestAccumulationBuffer, InvalidDimensions) {
+    // ACT & ASSERT
+    EXPECT_THROW(AccumulationBuffer(0, 4), std::invalid_argument);
+}
+
+TEST(TestAlignedAllocator, StorageIsCacheLineAligned) {
+    // ARRANGE
+    AlignedVector<Color> colors(13);
+
+    // ACT
+    auto address = reinterpret_cast<std::uintptr_t>(colors.data());
+
+    // ASSERT
+    EXPECT_EQ(address % kCacheLineSize, 0);
+}
+
+TEST(TestAccumulationBuffer, WriteAndRead) {
+    // ARRANGE
+    AccumulationBuffer buffer(5, 3, true);
+    buffer.AddSample(4, 2, Color(1.0, 0.5, 0.25));
+    buffer.AddSample(4, 2, Color(0.0, 0.5, 0.75));
+    buffer.AddSamples(0, 1, Color(3.0, 6.0, 9.0), 3);
+    std::stringstream stream;
+
+    // ACT
+    buffer.Write(stream);
+    AccumulationBuffer copy = AccumulationBuffer::Read(stream);
+
+    // ASSERT
+    EXPECT_TRUE(copy.TracksVariance());
+    for (std::size_t y = 0; y < 3; y++) {
+        for (std::size_t x = 0; x < 5; x++) {
+            EXPECT_EQ(copy.GetSampleCount(x, y), buffer.GetSampleCount(x, y));
+            EXPECT_EQ(copy.GetMean(x, y), buffer.GetMean(x, y));
+        }
+    }
+    EXPECT_EQ(copy.GetRelativeError(4, 2), buffer.GetRelativeError(4, 2));
+    std::stringstream truncated(stream.str().substr(0, 10));
+    EXPECT_THROW(AccumulationBuffer::Read(truncated), std::runtime_error);
+}
+
+TEST(TestAccumulationBuffer, CopyRegion) {
+    // ARRANGE
+    AccumulationBuffer source(6, 4);
+    AccumulationBuffer target(6, 4);
+    source.AddSamples(1, 1, Color(1.0, 1.0, 1.0), 1);
+    source.AddSamples(4, 3, Color(1.0, 1.0, 1.0), 1);
+
+    // ACT
+    target.CopyRegion(source, 0, 2, 0, 2);
+
+    // ASSERT
+    EXPECT_EQ(target.GetSampleCount(1, 1), 1);
+    EXPECT_EQ(target.GetSampleCount(4, 3), 0);
+    EXPECT_THROW(target.CopyRegion(AccumulationBuffer(4, 6), 0, 2, 0, 2), std::invalid_argument);
+}
+
+TEST(TestAccumulationBuffer, MergeMatchesSingleBuffer) {
+    // ARRANGE
+    const std::vector<Color> samples = {Color(1.0, 0.5, 0.25), Color(0.0, 0.5, 0.75), Color(2.0, 1.0, 0.5), Color(0.5, 0.5, 0.5), Color(0.1, 0.2, 0.3)};
+    AccumulationBuffer single(3, 2, true);
+    AccumulationBuffer first(3, 2, true);
+    AccumulationBuffer second(3, 2, true);
+    for (std::size_t i = 0; i < samples.size(); i++) {
+        single.AddSample(2, 1, samples[i]);
+        (i < 2 ? first : second).AddSample(2, 1, samples[i]);
+    }
+    second.AddSample(0, 0, samples[0]);
+
+    // ACT
+    first.Merge(second);
+
+    // ASSERT
+    EXPECT_EQ(first.GetSampleCount(2, 1), 5);
+    EXPECT_EQ(first.GetSampleCount(0, 0), 1);
+    EXPECT_EQ(first.GetSampleCount(1, 0), 0);
+    EXPECT_NEAR(first.GetMean(2, 1).R(), single.GetMean(2, 1).R(), 1e-6);
+    EXPECT_NEAR(first.GetRelativeError(2, 1), single.GetRelativeError(2, 1), 1e-5);
+    EXPECT_THROW(first.Merge(AccumulationBuffer(3, 2)), std::invalid_argument);
+}
+
+TEST(TestAccumulationBuffer, RowBand) {
+    // ARRANGE
+    AccumulationBuffer band(5, 6, 2, 4, true);
+    band.AddSample(1, 2, Color(1.0, 0.5, 0.25));
+    band.AddSample(4, 3, Color(0.5, 0.5, 0.5));
+    band.AddSample(4, 3, Color(0.0, 0.5, 1.0));
+    std::stringstream stream;
+    AccumulationBuffer whole(5, 6, true);
+    whole.AddSample(4, 3, Color(1.0, 1.0, 1.0));
+    Image image(5, 6);
+
+    // ACT
+    band.Write(stream);
+    AccumulationBuffer copy = AccumulationBuffer::Read(stream);
+    whole.Merge(copy);
+    copy.Resolve(image);
+
+    // ASSERT
+    EXPECT_EQ(stream.str().size(), AccumulationBuffer::SerializedSize(5, 2, true));
+    EXPECT_LT(stream.str().size(), AccumulationBuffer::SerializedSize(5, 6, true));
+    EXPECT_EQ(copy.GetFirstRow(), 2);
+    EXPECT_EQ(copy.GetEndRow(), 4);
+    EXPECT_EQ(copy.GetMean(1, 2), band.GetMean(1, 2));
+    EXPECT_EQ(whole.GetSampleCount(1, 2), 1);
+    EXPECT_EQ(whole.GetSampleCount(4, 3), 3);
+    EXPECT_EQ(whole.GetSampleCount(0, 0), 0);
+    EXPECT_EQ(image.GetPixel(1, 2), band.GetMean(1, 2));
+    EXPECT_EQ(image.GetPixel(1, 5), Color(0.0, 0.0, 0.0));
+    EXPECT_THROW(copy.Merge(whole), std::invalid_argument);
+    EXPECT_THROW(AccumulationBuffer(5, 6, 4, 7), std::invalid_argument);
+    EXPECT_THROW(AccumulationBuffer(5, 6, 4, 2), std::invalid_argument);
+    EXPECT_NO_THROW(AccumulationBuffer(5, 6, 6, 6, true).Merge(AccumulationBuffer(5, 6, 6, 6, true)));
+}
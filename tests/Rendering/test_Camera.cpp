@@ -1,11 +1,554 @@
 #include "gtest/gtest.h"
 
+#include "Geometry/Shapes/Sphere.hpp"
 #include "Rendering/Camera.hpp"
+#include "Rendering/RenderCheckpoint.hpp"
+#include "Rendering/RenderStatistics.hpp"
+#include "Rendering/TileScheduler.hpp"
+#include "Utilities/FrameSink.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
 
 using namespace Raytracer;
 
+namespace {
+
+// A diffuse sphere lit by a small spherical lamp above it
+Scene CreateSphereAndLampScene() {
+    Scene scene;
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Sphere", Material(Color(0.8, 0.5, 0.2)), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 0.0}), 1.0)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Lamp", Material(Color(1.0, 1.0, 1.0), 1.0, 1.0, 0.0, 5.0), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 3.0}), 0.5)));
+    scene.BuildAccelerationStructure();
+    return scene;
+}
+
+// Path tracer with next event estimation in front of the scene, with anti-aliasing so that the pixel samples draw random numbers
+Camera CreateCameraFacingScene() {
+    Camera camera(Vector3D({-4.0, 0.0, 0.5}), Vector3D({1.0, 0.0, 0.0}), Renderer::Type::PATH_TRACER_NEE);
+    camera.SetUseAntiAliasing(true);
+    return camera;
+}
+
+}  // namespace
+
 TEST(TestCamera, Test1) {
     // ARRANGE
     // ACT
     // ASSERT
 }
+
+TEST(TestCamera, FixedSeedIsReproducible) {
+    // ARRANGE
+    Scene scene = CreateSphereAndLampScene();
+    Camera camera = CreateCameraFacingScene();
+    camera.SetResolution(24, 16);
+    camera.SetSamplesPerPixel(2);
+    camera.SetSeed(7);
+
+    // ACT
+    Image image1 = camera.RenderImage(scene);
+    Image image2 = camera.RenderImage(scene);
+    camera.SetSeed(8);
+    Image image3 = camera.RenderImage(scene);
+
+    // ASSERT
+    bool seedChangesImage = false;
+    for (std::size_t y = 0; y < 16; y++) {
+        for (std::size_t x = 0; x < 24; x++) {
+            EXPECT_EQ(image1.GetPixel(x, y), image2.GetPixel(x, y));
+            seedChangesImage |= (image1.GetPixel(x, y) != image3.GetPixel(x, y));
+        }
+    }
+    EXPECT_TRUE(seedChangesImage);
+}
+
+TEST(TestCamera, SchedulersRenderIdenticalImages) {
+    // ARRANGE
+    Scene scene = CreateSphereAndLampScene();
+    Camera camera = CreateCameraFacingScene();
+    camera.SetResolution(26, 18);
+    camera.SetSamplesPerPixel(3);
+    camera.SetSeed(7);
+
+    // ACT
+    camera.SetScheduler(Camera::Scheduler::SAMPLE_PASSES);
+    Image passesImage = camera.RenderImage(scene);
+    camera.SetScheduler(Camera::Scheduler::TILES, 5);
+    Image tilesImage = camera.RenderImage(scene);
+
+    // ASSERT
+    for (std::size_t y = 0; y < 18; y++) {
+        for (std::size_t x = 0; x < 26; x++) {
+            EXPECT_EQ(passesImage.GetPixel(x, y), tilesImage.GetPixel(x, y));
+        }
+    }
+    EXPECT_THROW(camera.SetScheduler(Camera::Scheduler::TILES, 0), std::invalid_argument);
+}
+
+TEST(TestCamera, AdaptiveSamplingIsIndependentOfScheduler) {
+    // ARRANGE
+    Scene scene = CreateSphereAndLampScene();
+    Camera camera = CreateCameraFacingScene();
+    camera.SetResolution(26, 18);
+    camera.SetSamplesPerPixel(12);
+    camera.SetSeed(7);
+    Camera::AdaptiveSampling adaptiveSampling;
+    adaptiveSampling.enabled = true;
+    adaptiveSampling.minimumSamples = 4;
+    adaptiveSampling.relativeErrorThreshold = 0.05;
+    camera.SetAdaptiveSampling(adaptiveSampling);
+
+    // ACT
+    camera.SetScheduler(Camera::Scheduler::SAMPLE_PASSES);
+    Image passesImage = camera.RenderImage(scene);
+    camera.SetScheduler(Camera::Scheduler::TILES, 5);
+    Image tilesImage = camera.RenderImage(scene);
+
+    // ASSERT
+    for (std::size_t y = 0; y < 18; y++) {
+        for (std::size_t x = 0; x < 26; x++) {
+            EXPECT_EQ(passesImage.GetPixel(x, y), tilesImage.GetPixel(x, y));
+        }
+    }
+    adaptiveSampling.minimumSamples = 1;
+    EXPECT_THROW(camera.SetAdaptiveSampling(adaptiveSampling), std::invalid_argument);
+}
+
+TEST(TestCamera, TimeBudgetReplacesSampleCount) {
+    // ARRANGE
+    Scene scene = CreateSphereAndLampScene();
+    Camera camera = CreateCameraFacingScene();
+    camera.SetResolution(26, 18);
+    camera.SetSamplesPerPixel(1);
+    const double timeBudget = 0.2;
+    camera.SetTimeBudget(timeBudget);
+
+    RenderStatistics::Reset();
+
+    // ACT
+    auto startTime = std::chrono::high_resolution_clock::now();
+    Image image = camera.RenderImage(scene);
+    double duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+    // ASSERT
+    EXPECT_GE(duration, timeBudget);
+    EXPECT_GT(image.GetPixel(13, 9).Luminance(), 0.0);
+    // The achieved samples are recorded without the progress bar
+    const RenderStatistics::Sampling sampling = RenderStatistics::CollectSampling();
+    EXPECT_EQ(sampling.pixels, 26 * 18);
+    EXPECT_GE(sampling.AverageSamplesPerPixel(), 1.0);
+    EXPECT_GE(sampling.maximumSamplesPerPixel, 1);
+    EXPECT_THROW(camera.SetTimeBudget(-1.0), std::invalid_argument);
+}
+
+TEST(TestCamera, RenderVideoPassesEveryFrameToAllSinks) {
+    // ARRANGE
+    Scene scene;
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Sphere", Material(Color(0.8, 0.5, 0.2)), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 0.0}), 1.0)));
+    scene.BuildAccelerationStructure();
+    Camera camera(Vector3D({-4.0, 0.0, 0.5}), Vector3D({1.0, 0.0, 0.0}), Renderer::Type::SIMPLE);
+    camera.SetResolution(16, 12);
+    camera.SetFramesPerSecond(10.0);
+    Video video(10.0);
+    Video preview(10.0, 4, 0);
+    // ACT
+    camera.RenderVideo(scene, 0.5, {&video, &preview}, false);
+    // ASSERT
+    EXPECT_EQ(video.GetNumberOfFrames(), 5);
+    EXPECT_EQ(preview.GetNumberOfFrames(), 5);
+}
+
+// Keeps every frame, e.g. to compare the frames of two renders
+class RecordingSink : public FrameSink {
+public:
+    void AddFrame(const Image& image) override { frames.push_back(image); }
+    bool Close(bool openFile = false) override { return true; }
+
+    std::vector<Image> frames;
+};
+
+TEST(TestCamera, ParallelFramesMatchSerialFrames) {
+    // ARRANGE
+    auto createScene = [] {
+        Scene scene;
+        auto sphere = std::make_shared<ObjectPrimitive>("Sphere", Material(Color(0.8, 0.5, 0.2)), std::make_shared<Geometry::Sphere>(Vector3D({0.0, -1.0, 0.0}), 0.5));
+        sphere->SetVelocity(Vector3D({0.0, 1.0, 0.0}));
+        scene.AddObject(sphere);
+        scene.BuildAccelerationStructure();
+        return scene;
+    };
+    Scene serialScene = createScene();
+    Scene parallelScene = createScene();
+    Camera camera(Vector3D({-4.0, 0.0, 0.5}), Vector3D({1.0, 0.0, 0.0}), Renderer::Type::PATH_TRACER);
+    camera.SetResolution(16, 12);
+    camera.SetFramesPerSecond(10.0);
+    camera.SetSamplesPerPixel(2);
+    camera.SetVelocity(Vector3D({0.0, 0.0, 0.1}));
+    Camera parallelCamera = camera;
+    parallelCamera.SetParallelFrames(true);
+    RecordingSink serial;
+    RecordingSink parallel;
+    // ACT
+    camera.RenderVideo(serialScene, 1.0, {&serial}, false);
+    RenderStatistics::Reset();
+    auto parallelStartTime = std::chrono::high_resolution_clock::now();
+    parallelCamera.RenderVideo(parallelScene, 1.0, {&parallel}, false);
+    const double parallelSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - parallelStartTime).count();
+    // ASSERT
+    // The timings of frames that render at the same time are not added up across threads
+    const RenderStatistics::Timings timings = RenderStatistics::CollectTimings();
+    EXPECT_GT(timings[RenderStatistics::Stage::TRACE], 0.0);
+    EXPECT_LE(timings[RenderStatistics::Stage::TRACE] + timings[RenderStatistics::Stage::DENOISE] + timings[RenderStatistics::Stage::TONEMAP] + timings[RenderStatistics::Stage::ENCODE], parallelSeconds);
+    ASSERT_EQ(serial.frames.size(), 10);
+    ASSERT_EQ(parallel.frames.size(), 10);
+    for (std::size_t i = 0; i < serial.frames.size(); i++) {
+        for (std::size_t y = 0; y < 12; y++) {
+            for (std::size_t x = 0; x < 16; x++) {
+                EXPECT_EQ(serial.frames[i].GetPixel(x, y).GetRGB255(), parallel.frames[i].GetPixel(x, y).GetRGB255());
+            }
+        }
+    }
+    EXPECT_DOUBLE_EQ(serialScene.GetTime(), 1.0);
+    EXPECT_DOUBLE_EQ(parallelScene.GetTime(), 1.0);
+}
+
+TEST(TestCamera, VideoFramesMatchFrameByFrameStepping) {
+    // ARRANGE
+    auto createScene = [] {
+        Scene scene;
+        auto sphere = std::make_shared<ObjectPrimitive>("Sphere", Material(Color(0.8, 0.5, 0.2)), std::make_shared<Geometry::Sphere>(Vector3D({0.5, -1.0, 0.0}), 0.5));
+        sphere->SetVelocity(Vector3D({0.0, 1.0, 0.0}));
+        sphere->SetAcceleration(Vector3D({0.0, -3.0, 0.5}));
+        sphere->SetAngularVelocity(Vector3D({0.0, 0.0, 0.8}));
+        scene.AddObject(sphere);
+        scene.BuildAccelerationStructure();
+        return scene;
+    };
+    Scene scene = createScene();
+    Scene steppedScene = createScene();
+    Camera camera(Vector3D({-4.0, 0.0, 0.5}), Vector3D({1.0, 0.0, 0.0}), Renderer::Type::DETERMINISTIC);
+    camera.SetResolution(16, 12);
+    camera.SetFramesPerSecond(10.0);
+    camera.SetVelocity(Vector3D({0.0, 0.0, 0.1}));
+    camera.SetAngularVelocity(Vector3D({0.0, 0.0, 0.3}));
+    Camera steppedCamera = camera;
+    camera.SetParallelFrames(true);
+    RecordingSink video;
+    std::vector<Image> steppedFrames;
+    // ACT
+    camera.RenderVideo(scene, 1.0, {&video}, false);
+    for (std::size_t i = 0; i < 10; i++) {
+        steppedFrames.push_back(steppedCamera.RenderImage(steppedScene));
+        steppedCamera.Evolve(0.1);
+        steppedScene.Evolve(0.1);
+    }
+    // ASSERT
+    ASSERT_EQ(video.frames.size(), 10);
+    for (std::size_t i = 0; i < 10; i++) {
+        for (std::size_t y = 0; y < 12; y++) {
+            for (std::size_t x = 0; x < 16; x++) {
+                EXPECT_EQ(video.frames[i].GetPixel(x, y), steppedFrames[i].GetPixel(x, y));
+            }
+        }
+    }
+    EXPECT_EQ(scene.GetTime(), steppedScene.GetTime());
+}
+
+TEST(TestCamera, ResumedRenderMatchesUninterruptedRender) {
+    for (auto scheduler : {Camera::Scheduler::TILES, Camera::Scheduler::SAMPLE_PASSES}) {
+        // ARRANGE
+        Scene scene = CreateSphereAndLampScene();
+        const std::string directory = (std::filesystem::temp_directory_path() / "test_camera_checkpoints").string();
+        const std::string filepath = directory + "/image.checkpoint";
+        Camera camera = CreateCameraFacingScene();
+        camera.SetResolution(24, 16);
+        camera.SetSamplesPerPixel(4);
+        camera.SetScheduler(scheduler, 8);
+        camera.SetSeed(7);
+        camera.SetCheckpointInterval(1000.0, directory);
+        Image uninterrupted = camera.RenderImage(scene);
+
+        // Checkpoint of a render that was interrupted after the first tile, or after the first two sample passes
+        if (scheduler == Camera::Scheduler::TILES) {
+            auto checkpoint = RenderCheckpoint::Load(filepath);
+            ASSERT_TRUE(checkpoint.has_value());
+            TileScheduler::Tile tile = TileScheduler(24, 16, 8, 1).GetTile(0);
+            AccumulationBuffer firstTile(24, 16);
+            firstTile.CopyRegion(*checkpoint->accumulation, tile.xBegin, tile.xEnd, tile.yBegin, tile.yEnd);
+            checkpoint->accumulation = firstTile;
+            checkpoint->completedTiles.assign(checkpoint->completedTiles.size(), false);
+            checkpoint->completedTiles[0] = true;
+            checkpoint->Save(filepath);
+        } else {
+            Camera interrupted = camera;
+            interrupted.SetSamplesPerPixel(2);
+            interrupted.RenderImage(scene);
+            auto checkpoint = RenderCheckpoint::Load(filepath);
+            ASSERT_TRUE(checkpoint.has_value());
+            EXPECT_EQ(checkpoint->completedPasses, 2);
+            checkpoint->samplesPerPixel = 4;
+            checkpoint->Save(filepath);
+        }
+        Camera resumed = camera;
+        resumed.SetSeed(8);  // The seed of the checkpoint applies
+        resumed.SetResume(true);
+
+        // ACT
+        Image image = resumed.RenderImage(scene);
+
+        // ASSERT
+        for (std::size_t y = 0; y < 16; y++) {
+            for (std::size_t x = 0; x < 24; x++) {
+                EXPECT_EQ(image.GetPixel(x, y), uninterrupted.GetPixel(x, y));
+            }
+        }
+        camera.SetResolution(12, 8);
+        camera.SetResume(true);
+        EXPECT_THROW(camera.RenderImage(scene), std::runtime_error);
+        std::filesystem::remove_all(directory);
+    }
+}
+
+TEST(TestCamera, CorruptCheckpointRestartsRender) {
+    // ARRANGE
+    Scene scene;
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Sphere", Material(Color(0.8, 0.5, 0.2)), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 0.0}), 1.0)));
+    scene.BuildAccelerationStructure();
+    const std::string directory = (std::filesystem::temp_directory_path() / "test_camera_corrupt_checkpoint").string();
+    Camera camera(Vector3D({-4.0, 0.0, 0.5}), Vector3D({1.0, 0.0, 0.0}), Renderer::Type::PATH_TRACER);
+    camera.SetResolution(16, 12);
+    camera.SetSamplesPerPixel(2);
+    camera.SetSeed(7);
+    camera.SetCheckpointInterval(1000.0, directory);
+    Image uninterrupted = camera.RenderImage(scene);
+    std::filesystem::resize_file(directory + "/image.checkpoint", 100);
+    camera.SetResume(true);
+    // ACT
+    Image image = camera.RenderImage(scene);
+    // ASSERT
+    for (std::size_t y = 0; y < 12; y++) {
+        for (std::size_t x = 0; x < 16; x++) {
+            EXPECT_EQ(image.GetPixel(x, y), uninterrupted.GetPixel(x, y));
+        }
+    }
+    std::filesystem::remove_all(directory);
+}
+
+// Keeps its frames like a sink that writes them to disk, and fails after a number of frames, e.g. like a crashed render
+class InterruptedSink : public RecordingSink {
+public:
+    std::size_t maximumFrames = 0;
+
+    void AddFrame(const Image& image) override {
+        if (frames.size() == maximumFrames) {
+            throw std::runtime_error("Interrupted");
+        }
+        RecordingSink::AddFrame(image);
+    }
+    bool CanResumeAfter(std::size_t numberOfFrames) const override { return numberOfFrames <= frames.size(); }
+    void ResumeAfter(std::size_t numberOfFrames) override { frames.resize(numberOfFrames); }
+};
+
+TEST(TestCamera, ExceptionsLeaveParallelRendersAsErrors) {
+    // ARRANGE
+    Scene scene;
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Sphere", Material(Color(0.8, 0.5, 0.2)), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 0.0}), 1.0)));
+    scene.BuildAccelerationStructure();
+    Camera camera(Vector3D({-4.0, 0.0, 0.5}), Vector3D({1.0, 0.0, 0.0}), Renderer::Type::PATH_TRACER);
+    camera.SetResolution(16, 12);
+    camera.SetFramesPerSecond(10.0);
+    camera.SetSamplesPerPixel(2);
+    camera.SetScheduler(Camera::Scheduler::TILES, 4);
+    camera.SetParallelFrames(true);
+    InterruptedSink sink;
+    sink.maximumFrames = 3;
+    // A checkpoint directory that cannot be created, so that saving the checkpoint of the first finished tile fails
+    const std::string filepath = (std::filesystem::temp_directory_path() / "test_camera_not_a_directory").string();
+    std::ofstream(filepath) << "file";
+    Camera failingCheckpoints = camera;
+    failingCheckpoints.SetCheckpointInterval(1e-9, filepath + "/checkpoints");
+    // ACT & ASSERT
+    EXPECT_THROW(camera.RenderVideo(scene, 1.0, {&sink}, false), std::runtime_error);
+    EXPECT_EQ(sink.frames.size(), 3);
+    EXPECT_THROW(failingCheckpoints.RenderImage(scene), std::filesystem::filesystem_error);
+    std::filesystem::remove(filepath);
+}
+
+TEST(TestCamera, ResumedVideoContinuesAfterLastFinishedFrame) {
+    // ARRANGE
+    auto createScene = [] {
+        Scene scene;
+        auto sphere = std::make_shared<ObjectPrimitive>("Sphere", Material(Color(0.8, 0.5, 0.2)), std::make_shared<Geometry::Sphere>(Vector3D({0.0, -1.0, 0.0}), 0.5));
+        sphere->SetVelocity(Vector3D({0.0, 1.0, 0.0}));
+        scene.AddObject(sphere);
+        scene.BuildAccelerationStructure();
+        return scene;
+    };
+    const std::string directory = (std::filesystem::temp_directory_path() / "test_camera_video_checkpoints").string();
+    Camera camera(Vector3D({-4.0, 0.0, 0.5}), Vector3D({1.0, 0.0, 0.0}), Renderer::Type::PATH_TRACER);
+    camera.SetResolution(16, 12);
+    camera.SetFramesPerSecond(10.0);
+    camera.SetSamplesPerPixel(2);
+    camera.SetSeed(7);
+    Camera uninterruptedCamera = camera;
+    Camera rarelySavedCamera = camera;
+    rarelySavedCamera.SetCheckpointInterval(1000.0, directory);
+    camera.SetCheckpointInterval(1e-9, directory);
+    Camera resumedCamera = camera;
+    resumedCamera.SetSeed(8);  // The seed of the checkpoint applies
+    resumedCamera.SetResume(true);
+    Scene scene = createScene();
+    Scene uninterruptedScene = createScene();
+    Scene resumedScene = createScene();
+    RecordingSink uninterrupted;
+    InterruptedSink sink;
+    sink.maximumFrames = 3;
+    uninterruptedCamera.RenderVideo(uninterruptedScene, 1.0, {&uninterrupted}, false);
+    // The first checkpoint of a video is due after the interval
+    Scene rarelySavedScene = createScene();
+    EXPECT_THROW(rarelySavedCamera.RenderVideo(rarelySavedScene, 1.0, {&sink}, false), std::runtime_error);
+    EXPECT_TRUE(!std::filesystem::exists(directory) || std::filesystem::is_empty(directory));
+    sink.frames.clear();
+    EXPECT_THROW(camera.RenderVideo(scene, 1.0, {&sink}, false), std::runtime_error);
+    // ACT
+    sink.maximumFrames = 10;
+    resumedCamera.RenderVideo(resumedScene, 1.0, {&sink}, false);
+    // ASSERT
+    ASSERT_EQ(sink.frames.size(), 10);
+    for (std::size_t i = 0; i < sink.frames.size(); i++) {
+        for (std::size_t y = 0; y < 12; y++) {
+            for (std::size_t x = 0; x < 16; x++) {
+                EXPECT_EQ(sink.frames[i].GetPixel(x, y), uninterrupted.frames[i].GetPixel(x, y));
+            }
+        }
+    }
+    EXPECT_DOUBLE_EQ(resumedScene.GetTime(), 1.0);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(TestCamera, MergedShardsMatchSingleRender) {
+    // ARRANGE
+    Scene scene = CreateSphereAndLampScene();
+    const std::string directory = (std::filesystem::temp_directory_path() / "test_camera_shards").string();
+    Camera camera = CreateCameraFacingScene();
+    camera.SetResolution(24, 16);
+    camera.SetSamplesPerPixel(4);
+    camera.SetScheduler(Camera::Scheduler::TILES, 8);
+    camera.SetDenoisingMethod(Denoiser::Method::JOINT_BILATERAL_FILTER);
+    camera.SetSeed(7);
+    camera.SetShardDirectory(directory);
+    Image single = camera.RenderImage(scene);
+    for (std::size_t shard = 0; shard < 3; shard++) {
+        Camera shardCamera = camera;
+        shardCamera.SetShard(shard, 3);
+        shardCamera.RenderImage(scene);
+    }
+    // ACT
+    Image merged = camera.MergeImageShards(scene);
+    // ASSERT
+    for (std::size_t y = 0; y < 16; y++) {
+        for (std::size_t x = 0; x < 24; x++) {
+            EXPECT_EQ(merged.GetPixel(x, y), single.GetPixel(x, y));
+        }
+    }
+    // The first shard only stores the upper row of tiles
+    EXPECT_LT(std::filesystem::file_size(directory + "/image_shard_0_of_3.shard"), AccumulationBuffer::SerializedSize(24, 16, false));
+    std::filesystem::remove(directory + "/image_shard_1_of_3.shard");
+    EXPECT_THROW(camera.MergeImageShards(scene), std::runtime_error);
+    EXPECT_THROW(camera.SetShard(3, 3), std::invalid_argument);
+    EXPECT_THROW(camera.SetShard(0, 1), std::invalid_argument);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(TestCamera, ShardsOfEarlierRenderAreLeftOut) {
+    // ARRANGE
+    Scene scene = CreateSphereAndLampScene();
+    const std::string directory = (std::filesystem::temp_directory_path() / "test_camera_stale_shards").string();
+    const std::string staleCopy = directory + "_stale.shard";
+    std::filesystem::remove_all(directory);
+    Camera camera(Vector3D({-4.0, 0.0, 0.5}), Vector3D({1.0, 0.0, 0.0}), Renderer::Type::PATH_TRACER);
+    camera.SetResolution(24, 16);
+    camera.SetSamplesPerPixel(2);
+    camera.SetUseAntiAliasing(true);
+    camera.SetScheduler(Camera::Scheduler::TILES, 8);
+    camera.SetSeed(7);
+    camera.SetShardDirectory(directory);
+    Image single = camera.RenderImage(scene);
+    auto renderShards = [&](std::size_t count) {
+        for (std::size_t shard = 0; shard < count; shard++) {
+            Camera shardCamera = camera;
+            shardCamera.SetShard(shard, count);
+            shardCamera.RenderImage(scene);
+        }
+    };
+    renderShards(3);
+    std::filesystem::copy_file(directory + "/image_shard_0_of_3.shard", staleCopy, std::filesystem::copy_options::overwrite_existing);
+    // ACT
+    renderShards(2);
+    Image merged = camera.MergeImageShards(scene);
+    // Stale shards copied in with the new ones are older than them
+    std::filesystem::copy_file(staleCopy, directory + "/image_shard_0_of_3.shard");
+    std::filesystem::last_write_time(directory + "/image_shard_0_of_3.shard", std::filesystem::last_write_time(directory + "/image_shard_0_of_2.shard") - std::chrono::hours(1));
+    Image mergedWithStale = camera.MergeImageShards(scene);
+    // ASSERT
+    for (std::size_t y = 0; y < 16; y++) {
+        for (std::size_t x = 0; x < 24; x++) {
+            EXPECT_EQ(merged.GetPixel(x, y), single.GetPixel(x, y));
+            EXPECT_EQ(mergedWithStale.GetPixel(x, y), single.GetPixel(x, y));
+        }
+    }
+    std::filesystem::remove_all(directory);
+    std::filesystem::remove(staleCopy);
+}
+
+TEST(TestCamera, MergedVideoShardsMatchSingleRender) {
+    // ARRANGE
+    auto createScene = [] {
+        Scene scene;
+        auto sphere = std::make_shared<ObjectPrimitive>("Sphere", Material(Color(0.8, 0.5, 0.2)), std::make_shared<Geometry::Sphere>(Vector3D({0.0, -1.0, 0.0}), 0.5));
+        sphere->SetVelocity(Vector3D({0.0, 1.0, 0.0}));
+        scene.AddObject(sphere);
+        scene.BuildAccelerationStructure();
+        return scene;
+    };
+    const std::string directory = (std::filesystem::temp_directory_path() / "test_camera_video_shards").string();
+    Camera camera(Vector3D({-4.0, 0.0, 0.5}), Vector3D({1.0, 0.0, 0.0}), Renderer::Type::PATH_TRACER);
+    camera.SetResolution(16, 12);
+    camera.SetFramesPerSecond(10.0);
+    camera.SetSamplesPerPixel(2);
+    camera.SetVelocity(Vector3D({0.0, 0.0, 0.1}));
+    camera.SetSeed(7);
+    camera.SetShardDirectory(directory);
+    Camera singleCamera = camera;
+    Camera mergeCamera = camera;
+    Scene singleScene = createScene();
+    Scene mergeScene = createScene();
+    RecordingSink single;
+    RecordingSink merged;
+    singleCamera.RenderVideo(singleScene, 1.0, {&single}, false);
+    for (std::size_t shard = 0; shard < 2; shard++) {
+        Camera shardCamera = camera;
+        Scene shardScene = createScene();
+        shardCamera.SetShard(shard, 2);
+        shardCamera.RenderVideo(shardScene, 1.0, {}, false);
+    }
+    // ACT
+    mergeCamera.MergeVideoShards(mergeScene, 1.0, {&merged}, false);
+    // ASSERT
+    ASSERT_EQ(merged.frames.size(), 10);
+    for (std::size_t i = 0; i < merged.frames.size(); i++) {
+        for (std::size_t y = 0; y < 12; y++) {
+            for (std::size_t x = 0; x < 16; x++) {
+                EXPECT_EQ(merged.frames[i].GetPixel(x, y), single.frames[i].GetPixel(x, y));
+            }
+        }
+    }
+    EXPECT_DOUBLE_EQ(mergeScene.GetTime(), 1.0);
+    std::filesystem::remove(directory + "/video_frame_000007.shard");
+    EXPECT_THROW(camera.MergeVideoShards(mergeScene, 1.0, {}, false), std::runtime_error);
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+
+#include "Rendering/RenderCheckpoint.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+using namespace Raytracer;
+
+TEST(TestRenderCheckpoint, SaveAndLoad) {
+    // ARRANGE
+    const std::string filepath = (std::filesystem::temp_directory_path() / "test_render_checkpoint.checkpoint").string();
+    RenderCheckpoint checkpoint;
+    checkpoint.seed = 42;
+    checkpoint.frame = 3;
+    checkpoint.width = 4;
+    checkpoint.height = 2;
+    checkpoint.samplesPerPixel = 16;
+    checkpoint.tileSize = 2;
+    checkpoint.completedTiles = {true, false};
+    checkpoint.elapsedSeconds = 1.5;
+    checkpoint.accumulation.emplace(4, 2);
+    checkpoint.accumulation->AddSamples(3, 1, Color(2.0, 4.0, 6.0), 2);
+
+    // ACT
+    checkpoint.Save(filepath);
+    auto loaded = RenderCheckpoint::Load(filepath);
+
+    // ASSERT
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->seed, 42);
+    EXPECT_EQ(loaded->frame, 3);
+    EXPECT_EQ(loaded->width, 4);
+    EXPECT_EQ(loaded->height, 2);
+    EXPECT_EQ(loaded->samplesPerPixel, 16);
+    EXPECT_EQ(loaded->tileSize, 2);
+    EXPECT_EQ(loaded->completedPasses, 0);
+    EXPECT_EQ(loaded->completedTiles, std::vector<bool>({true, false}));
+    EXPECT_DOUBLE_EQ(loaded->elapsedSeconds, 1.5);
+    ASSERT_TRUE(loaded->accumulation.has_value());
+    EXPECT_EQ(loaded->accumulation->GetSampleCount(3, 1), 2);
+    EXPECT_EQ(loaded->accumulation->GetMean(3, 1), Color(1.0, 2.0, 3.0));
+    std::filesystem::remove(filepath);
+}
+
+TEST(TestRenderCheckpoint, LoadMissingOrInvalidFile) {
+    // ARRANGE
+    const std::string filepath = (std::filesystem::temp_directory_path() / "test_render_checkpoint_invalid.checkpoint").string();
+    std::filesystem::remove(filepath);
+    // ACT & ASSERT
+    EXPECT_FALSE(RenderCheckpoint::Load(filepath).has_value());
+    std::ofstream(filepath) << "not a checkpoint";
+    EXPECT_THROW(RenderCheckpoint::Load(filepath), std::runtime_error);
+    std::filesystem::remove(filepath);
+}
+
+TEST(TestRenderCheckpoint, LoadCorruptFile) {
+    // ARRANGE
+    const std::string filepath = (std::filesystem::temp_directory_path() / "test_render_checkpoint_corrupt.checkpoint").string();
+    RenderCheckpoint checkpoint;
+    checkpoint.width = 4;
+    checkpoint.height = 2;
+    checkpoint.tileSize = 2;
+    checkpoint.completedTiles = {true, false};
+    checkpoint.accumulation.emplace(4, 2);
+    checkpoint.Save(filepath);
+    const std::size_t fileSize = std::filesystem::file_size(filepath);
+    // Overwrites a 64-bit field of the saved checkpoint at the given byte offset
+    auto overwrite = [&](std::streamoff offset, std::uint64_t value) {
+        checkpoint.Save(filepath);
+        std::fstream file(filepath, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    const std::streamoff widthOffset = 8 + 2 * sizeof(std::uint64_t);
+    const std::streamoff tilesOffset = 8 + 7 * sizeof(std::uint64_t) + sizeof(double);
+    const std::streamoff endRowOffset = tilesOffset + sizeof(std::uint64_t) + 2 + sizeof(std::uint64_t) + 3 * sizeof(std::uint64_t);
+
+    // ACT & ASSERT
+    std::filesystem::resize_file(filepath, fileSize - 1);
+    EXPECT_THROW(RenderCheckpoint::Load(filepath), std::runtime_error);
+    overwrite(tilesOffset, std::uint64_t(1) << 60);
+    EXPECT_THROW(RenderCheckpoint::Load(filepath), std::runtime_error);
+    overwrite(tilesOffset, 3);
+    EXPECT_THROW(RenderCheckpoint::Load(filepath), std::runtime_error);
+    overwrite(widthOffset, std::uint64_t(1) << 40);
+    EXPECT_THROW(RenderCheckpoint::Load(filepath), std::runtime_error);
+    overwrite(widthOffset, 4);
+    overwrite(endRowOffset, 3);
+    EXPECT_THROW(RenderCheckpoint::Load(filepath), std::runtime_error);
+    overwrite(endRowOffset, 2);
+    EXPECT_TRUE(RenderCheckpoint::Load(filepath).has_value());
+    std::filesystem::remove(filepath);
+}
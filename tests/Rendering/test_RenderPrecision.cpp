@@ -0,0 +1,85 @@
+#include "gtest/gtest.h"
+
+#include "Geometry/Shapes.hpp"
+#include "Rendering/Camera.hpp"
+#include "Utilities/MaterialFactory.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+using namespace Raytracer;
+
+namespace {
+
+// Reference image of RenderTestScene(), rendered in a double precision build, stored as binary PPM
+const std::string kReferenceImage = "Rendering/reference/render_precision.ppm";
+
+Image RenderTestScene() {
+    Scene scene(Color(0.1, 0.1, 0.2));
+    const Material diffuse(Color(0.8, 0.5, 0.2));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Floor", Material(Color(0.7, 0.7, 0.7)), std::make_shared<Geometry::Rectangle>(Vector3D({0.0, 0.0, -1.0}), Vector3D({0.0, 0.0, 1.0}), Vector3D({1.0, 0.0, 0.0}), 10.0, 10.0)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Sphere", diffuse, std::make_shared<Geometry::Sphere>(Vector3D({0.5, 1.2, -0.4}), 0.6)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Glass", MaterialFactory::CreateGlass(), std::make_shared<Geometry::Sphere>(Vector3D({-0.5, -1.2, -0.4}), 0.6)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Torus", MaterialFactory::CreateGold(), std::make_shared<Geometry::Torus>(Vector3D({1.0, 0.0, 0.0}), Vector3D({1.0, 0.0, 1.0}), 0.6, 0.2)));
+
+    Geometry::Mesh::Buffers buffers;
+    buffers.AddVertex(Vector3D({0.0, 0.0, 0.0}));
+    buffers.AddVertex(Vector3D({0.8, 0.0, 0.0}));
+    buffers.AddVertex(Vector3D({0.0, 0.8, 0.0}));
+    buffers.AddVertex(Vector3D({0.0, 0.0, 0.8}));
+    buffers.AddTriangle(0, 2, 1);
+    buffers.AddTriangle(0, 1, 3);
+    buffers.AddTriangle(0, 3, 2);
+    buffers.AddTriangle(1, 2, 3);
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Mesh", diffuse, std::make_shared<Geometry::Mesh>(buffers, Vector3D({2.0, -1.5, -1.0}))));
+
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Lamp", Material(Color(1.0, 1.0, 1.0), 1.0, 1.0, 0.0, 5.0), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 3.0}), 0.5)));
+    scene.BuildAccelerationStructure();
+
+    Camera camera(Vector3D({-3.0, 0.0, 0.3}), Vector3D({1.0, 0.0, -0.2}), Renderer::Type::PATH_TRACER_NEE);
+    camera.SetFieldOfView(60.0);
+    camera.SetResolution(64, 48);
+    camera.SetSamplesPerPixel(16);
+    camera.SetUseAntiAliasing(true);
+    camera.SetSeed(17);
+    return camera.RenderImage(scene);
+}
+
+}  // namespace
+
+TEST(TestRenderPrecision, RenderAgreesWithDoublePrecisionReference) {
+    // ARRANGE
+    Image reference(kReferenceImage, false);
+
+    // ACT
+    Image image = RenderTestScene();
+
+    // ASSERT
+    ASSERT_EQ(image.GetWidth(), reference.GetWidth());
+    ASSERT_EQ(image.GetHeight(), reference.GetHeight());
+    double meanDifference = 0.0;
+    double luminance = 0.0;
+    double referenceLuminance = 0.0;
+    for (std::size_t y = 0; y < image.GetHeight(); y++) {
+        for (std::size_t x = 0; x < image.GetWidth(); x++) {
+            const auto rgb = image.GetPixel(x, y).GetRGB255();
+            const Color pixel(rgb[0] / 255.0, rgb[1] / 255.0, rgb[2] / 255.0);
+            const Color difference = pixel - reference.GetPixel(x, y);
+            meanDifference += std::max({std::abs(difference.R()), std::abs(difference.G()), std::abs(difference.B())});
+            luminance += pixel.Luminance();
+            referenceLuminance += reference.GetPixel(x, y).Luminance();
+        }
+    }
+    meanDifference /= image.GetWidth() * image.GetHeight();
+
+    if constexpr (kSinglePrecision) {
+        // Paths diverge after the first rounding difference, so only the noise level may differ, but no surface may turn dark from self-intersections
+        EXPECT_LT(meanDifference, 0.05);
+        EXPECT_NEAR(luminance / referenceLuminance, 1.0, 0.02);
+    } else {
+        // The same random numbers along the same paths, up to the 8 bit quantization of the reference
+        EXPECT_LT(meanDifference, 1e-6);
+        EXPECT_NEAR(luminance / referenceLuminance, 1.0, 1e-6);
+    }
+}
@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+
+#include "Geometry/Shapes.hpp"
+#include "Rendering/RenderStatistics.hpp"
+#include "Rendering/RendererPathTracerNEE.hpp"
+#include "Scene/ObjectPrimitive.hpp"
+#include "Scene/Scene.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace Raytracer;
+
+TEST(TestRenderStatistics, CollectMergesAllThreads) {
+    // ARRANGE
+    RenderStatistics::Reset();
+    // ACT
+    std::thread worker([] {
+        RenderStatistics::CountPrimaryRays(3);
+        RenderStatistics::CountIntersectionTests(Geometry::Shape::Type::SPHERE, 5);
+    });
+    worker.join();
+    RenderStatistics::CountPrimaryRays(1);
+    RenderStatistics::CountBounceRays(6);
+    RenderStatistics::CountRussianRouletteTermination();
+    // ASSERT
+    auto counters = RenderStatistics::Collect();
+    EXPECT_EQ(counters.primaryRays, 4);
+    EXPECT_EQ(counters.bounceRays, 6);
+    EXPECT_EQ(counters.russianRouletteTerminations, 1);
+    EXPECT_EQ(counters.intersectionTests[static_cast<std::size_t>(Geometry::Shape::Type::SPHERE)], 5);
+    EXPECT_DOUBLE_EQ(counters.AveragePathDepth(), 1.5);
+
+    RenderStatistics::Reset();
+    EXPECT_EQ(RenderStatistics::Collect().primaryRays, 0);
+}
+
+TEST(TestRenderStatistics, CountsRaysOfPathTracer) {
+    // ARRANGE
+    Scene scene(Color(0.5, 0.5, 0.5));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Floor", Material(Color(0.8, 0.8, 0.8)), std::make_shared<Geometry::Disk>(Vector3D({0.0, 0.0, 0.0}), Vector3D({0.0, 0.0, 1.0}), 10.0)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Lamp", Material(Color(1.0, 1.0, 1.0), 1.0, 1.0, 0.0, 5.0), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 3.0}), 0.5)));
+    RendererPathTracerNEE renderer;
+    RenderStatistics::Reset();
+    // ACT
+    const std::size_t numberOfRays = 100;
+    for (std::size_t i = 0; i < numberOfRays; i++) {
+        Sampler sampler(1, 0, i, 0, 0);
+        renderer.TraceRay(Ray(Vector3D({0.0, 0.0, 1.0}), Vector3D({0.0, 0.0, -1.0})), scene, sampler);
+    }
+    // ASSERT
+    auto counters = RenderStatistics::Collect();
+    EXPECT_EQ(counters.primaryRays, numberOfRays);
+    EXPECT_GE(counters.bounceRays, numberOfRays);
+    EXPECT_GE(counters.shadowRays, numberOfRays);
+    EXPECT_GT(counters.intersectionTests[static_cast<std::size_t>(Geometry::Shape::Type::DISK)], 0);
+    EXPECT_GT(counters.intersectionTests[static_cast<std::size_t>(Geometry::Shape::Type::SPHERE)], 0);
+    EXPECT_GE(counters.AveragePathDepth(), 1.0);
+}
+
+TEST(TestRenderStatistics, GBufferRaysAreNotCounted) {
+    // ARRANGE
+    Scene scene(Color(0.5, 0.5, 0.5));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Floor", Material(Color(0.8, 0.8, 0.8)), std::make_shared<Geometry::Disk>(Vector3D({0.0, 0.0, 0.0}), Vector3D({0.0, 0.0, 1.0}), 10.0)));
+    RendererPathTracerNEE renderer;
+    std::vector<Ray> rays(10, Ray(Vector3D({0.0, 0.0, 1.0}), Vector3D({0.0, 0.0, -1.0})));
+    std::vector<GBufferData> gBuffer(rays.size());
+    RenderStatistics::Reset();
+    // ACT
+    renderer.ComputeGBuffer(rays.front(), scene);
+    renderer.ComputeGBuffer(rays, scene, gBuffer);
+    // ASSERT
+    EXPECT_TRUE(gBuffer.back().hit);
+    EXPECT_EQ(RenderStatistics::Collect().primaryRays, 0);
+}
+
+TEST(TestRenderStatistics, Save) {
+    // ARRANGE
+    RenderStatistics::Reset();
+    RenderStatistics::CountShadowRays(7);
+    RenderStatistics::AddTime(RenderStatistics::Stage::DENOISE, 0.25);
+    RenderStatistics::AddSamples(4, 10, 4);
+    std::string filepath = (std::filesystem::temp_directory_path() / "test_render_statistics.json").string();
+    // ACT
+    bool saved = RenderStatistics::Save(filepath);
+    // ASSERT
+    ASSERT_TRUE(saved);
+    std::ifstream file(filepath);
+    std::stringstream content;
+    content << file.rdbuf();
+    EXPECT_NE(content.str().find("\"shadow_rays\": 7"), std::string::npos);
+    EXPECT_NE(content.str().find("\"denoise\": 0.25"), std::string::npos);
+    EXPECT_NE(content.str().find("\"samples_per_pixel\": {\"average\": 2.5, \"maximum\": 4}"), std::string::npos);
+    EXPECT_NE(content.str().find("\"Sphere\": 0"), std::string::npos);
+    std::filesystem::remove(filepath);
+}
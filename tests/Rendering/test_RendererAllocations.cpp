@@ -0,0 +1,162 @@
+#include "gtest/gtest.h"
+
+#include "Geometry/Shapes.hpp"
+#include "Rendering/RendererDeterministic.hpp"
+#include "Rendering/RendererPathTracer.hpp"
+#include "Rendering/RendererPathTracerNEE.hpp"
+#include "Rendering/RendererPathTracerWavefront.hpp"
+#include "Rendering/RendererRayTracer.hpp"
+#include "Rendering/RendererSimple.hpp"
+#include "Utilities/MaterialFactory.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Count every heap allocation made by this test executable. All forms of new and delete are replaced together, so that every
+// allocation is counted and released by the matching function.
+namespace {
+std::atomic<std::size_t> sNumberOfAllocations{0};
+
+void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) {
+    sNumberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+    size = std::max<std::size_t>(size, 1);
+    void* pointer = alignment <= alignof(std::max_align_t) ? std::malloc(size) : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void Deallocate(void* pointer) noexcept {
+    std::free(pointer);
+}
+}  // namespace
+
+void* operator new(std::size_t size) {
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept {
+    Deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    Deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    Deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    Deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    Deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    Deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+    Deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+    Deallocate(pointer);
+}
+
+using namespace Raytracer;
+
+namespace {
+
+Scene CreateSceneWithAllShapeFamilies() {
+    Scene scene(Color(0.1, 0.1, 0.2));
+    const Material diffuse(Color(0.8, 0.5, 0.2));
+
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Floor", diffuse, std::make_shared<Geometry::Rectangle>(Vector3D({0.0, 0.0, -1.0}), Vector3D({0.0, 0.0, 1.0}), Vector3D({1.0, 0.0, 0.0}), 10.0, 10.0)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Sphere", MaterialFactory::CreateGlass(), std::make_shared<Geometry::Sphere>(Vector3D({0.0, -1.5, 0.0}), 0.6)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Cone", diffuse, std::make_shared<Geometry::Cone>(Vector3D({0.0, 1.5, -1.0}), Vector3D({0.0, 0.0, 1.0}), 0.5, 1.2)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Torus", MaterialFactory::CreateGold(), std::make_shared<Geometry::Torus>(Vector3D({1.0, 0.0, 0.0}), Vector3D({1.0, 0.0, 1.0}), 0.6, 0.2)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Pipe", diffuse, std::make_shared<Geometry::HalfTorusWithSphericalCaps>(Vector3D({-1.0, 0.0, 0.0}), Vector3D({0.0, 1.0, 0.0}), Vector3D({1.0, 0.0, 0.0}), 0.5, 0.15)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Box", diffuse, std::make_shared<Geometry::Box>(Vector3D({1.0, 1.5, -0.5}), Vector3D({0.0, 0.0, 1.0}), Vector3D({1.0, 0.0, 0.0}), 0.5, 0.5, 0.5)));
+
+    Geometry::Mesh::Buffers buffers;
+    buffers.AddVertex(Vector3D({0.0, 0.0, 0.0}));
+    buffers.AddVertex(Vector3D({0.5, 0.0, 0.0}));
+    buffers.AddVertex(Vector3D({0.0, 0.5, 0.0}));
+    buffers.AddVertex(Vector3D({0.0, 0.0, 0.5}));
+    buffers.AddTriangle(0, 2, 1);
+    buffers.AddTriangle(0, 1, 3);
+    buffers.AddTriangle(0, 3, 2);
+    buffers.AddTriangle(1, 2, 3);
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Mesh", diffuse, std::make_shared<Geometry::Mesh>(buffers, Vector3D({1.0, -1.5, -0.5}))));
+
+    // Light sources with analytic, composite, and rejection sampled surfaces
+    const Material lamp(Color(1.0, 1.0, 1.0), 1.0, 1.0, 0.0, 5.0);
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Lamp", lamp, std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 3.0}), 0.5)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Box lamp", lamp, std::make_shared<Geometry::BoxAxisAligned>(Vector3D({-2.0, 2.0, 2.0}), 0.3, 0.3, 0.3)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Torus lamp", lamp, std::make_shared<Geometry::Torus>(Vector3D({2.0, -2.0, 2.0}), Vector3D({0.0, 0.0, 1.0}), 0.3, 0.1)));
+    return scene;
+}
+
+// Trace a fan of rays from a point in front of the scene through all objects
+void TraceRays(Renderer& renderer, const Scene& scene, std::uint64_t seed) {
+    for (std::size_t y = 0; y < 24; y++) {
+        for (std::size_t x = 0; x < 32; x++) {
+            Vector3D direction({1.0, static_cast<Real>(-0.8 + 0.05 * x), static_cast<Real>(-0.6 + 0.05 * y)});
+            Sampler sampler(seed, 0, x, y, 0);
+            renderer.TraceRay(Ray(Vector3D({-5.0, 0.0, 0.5}), direction.Normalized()), scene, sampler);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(TestRendererAllocations, TraceRayDoesNotAllocateInSteadyState) {
+    // ARRANGE
+    std::vector<std::unique_ptr<Renderer>> renderers;
+    renderers.push_back(std::make_unique<RendererSimple>());
+    renderers.push_back(std::make_unique<RendererDeterministic>());
+    renderers.push_back(std::make_unique<RendererRayTracer>());
+    renderers.push_back(std::make_unique<RendererPathTracer>());
+    renderers.push_back(std::make_unique<RendererPathTracerNEE>());
+    renderers.push_back(std::make_unique<RendererPathTracerWavefront>());
+
+    for (auto accelerator : {Scene::Accelerator::BVH, Scene::Accelerator::LINEAR}) {
+        Scene scene = CreateSceneWithAllShapeFamilies();
+        scene.SetAccelerator(accelerator);
+        scene.BuildAccelerationStructure();
+        for (auto& renderer : renderers) {
+            // Warm up lazily computed caches, e.g. bounding boxes and key points
+            TraceRays(*renderer, scene, 1);
+
+            // ACT
+            const std::size_t allocationsBefore = sNumberOfAllocations.load();
+            TraceRays(*renderer, scene, 2);
+            const std::size_t allocations = sNumberOfAllocations.load() - allocationsBefore;
+
+            // ASSERT
+            EXPECT_EQ(allocations, 0) << renderer->GetTypeString();
+        }
+    }
+}
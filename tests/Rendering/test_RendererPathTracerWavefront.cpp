@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+
+#include "Geometry/Shapes.hpp"
+#include "Rendering/RendererPathTracerNEE.hpp"
+#include "Rendering/RendererPathTracerWavefront.hpp"
+#include "Utilities/MaterialFactory.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace Raytracer;
+
+TEST(TestRendererPathTracerWavefront, WavefrontAgreesWithMegakernel) {
+    // ARRANGE
+    Scene scene(Color(0.1, 0.1, 0.2));
+    const Material diffuse(Color(0.8, 0.5, 0.2));
+    const Material lamp(Color(1.0, 1.0, 1.0), 1.0, 1.0, 0.0, 5.0);
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Floor", diffuse, std::make_shared<Geometry::Rectangle>(Vector3D({0.0, 0.0, -1.0}), Vector3D({0.0, 0.0, 1.0}), Vector3D({1.0, 0.0, 0.0}), 10.0, 10.0)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Glass sphere", MaterialFactory::CreateGlass(), std::make_shared<Geometry::Sphere>(Vector3D({0.0, -1.5, 0.0}), 0.6)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Gold torus", MaterialFactory::CreateGold(), std::make_shared<Geometry::Torus>(Vector3D({1.0, 0.0, 0.0}), Vector3D({1.0, 0.0, 1.0}), 0.6, 0.2)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Box", diffuse, std::make_shared<Geometry::Box>(Vector3D({1.0, 1.5, -0.5}), Vector3D({0.0, 0.0, 1.0}), Vector3D({1.0, 0.0, 0.0}), 0.5, 0.5, 0.5)));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Lamp", lamp, std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 3.0}), 0.5)));
+    scene.BuildAccelerationStructure();
+
+    // Primary rays of a 96 x 64 image, row by row, with one random number stream per pixel
+    const std::size_t width = 96;
+    const std::size_t height = 64;
+    std::vector<Ray> rays;
+    std::vector<Sampler> megakernelSamplers;
+    for (std::size_t y = 0; y < height; y++) {
+        for (std::size_t x = 0; x < width; x++) {
+            Vector3D direction({1.0, static_cast<Real>(-0.8 + 1.6 * x / width), static_cast<Real>(-0.6 + 1.2 * y / height)});
+            rays.emplace_back(Vector3D({-5.0, 0.0, 0.5}), direction.Normalized());
+            megakernelSamplers.emplace_back(42, 0, x, y, 0);
+        }
+    }
+    std::vector<Sampler> wavefrontSamplers = megakernelSamplers;
+    std::vector<Color> megakernelColors(rays.size());
+    std::vector<Color> wavefrontColors(rays.size());
+    RendererPathTracerNEE megakernel;
+    RendererPathTracerWavefront wavefront;
+
+    // ACT
+    for (std::size_t i = 0; i < rays.size(); i++) {
+        megakernelColors[i] = megakernel.TraceRay(rays[i], scene, megakernelSamplers[i]);
+    }
+    wavefront.TraceRays(rays, scene, wavefrontSamplers, wavefrontColors);
+
+    // ASSERT
+    // Both renderers draw the same random numbers for every path. Only the packet traced primary hits may differ in the last bits,
+    // which in single precision can change the random decisions along a few paths.
+    std::size_t differingPaths = 0;
+    for (std::size_t i = 0; i < rays.size(); i++) {
+        differingPaths += (wavefrontColors[i] - megakernelColors[i]).Length() > 1e-9 * (1.0 + megakernelColors[i].Length());
+    }
+    EXPECT_LE(differingPaths, kSinglePrecision ? rays.size() / 50 : 0);
+}
+
+TEST(TestRendererPathTracerWavefront, TraceRayTracesASinglePath) {
+    // ARRANGE
+    Scene scene(Color(0.1, 0.2, 0.3));
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Floor", Material(Color(0.8, 0.8, 0.8)), std::make_shared<Geometry::Rectangle>(Vector3D({0.0, 0.0, -1.0}), Vector3D({0.0, 0.0, 1.0}), Vector3D({1.0, 0.0, 0.0}), 10.0, 10.0)));
+    Ray ray(Vector3D({0.0, 0.0, 1.0}), Vector3D({0.0, 0.6, -0.8}));
+    Sampler megakernelSampler(7, 0, 0, 0, 0);
+    Sampler wavefrontSampler(7, 0, 0, 0, 0);
+    RendererPathTracerNEE megakernel;
+    RendererPathTracerWavefront wavefront;
+
+    // ACT
+    Color megakernelColor = megakernel.TraceRay(ray, scene, megakernelSampler);
+    Color wavefrontColor = wavefront.TraceRay(ray, scene, wavefrontSampler);
+
+    // ASSERT
+    EXPECT_NEAR(wavefrontColor.R(), megakernelColor.R(), 1e-12);
+    EXPECT_NEAR(wavefrontColor.G(), megakernelColor.G(), 1e-12);
+    EXPECT_NEAR(wavefrontColor.B(), megakernelColor.B(), 1e-12);
+}
@@ -1,7 +1,11 @@
 #include "gtest/gtest.h"
 
+#include "Geometry/Shapes.hpp"
 #include "Rendering/RendererSimple.hpp"
 
+#include <memory>
+#include <vector>
+
 using namespace Raytracer;
 
 TEST(TestRendererSimple, Test1) {
@@ -9,3 +13,46 @@ TEST(TestRendererSimple, Test1) {
     // ACT
     // ASSERT
 }
+
+TEST(TestRendererSimple, PacketTracingMatchesScalar) {
+    // ARRANGE
+    Scene scene(Color(0.1, 0.2, 0.3));
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 5; j++) {
+            Vector3D position({10.0, static_cast<Real>(2.0 * i - 4.0), static_cast<Real>(2.0 * j - 4.0)});
+            Material material(Color(0.2 * i, 0.2 * j, 0.5));
+            if ((i + j) % 2 == 0) {
+                scene.AddObject(std::make_shared<ObjectPrimitive>("Sphere", material, std::make_shared<Geometry::Sphere>(position, 0.8)));
+            } else {
+                scene.AddObject(std::make_shared<ObjectPrimitive>("Disk", material, std::make_shared<Geometry::Disk>(position, Vector3D({-1.0, 0.0, 0.0}), 0.8)));
+            }
+        }
+    }
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Floor", Material(), std::make_shared<Geometry::Rectangle>(Vector3D({10.0, 0.0, -6.0}), Vector3D({0.0, 0.0, 1.0}), Vector3D({1.0, 0.0, 0.0}), 30.0, 30.0)));
+    scene.BuildAccelerationStructure();
+
+    // Primary rays of a 256 x 256 image, row by row
+    const std::size_t resolution = 256;
+    std::vector<Ray> rays;
+    for (std::size_t y = 0; y < resolution; y++) {
+        for (std::size_t x = 0; x < resolution; x++) {
+            Vector3D direction({1.0, static_cast<Real>(1.2 - 2.4 * (x + 0.5) / resolution), static_cast<Real>(1.2 - 2.4 * (y + 0.5) / resolution)});
+            rays.emplace_back(Vector3D({0.0, 0.0, 0.0}), direction.Normalized());
+        }
+    }
+    std::vector<Sampler> samplers(rays.size());
+    std::vector<Color> scalarColors(rays.size());
+    std::vector<Color> packetColors(rays.size());
+    RendererSimple renderer;
+
+    // ACT
+    for (std::size_t i = 0; i < rays.size(); i++) {
+        scalarColors[i] = renderer.TraceRay(rays[i], scene, samplers[i]);
+    }
+    renderer.TraceRays(rays, scene, samplers, packetColors);
+
+    // ASSERT
+    for (std::size_t i = 0; i < rays.size(); i++) {
+        EXPECT_EQ(packetColors[i], scalarColors[i]);
+    }
+}
@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+
+#include "Rendering/TileScheduler.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace Raytracer;
+
+TEST(TestTileScheduler, TilesCoverImage) {
+    // ARRANGE
+    const std::size_t width = 50;
+    const std::size_t height = 37;
+    TileScheduler scheduler(width, height, 16, 1);
+    std::vector<int> coverage(width * height, 0);
+
+    // ACT
+    while (auto tile = scheduler.Next(0)) {
+        for (std::size_t y = tile->yBegin; y < tile->yEnd; y++) {
+            for (std::size_t x = tile->xBegin; x < tile->xEnd; x++) {
+                coverage[y * width + x]++;
+            }
+        }
+    }
+
+    // ASSERT
+    EXPECT_EQ(scheduler.NumberOfTiles(), 4 * 3);
+    for (int count : coverage) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(TestTileScheduler, ConcurrentWorkersGetEveryTileOnce) {
+    // ARRANGE
+    const std::size_t width = 1000;
+    const std::size_t height = 1000;
+    const std::size_t numWorkers = 8;
+    TileScheduler scheduler(width, height, 4, numWorkers);
+    std::vector<std::vector<std::size_t>> tilesPerWorker(numWorkers);
+
+    // ACT
+    std::vector<std::thread> threads;
+    for (std::size_t worker = 0; worker < numWorkers; worker++) {
+        threads.emplace_back([&, worker]() {
+            while (auto tile = scheduler.Next(worker)) {
+                tilesPerWorker[worker].push_back(tile->yBegin * width + tile->xBegin);
+                if (worker == 0) {
+                    std::this_thread::yield();  // A slow worker, whose tiles get stolen
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // ASSERT
+    std::vector<int> count(width * height, 0);
+    std::size_t total = 0;
+    for (const auto& tiles : tilesPerWorker) {
+        for (std::size_t pixel : tiles) {
+            count[pixel]++;
+        }
+        total += tiles.size();
+    }
+    EXPECT_EQ(total, scheduler.NumberOfTiles());
+    for (std::size_t i = 0; i < count.size(); i++) {
+        EXPECT_LE(count[i], 1);
+    }
+}
+
+TEST(TestTileScheduler, ShardsCoverImageOnce) {
+    // ARRANGE
+    const std::size_t width = 50;
+    const std::size_t height = 37;
+    const std::size_t numShards = 5;
+    std::vector<int> coverage(width * height, 0);
+
+    // ACT
+    for (std::size_t shard = 0; shard < numShards; shard++) {
+        TileScheduler scheduler(width, height, 8, 3, shard, numShards);
+        while (auto tile = scheduler.Next(shard % 3)) {
+            EXPECT_GE(tile->index, scheduler.FirstTile());
+            EXPECT_LT(tile->index, scheduler.EndTile());
+            for (std::size_t y = tile->yBegin; y < tile->yEnd; y++) {
+                for (std::size_t x = tile->xBegin; x < tile->xEnd; x++) {
+                    coverage[y * width + x]++;
+                }
+            }
+        }
+    }
+
+    // ASSERT
+    for (int count : coverage) {
+        EXPECT_EQ(count, 1);
+    }
+    EXPECT_THROW(TileScheduler(width, height, 8, 1, numShards, numShards), std::invalid_argument);
+}
+
+TEST(TestTileScheduler, InvalidWorker) {
+    // ARRANGE
+    TileScheduler scheduler(10, 10, 4, 2);
+
+    // ACT & ASSERT
+    EXPECT_THROW(scheduler.Next(2), std::out_of_range);
+}
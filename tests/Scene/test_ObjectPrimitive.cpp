@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 
+#include "Geometry/Shapes/Sphere.hpp"
 #include "Scene/ObjectPrimitive.hpp"
 
 using namespace Raytracer;
@@ -9,3 +10,35 @@ TEST(TestObjectPrimitive, Test1) {
     // ACT
     // ASSERT
 }
+
+TEST(TestObjectPrimitive, IntersectionReferencesPrimitiveWithoutOwnership) {
+    // ARRANGE
+    auto sphere = std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 0.0}), 1.0);
+    auto primitive = std::make_shared<ObjectPrimitive>("Sphere", Material(Color(0.8, 0.5, 0.2)), sphere);
+    Ray ray(Vector3D({-5.0, 0.0, 0.0}), Vector3D({1.0, 0.0, 0.0}));
+
+    // ACT
+    auto intersection = primitive->Intersect(ray);
+
+    // ASSERT
+    ASSERT_TRUE(intersection.has_value());
+    EXPECT_EQ(intersection->object, primitive.get());
+    EXPECT_EQ(primitive.use_count(), 1);
+    EXPECT_DOUBLE_EQ(intersection->t, 4.0);
+}
+
+TEST(TestObjectPrimitive, CloneMovesIndependently) {
+    // ARRANGE
+    auto primitive = std::make_shared<ObjectPrimitive>("Sphere", Material(), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 0.0}), 1.0));
+    primitive->SetVelocity(Vector3D({1.0, 0.0, 0.0}));
+    Ray ray(Vector3D({-5.0, 0.0, 0.0}), Vector3D({1.0, 0.0, 0.0}));
+
+    // ACT
+    auto clone = primitive->Clone();
+    clone->Evolve(2.0);
+
+    // ASSERT
+    EXPECT_NE(std::static_pointer_cast<ObjectPrimitive>(clone)->GetShape(), primitive->GetShape());
+    EXPECT_DOUBLE_EQ(primitive->Intersect(ray)->t, 4.0);
+    EXPECT_DOUBLE_EQ(clone->Intersect(ray)->t, 6.0);
+}
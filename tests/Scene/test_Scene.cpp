@@ -1,7 +1,12 @@
 #include "gtest/gtest.h"
 
+#include "Geometry/Shapes.hpp"
 #include "Scene/Scene.hpp"
 
+#include <memory>
+#include <random>
+#include <vector>
+
 using namespace Raytracer;
 
 TEST(TestScene, Test1) {
@@ -9,3 +14,156 @@ TEST(TestScene, Test1) {
     // ACT
     // ASSERT
 }
+
+TEST(TestScene, Occluded) {
+    for (auto accelerator : {Scene::Accelerator::LINEAR, Scene::Accelerator::BVH}) {
+        // ARRANGE
+        Scene scene;
+        scene.SetAccelerator(accelerator);
+        for (Real x : {2.0, 4.0, 6.0}) {
+            auto sphere = std::make_shared<Geometry::Sphere>(Vector3D({x, 0.0, 0.0}), 0.5);
+            scene.AddObject(std::make_shared<ObjectPrimitive>("Sphere", Material(), sphere));
+        }
+        auto hidden = std::make_shared<Geometry::Sphere>(Vector3D({3.0, 0.0, 0.0}), 0.25);
+        auto hiddenObject = std::make_shared<ObjectPrimitive>("Hidden", Material(), hidden);
+        hiddenObject->SetVisible(false);
+        scene.AddObject(hiddenObject);
+        scene.BuildAccelerationStructure();
+        Ray ray(Vector3D({0.0, 0.0, 0.0}), Vector3D({1.0, 0.0, 0.0}));
+
+        // ACT & ASSERT
+        EXPECT_FALSE(scene.Occluded(ray, 1.4));
+        EXPECT_TRUE(scene.Occluded(ray, 1.6));
+        EXPECT_FALSE(scene.Occluded(ray, 3.4, 2.6));  // Only the invisible sphere lies in between
+        EXPECT_TRUE(scene.Occluded(ray, 10.0, 6.4));  // Exit point of the last sphere
+        EXPECT_FALSE(scene.Occluded(Ray(Vector3D({0.0, 0.0, 0.0}), Vector3D({0.0, 1.0, 0.0})), 100.0));
+    }
+}
+
+TEST(TestScene, PacketIntersectionAgreesWithScalarIntersection) {
+    for (auto accelerator : {Scene::Accelerator::LINEAR, Scene::Accelerator::BVH}) {
+        // ARRANGE
+        Scene scene;
+        scene.SetAccelerator(accelerator);
+        std::mt19937 prng(11);
+        std::uniform_real_distribution<Real> distribution(-3.0, 3.0);
+        for (int i = 0; i < 8; i++) {
+            Vector3D position({distribution(prng), distribution(prng), distribution(prng)});
+            Vector3D orientation = Vector3D({0.0, distribution(prng), 1.0}).Normalized();  // orthogonal to the width direction of the rectangles
+            scene.AddObject(std::make_shared<ObjectPrimitive>("Sphere", Material(), std::make_shared<Geometry::Sphere>(position, 0.5)));
+            scene.AddObject(std::make_shared<ObjectPrimitive>("Disk", Material(), std::make_shared<Geometry::Disk>(position + Vector3D({0.0, 0.0, 1.0}), orientation, 0.7)));
+            scene.AddObject(std::make_shared<ObjectPrimitive>("Rectangle", Material(), std::make_shared<Geometry::Rectangle>(position - Vector3D({0.0, 1.0, 0.0}), orientation, Vector3D({1.0, 0.0, 0.0}), 1.0, 0.5)));
+            scene.AddObject(std::make_shared<ObjectPrimitive>("Triangle", Material(), std::make_shared<Geometry::Triangle>(position, position + Vector3D({1.0, 0.2, 0.0}), position + Vector3D({0.0, 0.3, 1.0}))));
+            scene.AddObject(std::make_shared<ObjectPrimitive>("Box", Material(), std::make_shared<Geometry::BoxAxisAligned>(position + Vector3D({1.0, 0.0, 0.0}), 0.4, 0.4, 0.4)));
+        }
+        scene.BuildAccelerationStructure();
+
+        std::vector<Ray> rays;
+        for (int i = 0; i < 1000; i++) {
+            Vector3D target({distribution(prng), distribution(prng), distribution(prng)});
+            rays.emplace_back(Vector3D({-10.0, 0.0, 0.0}), (target - Vector3D({-10.0, 0.0, 0.0})).Normalized());
+        }
+        std::vector<std::optional<Object::Intersection>> intersections(rays.size());
+
+        // ACT
+        scene.Intersect(rays, intersections, 1e-6);
+
+        // ASSERT
+        const double tolerance = kSinglePrecision ? 1e-3 : 1e-9;
+        std::size_t numberOfHits = 0;
+        for (std::size_t i = 0; i < rays.size(); i++) {
+            auto intersection = scene.Intersect(rays[i], 1e-6);
+            ASSERT_EQ(intersections[i].has_value(), intersection.has_value());
+            if (intersection.has_value()) {
+                numberOfHits++;
+                EXPECT_EQ(intersections[i]->object, intersection->object);
+                EXPECT_NEAR(intersections[i]->t, intersection->t, tolerance);
+                EXPECT_NEAR((intersections[i]->normal - intersection->normal).Norm(), 0.0, tolerance);
+            }
+        }
+        EXPECT_GT(numberOfHits, 100);
+        std::vector<std::optional<Object::Intersection>> tooShort(rays.size() - 1);
+        EXPECT_THROW(scene.Intersect(rays, tooShort), std::invalid_argument);
+    }
+}
+
+TEST(TestScene, ObjectWithoutShape) {
+    for (auto accelerator : {Scene::Accelerator::LINEAR, Scene::Accelerator::BVH}) {
+        // ARRANGE
+        Scene scene;
+        scene.SetAccelerator(accelerator);
+        scene.AddObject(std::make_shared<ObjectPrimitive>("Shapeless", Material(), nullptr));
+        scene.AddObject(std::make_shared<ObjectPrimitive>("Sphere", Material(), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 0.0}), 1.0)));
+        scene.AddObject(std::make_shared<ObjectPrimitive>("Shapeless", Material(), nullptr));
+        // ACT
+        scene.BuildAccelerationStructure();
+        auto intersection = scene.Intersect(Ray(Vector3D({0.0, 0.0, -5.0}), Vector3D({0.0, 0.0, 1.0})));
+        // ASSERT
+        ASSERT_TRUE(intersection.has_value());
+        EXPECT_NEAR(intersection->t, 4.0, 1e-6);
+        EXPECT_FALSE(scene.Occluded(Ray(Vector3D({3.0, 0.0, -5.0}), Vector3D({0.0, 0.0, 1.0})), 10.0));
+    }
+}
+
+TEST(TestScene, SnapshotLeavesSceneUntouched) {
+    // ARRANGE
+    Scene scene;
+    auto object = std::make_shared<ObjectPrimitive>("Sphere", Material(), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 0.0, 0.0}), 0.5));
+    object->SetVelocity(Vector3D({1.0, 0.0, 0.0}));
+    scene.AddObject(object);
+    scene.AddObject(std::make_shared<ObjectPrimitive>("Static", Material(), std::make_shared<Geometry::Sphere>(Vector3D({0.0, 5.0, 0.0}), 0.5)));
+    scene.BuildAccelerationStructure();
+    Ray rayThroughOrigin(Vector3D({0.0, 0.0, -2.0}), Vector3D({0.0, 0.0, 1.0}));
+    Ray rayThroughSnapshot(Vector3D({2.0, 0.0, -2.0}), Vector3D({0.0, 0.0, 1.0}));
+    // ACT
+    Scene snapshot = scene.Snapshot(2.0);
+    Scene sameSnapshot = scene.Snapshot(2.0);
+    // ASSERT
+    EXPECT_DOUBLE_EQ(scene.GetTime(), 0.0);
+    EXPECT_DOUBLE_EQ(snapshot.GetTime(), 2.0);
+    EXPECT_TRUE(scene.Occluded(rayThroughOrigin, 10.0));
+    EXPECT_FALSE(scene.Occluded(rayThroughSnapshot, 10.0));
+    EXPECT_FALSE(snapshot.Occluded(rayThroughOrigin, 10.0));
+    EXPECT_TRUE(snapshot.Occluded(rayThroughSnapshot, 10.0));
+    EXPECT_TRUE(sameSnapshot.Occluded(rayThroughSnapshot, 10.0));
+    EXPECT_TRUE(snapshot.Occluded(Ray(Vector3D({0.0, 5.0, -2.0}), Vector3D({0.0, 0.0, 1.0})), 10.0));
+}
+
+TEST(TestScene, SnapshotMatchesFrameByFrameStepping) {
+    // ARRANGE
+    auto createScene = [] {
+        Scene scene;
+        auto object = std::make_shared<ObjectPrimitive>("Sphere", Material(), std::make_shared<Geometry::Sphere>(Vector3D({2.0, 0.0, 0.0}), 0.5));
+        object->SetVelocity(Vector3D({0.5, 1.0, 0.0}));
+        object->SetAcceleration(Vector3D({-2.0, 0.0, 0.0}));
+        object->SetAngularVelocity(Vector3D({0.0, 0.0, 1.5}));
+        scene.AddObject(object);
+        scene.BuildAccelerationStructure();
+        return scene;
+    };
+    const double timeStep = 0.1;
+    Scene scene = createScene();
+    Scene steppedScene = createScene();
+    // ACT
+    Scene snapshot = scene.Snapshot(7, timeStep);
+    for (std::size_t frame = 0; frame < 7; frame++) {
+        steppedScene.Evolve(timeStep);
+    }
+    // ASSERT
+    EXPECT_DOUBLE_EQ(snapshot.GetTime(), steppedScene.GetTime());
+    std::size_t hits = 0;
+    for (double x = -4.0; x <= 4.0; x += 0.05) {
+        for (double y = -4.0; y <= 4.0; y += 0.05) {
+            Ray ray(Vector3D({x, y, -5.0}), Vector3D({0.0, 0.0, 1.0}));
+            auto expected = steppedScene.Intersect(ray);
+            auto intersection = snapshot.Intersect(ray);
+            ASSERT_EQ(intersection.has_value(), expected.has_value());
+            if (expected) {
+                EXPECT_EQ(intersection->t, expected->t);
+                hits++;
+            }
+        }
+    }
+    EXPECT_GT(hits, 0);
+    EXPECT_TRUE(scene.Intersect(Ray(Vector3D({2.0, 0.0, -5.0}), Vector3D({0.0, 0.0, 1.0}))).has_value());
+}
@@ -26,26 +26,26 @@ TEST(TestColor, ValueConstructor) {
 
 TEST(TestColor, R_Getter) {
     Color c(0.9, 0.0, 0.0);
-    EXPECT_DOUBLE_EQ(c.R(), 0.9);
+    EXPECT_DOUBLE_EQ(c.R(), Real(0.9));
 }
 
 TEST(TestColor, G_Getter) {
     Color c(0.0, 0.8, 0.0);
-    EXPECT_DOUBLE_EQ(c.G(), 0.8);
+    EXPECT_DOUBLE_EQ(c.G(), Real(0.8));
 }
 
 TEST(TestColor, B_Getter) {
     Color c(0.0, 0.0, 0.7);
-    EXPECT_DOUBLE_EQ(c.B(), 0.7);
+    EXPECT_DOUBLE_EQ(c.B(), Real(0.7));
 }
 
 TEST(TestColor, GetRGB) {
     Color c(0.11, 0.22, 0.33);
     auto rgb = c.GetRGB();
     ASSERT_EQ(rgb.size(), 3u);
-    EXPECT_DOUBLE_EQ(rgb[0], 0.11);
-    EXPECT_DOUBLE_EQ(rgb[1], 0.22);
-    EXPECT_DOUBLE_EQ(rgb[2], 0.33);
+    EXPECT_DOUBLE_EQ(rgb[0], Real(0.11));
+    EXPECT_DOUBLE_EQ(rgb[1], Real(0.22));
+    EXPECT_DOUBLE_EQ(rgb[2], Real(0.33));
 }
 
 TEST(TestColor, GetHexColor) {
@@ -64,3 +64,24 @@ TEST(TestColor, StreamOperator) {
     // Matches your operator<< exactly:
     EXPECT_EQ(oss.str(), "RGB(1, 0.5, 0)");
 }
+
+TEST(TestColor, Arithmetic) {
+    Color a(0.25, 0.5, 0.75);
+    Color b(0.5, 0.25, 1.0);
+    EXPECT_EQ(a + b, Color(0.75, 0.75, 1.75));
+    EXPECT_EQ(b - a, Color(0.25, -0.25, 0.25));
+    EXPECT_EQ(a * b, Color(0.125, 0.125, 0.75));
+    EXPECT_EQ(2.0 * a, Color(0.5, 1.0, 1.5));
+    EXPECT_EQ(a / 0.5, Color(0.5, 1.0, 1.5));
+
+    Color c = a;
+    c += b;
+    c -= b;
+    EXPECT_EQ(c, a);
+    c *= b;
+    EXPECT_EQ(c, a * b);
+    c *= 2.0;
+    c /= 2.0;
+    EXPECT_EQ(c, a * b);
+}
+
@@ -9,3 +9,18 @@ TEST(TestImage, Test1) {
     // ACT
     // ASSERT
 }
+
+TEST(TestImage, Downsampled) {
+    // ARRANGE
+    Image image(4, 2);
+    image.SetPixel(0, 0, Color(1.0, 0.0, 0.0));
+    image.SetPixel(1, 1, Color(0.0, 1.0, 0.0));
+    image.SetPixel(3, 0, Color(0.0, 0.0, 1.0));
+    // ACT
+    Image downsampled = image.Downsampled(2);
+    // ASSERT
+    ASSERT_EQ(downsampled.GetWidth(), 2);
+    ASSERT_EQ(downsampled.GetHeight(), 1);
+    EXPECT_EQ(downsampled.GetPixel(0, 0), Color(0.25, 0.25, 0.0));
+    EXPECT_EQ(downsampled.GetPixel(1, 0), Color(0.0, 0.0, 0.25));
+}
@@ -2,6 +2,11 @@
 
 #include "Utilities/Math.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
 using namespace Raytracer;
 
 TEST(TestMath, Test1)
@@ -10,3 +15,64 @@ TEST(TestMath, Test1)
     // ACT
     // ASSERT
 }
+
+TEST(TestMath, SolveQuadraticInInterval) {
+    // ACT
+    auto roots = Math::SolveQuadraticInInterval({2.0, -6.0, 4.0}, -10.0, 10.0);
+    auto clipped = Math::SolveQuadraticInInterval({2.0, -6.0, 4.0}, 1.5, 10.0);
+
+    // ASSERT
+    ASSERT_EQ(roots.size(), 2);
+    EXPECT_DOUBLE_EQ(roots[0], 1.0);
+    EXPECT_DOUBLE_EQ(roots[1], 2.0);
+    ASSERT_EQ(clipped.size(), 1);
+    EXPECT_DOUBLE_EQ(clipped[0], 2.0);
+    EXPECT_TRUE(Math::SolveQuadraticInInterval({1.0, 0.0, 1.0}, -10.0, 10.0).empty());
+}
+
+TEST(TestMath, SolveCubicInInterval) {
+    // ARRANGE
+    // (t - 1)(t - 2)(t + 3) = t^3 - 7t + 6
+    std::array<double, 4> coefficients = {1.0, 0.0, -7.0, 6.0};
+
+    // ACT
+    auto roots = Math::SolveCubicInInterval(coefficients, -10.0, 10.0);
+
+    // ASSERT
+    ASSERT_EQ(roots.size(), 3);
+    EXPECT_NEAR(roots[0], -3.0, 1e-12);
+    EXPECT_NEAR(roots[1], 1.0, 1e-12);
+    EXPECT_NEAR(roots[2], 2.0, 1e-12);
+}
+
+TEST(TestMath, SolveQuarticBracketedAccuracy) {
+    // ARRANGE
+    std::mt19937 prng(11);
+    std::uniform_real_distribution<double> distribution(-5.0, 5.0);
+    double maximumErrorBracketed = 0.0;
+    for (int i = 0; i < 1000; i++) {
+        std::array<double, 4> expected = {distribution(prng), distribution(prng), distribution(prng), distribution(prng)};
+        std::sort(expected.begin(), expected.end());
+        if (expected[1] - expected[0] < 1e-3 || expected[2] - expected[1] < 1e-3 || expected[3] - expected[2] < 1e-3) {
+            continue;
+        }
+        // Expand (t - r0)(t - r1)(t - r2)(t - r3)
+        std::array<double, 5> c = {1.0, 0.0, 0.0, 0.0, 0.0};
+        for (std::size_t k = 0; k < 4; k++) {
+            for (std::size_t j = k + 1; j > 0; j--) {
+                c[j] -= expected[k] * c[j - 1];
+            }
+        }
+
+        // ACT
+        auto roots = Math::SolveQuarticBracketed(c[0], c[1], c[2], c[3], c[4]);
+
+        // ASSERT
+        ASSERT_EQ(roots.size(), 4);
+        for (std::size_t k = 0; k < 4; k++) {
+            maximumErrorBracketed = std::max(maximumErrorBracketed, std::abs(roots[k] - expected[k]));
+        }
+    }
+    EXPECT_LT(maximumErrorBracketed, 1e-9);
+    EXPECT_TRUE(Math::SolveQuarticBracketed(1.0, 0.0, 0.0, 0.0, 1.0).empty());
+}
@@ -0,0 +1,132 @@
+#include "gtest/gtest.h"
+
+#include "Utilities/MeshLoader.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace Raytracer;
+
+namespace {
+
+std::string WriteFile(const std::string& name, const std::string& content) {
+    std::string filepath = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream file(filepath, std::ios::binary);
+    file << content;
+    return filepath;
+}
+
+template <typename T>
+void AppendBigEndian(std::string& content, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    for (std::size_t i = 0; i < sizeof(T); i++) {
+        content.push_back(bytes[sizeof(T) - 1 - i]);
+    }
+}
+
+template <typename T>
+void AppendLittleEndian(std::string& content, T value) {
+    content.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+}  // namespace
+
+TEST(TestMeshLoader, OBJPositionsOnly) {
+    // ARRANGE
+    std::string filepath = WriteFile("test_positions.obj",
+                                     "# Quad and a triangle with negative indices\n"
+                                     "o quad\n"
+                                     "v 0 0 0\n"
+                                     "v 1.0 0.0 0.0\n"
+                                     "v 1 1 0\n"
+                                     "v 0 1 0\n"
+                                     "f 1 2 3 4\n"
+                                     "v 2 0 0\n"
+                                     "f -1 -4 -3\n");
+
+    // ACT
+    auto buffers = MeshLoader::Load(filepath, 2.0);
+
+    // ASSERT
+    EXPECT_EQ(buffers.NumberOfVertices(), 5);
+    EXPECT_EQ(buffers.NumberOfTriangles(), 3);
+    EXPECT_FALSE(buffers.HasNormals());
+    EXPECT_FALSE(buffers.HasTextureCoordinates());
+    EXPECT_FLOAT_EQ(buffers.x[4], 4.0f);
+    EXPECT_EQ(buffers.indices, (std::vector<std::uint32_t>{0, 1, 2, 0, 2, 3, 4, 1, 2}));
+}
+
+TEST(TestMeshLoader, OBJWithNormalsAndTextureCoordinates) {
+    // ARRANGE
+    std::string filepath = WriteFile("test_attributes.obj",
+                                     "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+                                     "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+                                     "vn 0 0 1\n"
+                                     "f 1/1/1 2/2/1 3/3/1\n"
+                                     "f 1/1/1 3/3/1 4/4/1\n"
+                                     "f 1/2/1 2/2/1 3/3/1\n");
+
+    // ACT
+    auto buffers = MeshLoader::LoadOBJ(filepath);
+
+    // ASSERT
+    // Vertex 1 is used with two different texture coordinates
+    EXPECT_EQ(buffers.NumberOfVertices(), 5);
+    EXPECT_EQ(buffers.NumberOfTriangles(), 3);
+    EXPECT_TRUE(buffers.HasNormals());
+    EXPECT_TRUE(buffers.HasTextureCoordinates());
+    EXPECT_FLOAT_EQ(buffers.u[buffers.indices[6]], 1.0f);
+    EXPECT_FLOAT_EQ(buffers.normalZ[buffers.indices[6]], 1.0f);
+    EXPECT_NO_THROW(buffers.Validate());
+}
+
+TEST(TestMeshLoader, BinaryPLY) {
+    // ARRANGE
+    const float vertices[4][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+    for (bool bigEndian : {false, true}) {
+        std::string content = std::string("ply\nformat ") + (bigEndian ? "binary_big_endian" : "binary_little_endian") + " 1.0\n"
+                              "comment test\n"
+                              "element vertex 4\n"
+                              "property float x\nproperty float y\nproperty float z\nproperty uchar red\n"
+                              "element face 1\n"
+                              "property list uchar int vertex_indices\n"
+                              "end_header\n";
+        for (const auto& vertex : vertices) {
+            for (float coordinate : vertex) {
+                bigEndian ? AppendBigEndian(content, coordinate) : AppendLittleEndian(content, coordinate);
+            }
+            content.push_back(static_cast<char>(255));
+        }
+        content.push_back(4);
+        for (std::int32_t index : {0, 1, 2, 3}) {
+            bigEndian ? AppendBigEndian(content, index) : AppendLittleEndian(content, index);
+        }
+        std::string filepath = WriteFile("test_binary.ply", content);
+
+        // ACT
+        auto buffers = MeshLoader::Load(filepath);
+
+        // ASSERT
+        EXPECT_EQ(buffers.NumberOfVertices(), 4);
+        EXPECT_EQ(buffers.NumberOfTriangles(), 2);
+        EXPECT_FLOAT_EQ(buffers.x[2], 1.0f);
+        EXPECT_FLOAT_EQ(buffers.y[2], 1.0f);
+        EXPECT_EQ(buffers.indices, (std::vector<std::uint32_t>{0, 1, 2, 0, 2, 3}));
+    }
+}
+
+TEST(TestMeshLoader, InvalidFiles) {
+    // ARRANGE
+    std::string asciiPLY = WriteFile("test_ascii.ply", "ply\nformat ascii 1.0\nelement vertex 0\nend_header\n");
+    std::string invalidOBJ = WriteFile("test_invalid.obj", "v 0 0 0\nf 1 2 3\n");
+
+    // ACT & ASSERT
+    EXPECT_THROW(MeshLoader::Load(asciiPLY), std::runtime_error);
+    EXPECT_THROW(MeshLoader::Load(invalidOBJ), std::runtime_error);
+    EXPECT_THROW(MeshLoader::Load("model.stl"), std::invalid_argument);
+    EXPECT_THROW(MeshLoader::Load("does_not_exist.obj"), std::runtime_error);
+}
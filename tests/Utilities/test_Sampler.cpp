@@ -0,0 +1,50 @@
+#include "gtest/gtest.h"
+
+#include "Utilities/Sampler.hpp"
+
+using namespace Raytracer;
+
+TEST(TestSampler, UniformRange) {
+    // ARRANGE
+    Sampler sampler(1);
+    const std::size_t numSamples = 100000;
+    double sum = 0.0;
+
+    // ACT & ASSERT
+    for (std::size_t i = 0; i < numSamples; i++) {
+        double u = sampler.Uniform();
+        ASSERT_GE(u, 0.0);
+        ASSERT_LT(u, 1.0);
+        sum += u;
+    }
+    EXPECT_NEAR(sum / numSamples, 0.5, 0.01);
+}
+
+TEST(TestSampler, StreamsAreReproducible) {
+    // ARRANGE
+    Sampler sampler1(42, 0, 10, 20, 3);
+    Sampler sampler2(42, 0, 10, 20, 3);
+
+    // ACT & ASSERT
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(sampler1(), sampler2());
+    }
+}
+
+TEST(TestSampler, StreamsAreIndependent) {
+    // ARRANGE
+    Sampler reference(42, 0, 10, 20, 3);
+    Sampler otherSeed(43, 0, 10, 20, 3);
+    Sampler otherFrame(42, 1, 10, 20, 3);
+    Sampler otherPixel(42, 0, 20, 10, 3);
+    Sampler otherSample(42, 0, 10, 20, 4);
+
+    // ACT
+    auto first = reference();
+
+    // ASSERT
+    EXPECT_NE(first, otherSeed());
+    EXPECT_NE(first, otherFrame());
+    EXPECT_NE(first, otherPixel());
+    EXPECT_NE(first, otherSample());
+}
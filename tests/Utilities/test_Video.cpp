@@ -9,3 +9,16 @@ TEST(TestVideo, Test1) {
     // ACT
     // ASSERT
 }
+
+TEST(TestVideo, PreviewHasBoundedMemory) {
+    // ARRANGE
+    Video preview(32.0, 10, 8);
+    // ACT
+    for (std::size_t i = 0; i < 100; i++) {
+        preview.AddFrame(Image(40, 20));
+    }
+    // ASSERT
+    EXPECT_LE(preview.GetNumberOfFrames(), 8);
+    EXPECT_GE(preview.GetNumberOfFrames(), 4);
+    EXPECT_NEAR(preview.GetDuration(), 100.0 / 32.0, 0.5);
+}
@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+
+#include "Utilities/VideoEncoder.hpp"
+
+#include <filesystem>
+
+using namespace Raytracer;
+
+TEST(TestVideoEncoder, CreateCommand) {
+    // ARRANGE
+    std::size_t width = 64;
+    std::size_t height = 48;
+    double fps = 24.0;
+    // ACT
+    std::string command = VideoEncoder::CreateCommand(width, height, fps, "video.mp4");
+    // ASSERT
+    EXPECT_NE(command.find("-f rawvideo -pix_fmt rgb24 -s 64x48 -framerate 24 -i -"), std::string::npos);
+    EXPECT_NE(command.find("\"video.mp4\""), std::string::npos);
+}
+
+TEST(TestVideoEncoder, AddFrameWithWrongDimensions) {
+    // ARRANGE
+    std::string filepath = (std::filesystem::temp_directory_path() / "test_video_encoder.mp4").string();
+    VideoEncoder encoder(4, 4, 30.0, filepath);
+    Image frame(4, 2);
+    // ACT & ASSERT
+    EXPECT_THROW(encoder.AddFrame(frame), std::invalid_argument);
+    EXPECT_EQ(encoder.GetNumberOfFrames(), 0);
+    encoder.Close();
+    std::filesystem::remove(filepath);
+}
+
+TEST(TestVideoEncoder, AddFrameAfterFfmpegFailed) {
+    // ARRANGE
+    // libx264 rejects odd dimensions for yuv420p, so ffmpeg exits early whether it is installed or not
+    std::string filepath = (std::filesystem::temp_directory_path() / "test_video_encoder_failed.mp4").string();
+    VideoEncoder encoder(511, 511, 30.0, filepath);
+    Image frame(511, 511);
+    // ACT & ASSERT
+    EXPECT_THROW(
+        {
+            for (std::size_t i = 0; i < 100; i++) {
+                encoder.AddFrame(frame);
+            }
+        },
+        std::runtime_error);
+    EXPECT_FALSE(encoder.Close());
+    std::filesystem::remove(filepath);
+}